@@ -87,12 +87,20 @@ std::unique_ptr<SSLProto::SSL_DetectionFrame> createSSLDetectionFrame(
 
 std::vector<BallDetection> createBallDetections(
     const std::vector<SSLProto::SSL_DetectionFrame>& detections, double min_valid_x,
-    double max_valid_x, bool ignore_invalid_camera_data)
+    double max_valid_x, bool ignore_invalid_camera_data,
+    const std::map<unsigned int, CameraPosition>& camera_positions)
 {
     auto ball_detections = std::vector<BallDetection>();
 
     for (const auto& detection : detections)
     {
+        std::optional<CameraPosition> camera;
+        auto camera_position_iter = camera_positions.find(detection.camera_id());
+        if (camera_position_iter != camera_positions.end())
+        {
+            camera = camera_position_iter->second;
+        }
+
         for (const SSLProto::SSL_DetectionBall& ball : detection.balls())
         {
             // Convert all data to meters and radians
@@ -101,7 +109,8 @@ std::vector<BallDetection> createBallDetections(
                                               ball.y() * METERS_PER_MILLIMETER),
                 .distance_from_ground = ball.z() * METERS_PER_MILLIMETER,
                 .timestamp            = Timestamp::fromSeconds(detection.t_capture()),
-                .confidence           = ball.confidence()};
+                .confidence           = ball.confidence(),
+                .camera               = camera};
 
             bool ignore_ball = ignore_invalid_camera_data &&
                                (min_valid_x > ball_detection.position.x() ||
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <limits>
+#include <map>
 #include <memory>
 
 #include "proto/ssl_vision_detection.pb.h"
@@ -59,6 +60,8 @@ std::unique_ptr<SSLProto::SSL_DetectionFrame> createSSLDetectionFrame(
  * @param max_valid_x max valid x value
  * @param ignore_invalid_camera_data whether or not to ignore ball outside of valid x
  * range
+ * @param camera_positions The position of each camera, keyed by camera id, which is
+ * added to the detections made by that camera
  *
  * @return all the valid ball detections contained in the ssl detection frames
  */
@@ -66,7 +69,8 @@ std::vector<BallDetection> createBallDetections(
     const std::vector<SSLProto::SSL_DetectionFrame>& detections,
     double min_valid_x              = std::numeric_limits<double>::min(),
     double max_valid_x              = std::numeric_limits<double>::max(),
-    bool ignore_invalid_camera_data = false);
+    bool ignore_invalid_camera_data = false,
+    const std::map<unsigned int, CameraPosition>& camera_positions = {});
 
 /**
  * Reads the robot data for the given team contained in the list of DetectionFrames
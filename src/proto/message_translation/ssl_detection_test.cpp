@@ -141,6 +141,25 @@ TEST(SSLDetectionTest, test_convert_valid_position_ball_state_to_proto_and_back)
     EXPECT_FLOAT_EQ(0.2f, static_cast<float>(ball_detection.distance_from_ground));
 }
 
+TEST(SSLDetectionTest, test_ball_detections_include_camera_position)
+{
+    const BallState ball_state(Point(1, 2), Vector(0, 0), 0);
+    auto camera_0_frame = createSSLDetectionFrame(0, Timestamp::fromSeconds(1), 40391,
+                                                  {ball_state}, {}, {});
+    auto camera_1_frame = createSSLDetectionFrame(1, Timestamp::fromSeconds(1), 40391,
+                                                  {ball_state}, {}, {});
+    std::map<unsigned int, CameraPosition> camera_positions = {
+        {0, CameraPosition{.ground_position = Point(-3, 1.5), .height = 4}}};
+
+    std::vector<BallDetection> ball_detections = createBallDetections(
+        {*camera_0_frame, *camera_1_frame}, 0.0, 0.0, false, camera_positions);
+    ASSERT_EQ(2, ball_detections.size());
+    ASSERT_TRUE(ball_detections.at(0).camera);
+    EXPECT_EQ(Point(-3, 1.5), ball_detections.at(0).camera->ground_position);
+    EXPECT_DOUBLE_EQ(4, ball_detections.at(0).camera->height);
+    EXPECT_FALSE(ball_detections.at(1).camera);
+}
+
 TEST(SSLDetectionTest, test_convert_robot_states_to_proto_and_back)
 {
     const uint32_t camera_id    = 0;
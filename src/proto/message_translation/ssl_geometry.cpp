@@ -379,3 +379,25 @@ std::optional<Field> createField(const SSLProto::SSL_GeometryData& geometry_pack
                         goal_depth, goal_width, boundary_width, center_circle_radius);
     return field;
 }
+
+std::map<unsigned int, CameraPosition> createCameraPositions(
+    const SSLProto::SSL_GeometryData& geometry_packet)
+{
+    std::map<unsigned int, CameraPosition> camera_positions;
+    for (const auto& calibration : geometry_packet.calib())
+    {
+        if (!calibration.has_derived_camera_world_tx() ||
+            !calibration.has_derived_camera_world_ty() ||
+            !calibration.has_derived_camera_world_tz())
+        {
+            continue;
+        }
+
+        camera_positions[calibration.camera_id()] = CameraPosition{
+            .ground_position =
+                Point(calibration.derived_camera_world_tx() * METERS_PER_MILLIMETER,
+                      calibration.derived_camera_world_ty() * METERS_PER_MILLIMETER),
+            .height = calibration.derived_camera_world_tz() * METERS_PER_MILLIMETER};
+    }
+    return camera_positions;
+}
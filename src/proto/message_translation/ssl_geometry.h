@@ -1,11 +1,13 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <optional>
 
 #include "proto/ssl_vision_geometry.pb.h"
 #include "software/geom/circle.h"
 #include "software/geom/segment.h"
+#include "software/sensor_fusion/filter/vision_detection.h"
 #include "software/util/make_enum/make_enum.hpp"
 #include "software/world/field.h"
 
@@ -219,3 +221,16 @@ std::unique_ptr<SSLProto::SSL_GeometryData> createGeometryData(const Field& fiel
  *      If packet_geometry is not a valid packet, then will return std::nullopt
  */
 std::optional<Field> createField(const SSLProto::SSL_GeometryData& geometry_packet);
+
+/**
+ * Returns the positions of the cameras described by the calibrations in a geometry
+ * packet
+ *
+ * @param geometry_packet The SSLProto::SSL_GeometryData packet containing the camera
+ * calibrations
+ *
+ * @return The position of each camera, keyed by camera id. Cameras whose calibration
+ * doesn't include their position in the world are left out.
+ */
+std::map<unsigned int, CameraPosition> createCameraPositions(
+    const SSLProto::SSL_GeometryData& geometry_packet);
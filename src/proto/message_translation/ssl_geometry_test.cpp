@@ -616,3 +616,22 @@ TEST_F(SSLGeometryTest, test_convert_field_to_proto_and_back)
     ASSERT_TRUE(new_field);
     EXPECT_EQ(field, new_field.value());
 }
+
+TEST_F(SSLGeometryTest, test_create_camera_positions)
+{
+    SSLProto::SSL_GeometryData geometry_data;
+    auto calibration = geometry_data.add_calib();
+    calibration->set_camera_id(2);
+    calibration->set_derived_camera_world_tx(-1500.0f);
+    calibration->set_derived_camera_world_ty(2250.0f);
+    calibration->set_derived_camera_world_tz(4000.0f);
+
+    // A calibration without the position of the camera in the world is left out
+    geometry_data.add_calib()->set_camera_id(3);
+
+    auto camera_positions = createCameraPositions(geometry_data);
+    ASSERT_EQ(1, camera_positions.size());
+    ASSERT_TRUE(camera_positions.contains(2));
+    EXPECT_EQ(Point(-1.5, 2.25), camera_positions.at(2).ground_position);
+    EXPECT_DOUBLE_EQ(4, camera_positions.at(2).height);
+}
@@ -102,6 +102,7 @@ std::unique_ptr<TbotsProto::Ball> createBall(const Ball& ball)
     auto ball_msg                        = std::make_unique<TbotsProto::Ball>();
     *(ball_msg->mutable_current_state()) = *createBallState(ball);
     *(ball_msg->mutable_timestamp())     = *createTimestamp(ball.timestamp());
+    ball_msg->set_chipped(ball.isChipped());
 
     return ball_msg;
 }
@@ -280,10 +281,11 @@ std::unique_ptr<TbotsProto::GameState> createGameState(const GameState& game_sta
             break;
     }
 
-    auto ball_state = game_state.getBall();
-    if (ball_state.has_value())
+    auto restart_ball_position = game_state.getRestartBallPosition();
+    if (restart_ball_position.has_value())
     {
-        *(game_state_msg->mutable_ball()) = *createBall(ball_state.value());
+        *(game_state_msg->mutable_restart_ball_position()) =
+            *createPointProto(restart_ball_position.value());
     }
 
     auto ball_placement_point = game_state.getBallPlacementPoint();
@@ -351,18 +353,20 @@ std::unique_ptr<TbotsProto::DebugShapes> createDebugShapes(
 
 std::unique_ptr<TbotsProto::Timestamp> createCurrentTimestamp()
 {
-    auto timestamp_msg    = std::make_unique<TbotsProto::Timestamp>();
-    const auto clock_time = std::chrono::system_clock::now();
-    double time_in_seconds =
-        static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
-                                clock_time.time_since_epoch())
-                                .count()) /
-        MICROSECONDS_PER_SECOND;
-
-    timestamp_msg->set_epoch_timestamp_seconds(time_in_seconds);
+    auto timestamp_msg = std::make_unique<TbotsProto::Timestamp>();
+    timestamp_msg->set_epoch_timestamp_seconds(getCurrentEpochTimeSeconds());
     return timestamp_msg;
 }
 
+double getCurrentEpochTimeSeconds()
+{
+    const auto clock_time = std::chrono::system_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                   clock_time.time_since_epoch())
+                                   .count()) /
+           MICROSECONDS_PER_SECOND;
+}
+
 RobotState createRobotState(const TbotsProto::RobotState robot_state)
 {
     return RobotState(createPoint(robot_state.global_position()),
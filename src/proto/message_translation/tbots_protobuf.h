@@ -187,6 +187,13 @@ std::unique_ptr<TbotsProto::Shape> createShapeProto(const Stadium& stadium);
  */
 std::unique_ptr<TbotsProto::Timestamp> createCurrentTimestamp();
 
+/**
+ * Returns the time that this function was called, without allocating a Timestamp msg
+ *
+ * @return The current UTC time in seconds since Unix epoch
+ */
+double getCurrentEpochTimeSeconds();
+
 /**
  * Return RobotState given the TbotsProto::RobotState protobuf
  *
@@ -37,7 +37,7 @@ static const short unsigned int PLOTJUGGLER_GUI_DEFAULT_PORT = 9870;
 static const std::string REPLAY_FILE_EXTENSION      = "replay";
 static const std::string REPLAY_METADATA_DELIMITER  = ",";
 static const std::string REPLAY_FILE_VERSION_PREFIX = "version:";
-static const unsigned int REPLAY_FILE_VERSION       = 2;
+static const unsigned int REPLAY_FILE_VERSION       = 3;
 
 #endif  // PLATFORMIO_BUILD
 
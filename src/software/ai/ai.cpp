@@ -4,6 +4,7 @@
 
 #include "software/ai/hl/stp/play/halt_play/halt_play.h"
 #include "software/ai/hl/stp/play/play_factory.h"
+#include "software/tracing/tracer.h"
 #include "software/tracy/tracy_constants.h"
 
 
@@ -67,6 +68,7 @@ void Ai::checkAiConfig()
 std::unique_ptr<TbotsProto::PrimitiveSet> Ai::getPrimitives(const WorldPtr& world_ptr)
 {
     FrameMarkStart(TracyConstants::AI_FRAME_MARKER);
+    TRACE_ZONE("AI: getPrimitives");
 
     checkAiConfig();
 
@@ -99,11 +101,13 @@ TbotsProto::PlayInfo Ai::getPlayInfo() const
 {
     std::vector<std::string> play_state = current_play->getState();
     auto tactic_robot_id_assignment     = current_play->getTacticRobotIdAssignment();
+    auto tactic_run_times_ms            = current_play->getTacticRunTimesMs();
 
     if (static_cast<bool>(override_play))
     {
         play_state                 = override_play->getState();
         tactic_robot_id_assignment = override_play->getTacticRobotIdAssignment();
+        tactic_run_times_ms        = override_play->getTacticRunTimesMs();
     }
 
     TbotsProto::PlayInfo info;
@@ -118,6 +122,11 @@ TbotsProto::PlayInfo Ai::getPlayInfo() const
         TbotsProto::PlayInfo_Tactic tactic_msg;
         tactic_msg.set_tactic_name(objectTypeName(*tactic));
         tactic_msg.set_tactic_fsm_state(tactic->getFSMState());
+        auto run_time_iter = tactic_run_times_ms.find(tactic.get());
+        if (run_time_iter != tactic_run_times_ms.end())
+        {
+            tactic_msg.set_run_time_ms(run_time_iter->second);
+        }
         (*info.mutable_robot_tactic_assignment())[robot_id] = tactic_msg;
     }
 
@@ -0,0 +1,422 @@
+#include <google/protobuf/text_format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "proto/parameters.pb.h"
+#include "proto/world.pb.h"
+#include "software/ai/ai.h"
+#include "software/logger/replay_reader.h"
+#include "software/world/world.h"
+
+/**
+ * Measures how long the AI takes to run on real match data, by re-running
+ * Ai::getPrimitives as fast as possible over the Worlds recorded in a replay log.
+ *
+ * Reports the wall time and number of heap allocations of each tick, broken down by
+ * the play that was running, and the run time of each tactic. Since the Worlds are
+ * always the same, the results can be compared between commits to catch performance
+ * regressions in plays, tactics, the planner and passing.
+ *
+ * Logging and visualization are not initialized, so protobufs the AI visualizes are
+ * dropped and don't add to the measured times.
+ */
+
+namespace
+{
+    // Heap allocations made by every thread since the program started
+    std::atomic<uint64_t> num_allocations(0);
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    num_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    const std::string WORLD_TYPE_FULL_NAME = TbotsProto::World::descriptor()->full_name();
+
+    /**
+     * Summarizes a set of samples
+     */
+    class SampleSummary
+    {
+       public:
+        /**
+         * Adds a sample
+         *
+         * @param sample The sample
+         */
+        void add(double sample)
+        {
+            samples.push_back(sample);
+            total += sample;
+        }
+
+        /**
+         * Returns the number of samples
+         *
+         * @return the number of samples
+         */
+        size_t count() const
+        {
+            return samples.size();
+        }
+
+        /**
+         * Returns the sum of the samples
+         *
+         * @return the sum of the samples
+         */
+        double sum() const
+        {
+            return total;
+        }
+
+        /**
+         * Returns the mean of the samples
+         *
+         * @return the mean of the samples, or 0 if there are none
+         */
+        double mean() const
+        {
+            return samples.empty() ? 0.0 : total / static_cast<double>(samples.size());
+        }
+
+        /**
+         * Returns a percentile of the samples, using the nearest rank
+         *
+         * @param percentile The percentile, in [0, 100]
+         *
+         * @return the percentile of the samples, or 0 if there are none
+         */
+        double percentile(double percentile)
+        {
+            if (samples.empty())
+            {
+                return 0.0;
+            }
+            std::sort(samples.begin(), samples.end());
+            const auto rank = static_cast<size_t>(
+                std::ceil(percentile / 100.0 * static_cast<double>(samples.size())));
+            return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+        }
+
+       private:
+        std::vector<double> samples;
+        double total = 0.0;
+    };
+
+    /**
+     * The measurements of a group of ticks, or of the runs of a tactic
+     */
+    struct Measurements
+    {
+        SampleSummary times_ms;
+        SampleSummary allocations;
+    };
+
+    /**
+     * Loads the AiConfig to run the AI with
+     *
+     * @param ai_config_path The path to a text format AiConfig, or empty to use the
+     * default AiConfig
+     *
+     * @return the AiConfig
+     */
+    std::shared_ptr<TbotsProto::AiConfig> loadAiConfig(const std::string& ai_config_path)
+    {
+        auto ai_config = std::make_shared<TbotsProto::AiConfig>();
+        if (ai_config_path.empty())
+        {
+            return ai_config;
+        }
+
+        std::ifstream ai_config_file(ai_config_path);
+        if (!ai_config_file)
+        {
+            throw std::invalid_argument("Could not open AiConfig " + ai_config_path);
+        }
+        std::stringstream ai_config_text;
+        ai_config_text << ai_config_file.rdbuf();
+        if (!google::protobuf::TextFormat::ParseFromString(ai_config_text.str(),
+                                                            ai_config.get()))
+        {
+            throw std::invalid_argument("Could not parse AiConfig " + ai_config_path);
+        }
+        return ai_config;
+    }
+
+    /**
+     * Creates the World the AI ran on from a logged World. Unlike the World constructor
+     * that takes a protobuf, this keeps the game state and dribble displacement, which
+     * the AI needs to choose the plays it ran during the match.
+     *
+     * @param world_proto The logged World
+     *
+     * @return the World
+     */
+    std::shared_ptr<const World> createWorld(const TbotsProto::World& world_proto)
+    {
+        auto world = std::make_shared<World>(world_proto);
+        world->updateGameState(GameState(world_proto.game_state()));
+        if (world_proto.has_dribble_displacement())
+        {
+            const TbotsProto::Segment& displacement = world_proto.dribble_displacement();
+            world->setDribbleDisplacement(
+                Segment(Point(displacement.start().x_meters(),
+                              displacement.start().y_meters()),
+                        Point(displacement.end().x_meters(),
+                              displacement.end().y_meters())));
+        }
+        return world;
+    }
+
+    /**
+     * Returns the name of the play the AI is running. Plays with stages report their
+     * state as the name of the play followed by the stage, which is stripped so all
+     * stages of a play are grouped together.
+     *
+     * @param play_info The play info from the AI
+     *
+     * @return the name of the play
+     */
+    std::string playName(const TbotsProto::PlayInfo& play_info)
+    {
+        if (play_info.play().play_state().empty())
+        {
+            return "Unknown";
+        }
+        const std::string& play_state = play_info.play().play_state(0);
+        return play_state.substr(0, play_state.find(" - "));
+    }
+
+    /**
+     * Prints a table with a row of measurements for each name
+     *
+     * @param title The title of the table
+     * @param measurements The measurements of each name
+     */
+    void printTable(const std::string& title,
+                    std::map<std::string, Measurements>& measurements)
+    {
+        std::cout << std::endl
+                  << std::left << std::setw(40) << title << std::right << std::setw(10)
+                  << "Count" << std::setw(12) << "Total (ms)" << std::setw(11)
+                  << "Mean (ms)" << std::setw(10) << "p50 (ms)" << std::setw(10)
+                  << "p99 (ms)" << std::setw(12) << "Allocations" << std::endl;
+        for (auto& [name, measurement] : measurements)
+        {
+            std::cout << std::left << std::setw(40) << name << std::right
+                      << std::setw(10) << measurement.times_ms.count() << std::setw(12)
+                      << measurement.times_ms.sum() << std::setw(11)
+                      << measurement.times_ms.mean() << std::setw(10)
+                      << measurement.times_ms.percentile(50) << std::setw(10)
+                      << measurement.times_ms.percentile(99) << std::setw(12);
+            if (measurement.allocations.count() > 0)
+            {
+                std::cout << measurement.allocations.mean();
+            }
+            else
+            {
+                std::cout << "-";
+            }
+            std::cout << std::endl;
+        }
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    struct CommandLineArgs
+    {
+        bool help                 = false;
+        std::string replay_dir    = "";
+        std::string ai_config     = "";
+        std::string output_csv    = "";
+        unsigned int iterations   = 1;
+        unsigned int max_worlds   = 0;
+        unsigned int warmup_ticks = 60;
+    };
+
+    CommandLineArgs args;
+    boost::program_options::options_description desc{"Options"};
+    desc.add_options()("help,h", boost::program_options::bool_switch(&args.help),
+                       "Help screen");
+    desc.add_options()("replay_dir",
+                       boost::program_options::value<std::string>(&args.replay_dir),
+                       "The folder of replay chunks to read Worlds from.");
+    desc.add_options()("ai_config",
+                       boost::program_options::value<std::string>(&args.ai_config),
+                       "A text format AiConfig to run the AI with. If not given, the "
+                       "default AiConfig is used.");
+    desc.add_options()("output_csv",
+                       boost::program_options::value<std::string>(&args.output_csv),
+                       "A CSV file to write the measurements of every tick to.");
+    desc.add_options()("iterations",
+                       boost::program_options::value<unsigned int>(&args.iterations),
+                       "How many times to run a new AI over the Worlds.");
+    desc.add_options()("max_worlds",
+                       boost::program_options::value<unsigned int>(&args.max_worlds),
+                       "The number of Worlds to run the AI on in each iteration. If not "
+                       "given, the AI is run on every World in the replay.");
+    desc.add_options()(
+        "warmup_ticks",
+        boost::program_options::value<unsigned int>(&args.warmup_ticks),
+        "The number of ticks at the start of each iteration that aren't measured.");
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (args.help)
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+    if (args.replay_dir.empty())
+    {
+        std::cerr << "--replay_dir is required" << std::endl;
+        return 1;
+    }
+
+    std::shared_ptr<TbotsProto::AiConfig> ai_config = loadAiConfig(args.ai_config);
+    ai_config->mutable_ai_control_config()->set_time_tactics(true);
+
+    std::ofstream csv_file;
+    if (!args.output_csv.empty())
+    {
+        csv_file.open(args.output_csv);
+        csv_file << "iteration,tick,world_time_s,play,time_ms,allocations" << std::endl;
+    }
+
+    Measurements all_ticks;
+    std::map<std::string, Measurements> play_measurements;
+    std::map<std::string, Measurements> tactic_measurements;
+
+    for (unsigned int iteration = 0; iteration < args.iterations; iteration++)
+    {
+        // Every iteration starts from a new AI, so they all run the same ticks
+        Ai ai(ai_config);
+        ReplayReader replay_reader(args.replay_dir);
+        TbotsProto::World world_proto;
+        unsigned int tick = 0;
+
+        while (args.max_worlds == 0 || tick < args.max_worlds)
+        {
+            std::optional<ReplayEntryView> entry = replay_reader.nextEntryView();
+            if (!entry)
+            {
+                break;
+            }
+            if (entry->protobuf_type_full_name != WORLD_TYPE_FULL_NAME)
+            {
+                continue;
+            }
+            if (!world_proto.ParseFromArray(
+                    entry->serialized_proto.data(),
+                    static_cast<int>(entry->serialized_proto.size())))
+            {
+                std::cerr << "Skipping a World that could not be parsed" << std::endl;
+                continue;
+            }
+            std::shared_ptr<const World> world = createWorld(world_proto);
+
+            const uint64_t allocations_before = num_allocations.load();
+            const auto start_time             = std::chrono::steady_clock::now();
+            ai.getPrimitives(world);
+            const double time_ms = std::chrono::duration<double, std::milli>(
+                                       std::chrono::steady_clock::now() - start_time)
+                                       .count();
+            const auto allocations =
+                static_cast<double>(num_allocations.load() - allocations_before);
+
+            const TbotsProto::PlayInfo play_info = ai.getPlayInfo();
+            const std::string play_name          = playName(play_info);
+
+            if (tick++ < args.warmup_ticks)
+            {
+                continue;
+            }
+
+            all_ticks.times_ms.add(time_ms);
+            all_ticks.allocations.add(allocations);
+            play_measurements[play_name].times_ms.add(time_ms);
+            play_measurements[play_name].allocations.add(allocations);
+            for (const auto& [robot_id, tactic] : play_info.robot_tactic_assignment())
+            {
+                tactic_measurements[tactic.tactic_name()].times_ms.add(
+                    tactic.run_time_ms());
+            }
+
+            if (csv_file.is_open())
+            {
+                csv_file << iteration << "," << tick - 1 << ","
+                         << world->getMostRecentTimestamp().toSeconds() << ","
+                         << play_name << "," << time_ms << "," << allocations
+                         << std::endl;
+            }
+        }
+    }
+
+    if (all_ticks.times_ms.count() == 0)
+    {
+        std::cerr << "No Worlds were measured in " << args.replay_dir << std::endl;
+        return 1;
+    }
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "Ticks measured: " << all_ticks.times_ms.count() << " over "
+              << args.iterations << " iterations" << std::endl
+              << "Tick time (ms): mean " << all_ticks.times_ms.mean() << ", p50 "
+              << all_ticks.times_ms.percentile(50) << ", p99 "
+              << all_ticks.times_ms.percentile(99) << ", max "
+              << all_ticks.times_ms.percentile(100) << std::endl
+              << "Allocations per tick: mean " << all_ticks.allocations.mean()
+              << ", p50 " << all_ticks.allocations.percentile(50) << ", p99 "
+              << all_ticks.allocations.percentile(99) << std::endl;
+
+    printTable("Play", play_measurements);
+    printTable("Tactic", tactic_measurements);
+
+    // A match runs many plays, so only one play means the AI didn't get the game state
+    // it had during the match and the measurements aren't representative
+    if (play_measurements.size() <= 1)
+    {
+        std::cerr << std::endl
+                  << "Only one play ran on the Worlds in " << args.replay_dir
+                  << ", check that they have game states" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
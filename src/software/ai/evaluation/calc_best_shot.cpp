@@ -1,99 +1,312 @@
 #include "software/ai/evaluation/calc_best_shot.h"
 
-std::optional<Shot> calcBestShotOnGoal(const Segment& goal_post, const Point& shot_origin,
-                                       const std::vector<Robot>& robot_obstacles,
-                                       TeamType goal, double radius)
+#include <algorithm>
+#include <array>
+
+namespace
 {
-    // Don't return a shot if the ball is behind the net
-    if ((goal == TeamType::FRIENDLY && shot_origin.x() < goal_post.getStart().x()) ||
-        (goal == TeamType::ENEMY && shot_origin.x() > goal_post.getStart().x()))
+    // The number of obstacles that can be evaluated without falling back to the heap.
+    // This comfortably covers every robot on the field in both divisions.
+    constexpr size_t MAX_INLINE_SHOT_OBSTACLES = 2 * MAX_ROBOT_IDS;
+
+    /**
+     * A buffer with inline storage for up to MAX_INLINE_SHOT_OBSTACLES elements, which
+     * only allocates if it is asked to hold more elements than that
+     *
+     * @tparam T The type of element to store
+     */
+    template <typename T>
+    class ShotObstacleBuffer
     {
-        return std::nullopt;
-    }
+       public:
+        /**
+         * Creates an empty buffer that can hold up to the given number of elements
+         *
+         * @param capacity The maximum number of elements this buffer will hold
+         */
+        explicit ShotObstacleBuffer(size_t capacity) : data_(inline_storage.data())
+        {
+            if (capacity > inline_storage.size())
+            {
+                heap_storage.resize(capacity);
+                data_ = heap_storage.data();
+            }
+        }
+
+        void push_back(const T& value)
+        {
+            data_[size_++] = value;
+        }
+
+        T* begin()
+        {
+            return data_;
+        }
 
-    size_t max_num_obstacles = robot_obstacles.size();
+        T* end()
+        {
+            return data_ + size_;
+        }
 
-    Angle pos_post_angle = (goal_post.getStart() - shot_origin).orientation();
-    Angle neg_post_angle = (goal_post.getEnd() - shot_origin).orientation();
+        const T* begin() const
+        {
+            return data_;
+        }
 
-    std::vector<AngleSegment> obstacles;
-    obstacles.reserve(max_num_obstacles);
+        const T* end() const
+        {
+            return data_ + size_;
+        }
 
-    if (goal == TeamType::FRIENDLY)
+        size_t size() const
+        {
+            return size_;
+        }
+
+       private:
+        std::array<T, MAX_INLINE_SHOT_OBSTACLES> inline_storage;
+        std::vector<T> heap_storage;
+        T* data_;
+        size_t size_ = 0;
+    };
+
+    /**
+     * The range of angles from the shot origin that is blocked by an obstacle
+     */
+    struct BlockedAngleRange
     {
-        auto tmp       = pos_post_angle;
-        pos_post_angle = (neg_post_angle + Angle::half()).clamp();
-        neg_post_angle = (tmp + Angle::half()).clamp();
-    }
-    AngleMap angle_map(pos_post_angle, neg_post_angle, max_num_obstacles);
+        Angle top;
+        Angle bottom;
+    };
 
-    for (const Robot& robot_obstacle : robot_obstacles)
+    /**
+     * Finds the best shot on the given goal with a single sorted sweep over the angle
+     * ranges blocked by the obstacles.
+     *
+     * The blocked ranges are sorted by their top angle (most positive first), so each
+     * range can only ever overlap the last merged range. This lets us find the biggest
+     * open range in the same pass as merging, without building an AngleMap.
+     *
+     * @param goal_post The goal post of the net by the y-coordinate
+     * @param shot_origin The point that the shot will be taken from
+     * @param obstacles The centres of the circular obstacles
+     * @param goal The goal to shoot at
+     * @param radius The radius for the obstacles
+     * @param should_ignore_obstacle Returns true if the given obstacle should not be
+     * considered for this shot
+     *
+     * @return the best shot on the goal, or std::nullopt if no shot is possible
+     */
+    template <typename ObstacleFilter>
+    std::optional<Shot> sweepBestShotOnGoal(const Segment& goal_post,
+                                            const Point& shot_origin,
+                                            const ShotObstacleBuffer<Point>& obstacles,
+                                            TeamType goal, double radius,
+                                            ObstacleFilter should_ignore_obstacle)
     {
-        Point enemy_robot_pos    = robot_obstacle.position();
-        Vector perpendicular_vec = (enemy_robot_pos - shot_origin).perpendicular();
+        // Don't return a shot if the ball is behind the net
+        if ((goal == TeamType::FRIENDLY &&
+             shot_origin.x() < goal_post.getStart().x()) ||
+            (goal == TeamType::ENEMY && shot_origin.x() > goal_post.getStart().x()))
+        {
+            return std::nullopt;
+        }
 
-        Vector one_end_vec = perpendicular_vec.normalize(radius);
+        Angle pos_post_angle = (goal_post.getStart() - shot_origin).orientation();
+        Angle neg_post_angle = (goal_post.getEnd() - shot_origin).orientation();
 
-        Point one_end   = enemy_robot_pos + one_end_vec;
-        Point other_end = enemy_robot_pos - one_end_vec;
+        if (goal == TeamType::FRIENDLY)
+        {
+            auto tmp       = pos_post_angle;
+            pos_post_angle = (neg_post_angle + Angle::half()).clamp();
+            neg_post_angle = (tmp + Angle::half()).clamp();
+        }
+
+        ShotObstacleBuffer<BlockedAngleRange> blocked_ranges(obstacles.size());
+        for (const Point& obstacle : obstacles)
+        {
+            if (should_ignore_obstacle(obstacle))
+            {
+                continue;
+            }
 
-        Vector top_vec    = one_end - shot_origin;
-        Vector bottom_vec = other_end - shot_origin;
+            Vector one_end_vec =
+                (obstacle - shot_origin).perpendicular().normalize(radius);
 
-        Angle top_angle    = top_vec.orientation();
-        Angle bottom_angle = bottom_vec.orientation();
-        if (goal == TeamType::FRIENDLY)
+            Vector top_vec    = (obstacle + one_end_vec) - shot_origin;
+            Vector bottom_vec = (obstacle - one_end_vec) - shot_origin;
+
+            Angle top_angle    = top_vec.orientation();
+            Angle bottom_angle = bottom_vec.orientation();
+            if (goal == TeamType::FRIENDLY)
+            {
+                top_angle    = (top_angle + Angle::half()).clamp();
+                bottom_angle = (bottom_angle + Angle::half()).clamp();
+            }
+
+            if (bottom_angle > pos_post_angle || top_angle < neg_post_angle)
+            {
+                continue;
+            }
+
+            blocked_ranges.push_back(BlockedAngleRange{top_angle, bottom_angle});
+        }
+
+        std::sort(blocked_ranges.begin(), blocked_ranges.end(),
+                  [](const BlockedAngleRange& a, const BlockedAngleRange& b)
+                  { return a.top > b.top; });
+
+        // Ties are resolved in favour of the top gap, then the bottom gap, then the
+        // first of the gaps between obstacles, to match the AngleMap this replaces
+        Angle best_top    = pos_post_angle;
+        Angle best_bottom = neg_post_angle;
+        if (blocked_ranges.size() > 0)
+        {
+            auto best_delta = [&]() { return (best_bottom - best_top).abs(); };
+
+            best_top    = Angle::zero();
+            best_bottom = Angle::zero();
+
+            const BlockedAngleRange* range = blocked_ranges.begin();
+            if (range->top < pos_post_angle)
+            {
+                best_top    = pos_post_angle;
+                best_bottom = range->top;
+            }
+
+            Angle merged_top            = range->top;
+            Angle merged_bottom         = range->bottom;
+            Angle best_inner_top        = Angle::zero();
+            Angle best_inner_bottom     = Angle::zero();
+            bool found_inner_open_range = false;
+            for (++range; range != blocked_ranges.end(); ++range)
+            {
+                if (!(range->bottom > merged_top || range->top < merged_bottom))
+                {
+                    merged_bottom = std::min(merged_bottom, range->bottom);
+                    continue;
+                }
+
+                if (!found_inner_open_range ||
+                    (range->top - merged_bottom).abs() >
+                        (best_inner_bottom - best_inner_top).abs())
+                {
+                    best_inner_top         = merged_bottom;
+                    best_inner_bottom      = range->top;
+                    found_inner_open_range = true;
+                }
+                merged_top    = range->top;
+                merged_bottom = range->bottom;
+            }
+
+            if (merged_bottom > neg_post_angle &&
+                (neg_post_angle - merged_bottom).abs() > best_delta())
+            {
+                best_top    = merged_bottom;
+                best_bottom = neg_post_angle;
+            }
+
+            if (found_inner_open_range &&
+                (best_inner_bottom - best_inner_top).abs() > best_delta())
+            {
+                best_top    = best_inner_top;
+                best_bottom = best_inner_bottom;
+            }
+        }
+
+        Angle open_angle = (best_bottom - best_top).abs();
+        if (open_angle.toDegrees() == 0)
         {
-            top_angle    = (top_vec.orientation() + Angle::half()).clamp();
-            bottom_angle = (bottom_vec.orientation() + Angle::half()).clamp();
+            return std::nullopt;
         }
 
-        if (bottom_angle > angle_map.getAngleSegment().getAngleTop() ||
-            top_angle < angle_map.getAngleSegment().getAngleBottom())
+        if (goal == TeamType::FRIENDLY)
         {
-            continue;
+            best_top    = (best_top + Angle::half()).clamp();
+            best_bottom = (best_bottom + Angle::half()).clamp();
         }
 
-        AngleSegment non_viable_angle_seg = AngleSegment(top_angle, bottom_angle);
-        obstacles.emplace_back(non_viable_angle_seg);
-    }
+        Point top_point =
+            Point(goal_post.getStart().x(),
+                  (best_top.sin() / best_top.cos()) *
+                          (goal_post.getStart().x() - shot_origin.x()) +
+                      shot_origin.y());
+        Point bottom_point =
+            Point(goal_post.getStart().x(),
+                  (best_bottom.sin() / best_bottom.cos()) *
+                          (goal_post.getStart().x() - shot_origin.x()) +
+                      shot_origin.y());
 
-    std::sort(obstacles.begin(), obstacles.end(),
-              [](AngleSegment& a, AngleSegment& b) -> bool { return a > b; });
+        Point shot_point = (top_point - bottom_point) / 2 + bottom_point;
 
-    for (AngleSegment& obstacle_angle_seg : obstacles)
-    {
-        angle_map.addNonViableAngleSegment(obstacle_angle_seg);
+        return std::make_optional(
+            Shot(shot_point, Angle::fromDegrees(open_angle.toDegrees())));
     }
 
-    AngleSegment biggest_angle_seg = angle_map.getBiggestViableAngleSegment();
-    if (biggest_angle_seg.getDeltaInDegrees() == 0)
+    /**
+     * Returns true if the given obstacle is on the far side of the shot origin from
+     * the goal, and so cannot block the shot
+     *
+     * @param obstacle The position of the obstacle
+     * @param shot_origin The point that the shot will be taken from
+     * @param goal The goal to shoot at
+     *
+     * @return true if the obstacle is behind the shot origin
+     */
+    bool isBehindShotOrigin(const Point& obstacle, const Point& shot_origin,
+                            TeamType goal)
     {
-        return std::nullopt;
+        if (goal == TeamType::ENEMY)
+        {
+            return obstacle.x() < shot_origin.x();
+        }
+        return obstacle.x() > shot_origin.x();
     }
 
-    Angle top_angle    = biggest_angle_seg.getAngleTop();
-    Angle bottom_angle = biggest_angle_seg.getAngleBottom();
-
-    if (goal == TeamType::FRIENDLY)
+    /**
+     * Returns true if the shot origin is outside of the goal lines of the field
+     *
+     * @param field The field
+     * @param shot_origin The point that the shot will be taken from
+     *
+     * @return true if the shot origin is outside of the goal lines
+     */
+    bool isOutsideGoalLines(const Field& field, const Point& shot_origin)
     {
-        top_angle    = (top_angle + Angle::half()).clamp();
-        bottom_angle = (bottom_angle + Angle::half()).clamp();
+        return shot_origin.x() < field.friendlyGoalCenter().x() ||
+               shot_origin.x() > field.enemyGoalCenter().x();
     }
 
-    Point top_point    = Point(goal_post.getStart().x(),
-                               (top_angle.sin() / top_angle.cos()) *
-                                       (goal_post.getStart().x() - shot_origin.x()) +
-                                   shot_origin.y());
-    Point bottom_point = Point(goal_post.getStart().x(),
-                               (bottom_angle.sin() / bottom_angle.cos()) *
-                                       (goal_post.getStart().x() - shot_origin.x()) +
-                                   shot_origin.y());
+    /**
+     * Returns the goal posts of the given goal
+     *
+     * @param field The field
+     * @param goal The goal to get the posts of
+     *
+     * @return the segment between the goal posts of the goal
+     */
+    Segment goalPostsFor(const Field& field, TeamType goal)
+    {
+        if (goal == TeamType::FRIENDLY)
+        {
+            return Segment(field.friendlyGoalpostPos(), field.friendlyGoalpostNeg());
+        }
+        return Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg());
+    }
+}  // namespace
 
-    Point shot_point = (top_point - bottom_point) / 2 + bottom_point;
+std::optional<Shot> calcBestShotOnGoal(const Segment& goal_post, const Point& shot_origin,
+                                       const std::vector<Robot>& robot_obstacles,
+                                       TeamType goal, double radius)
+{
+    ShotObstacleBuffer<Point> obstacles(robot_obstacles.size());
+    for (const Robot& robot : robot_obstacles)
+    {
+        obstacles.push_back(robot.position());
+    }
 
-    return std::make_optional(
-        Shot(shot_point, Angle::fromDegrees(biggest_angle_seg.getDeltaInDegrees())));
+    return sweepBestShotOnGoal(goal_post, shot_origin, obstacles, goal, radius,
+                               [](const Point&) { return false; });
 }
 
 std::optional<Shot> calcBestShotOnGoal(const Field& field, const Team& friendly_team,
@@ -102,55 +315,84 @@ std::optional<Shot> calcBestShotOnGoal(const Field& field, const Team& friendly_
                                        const std::vector<Robot>& robots_to_ignore,
                                        double radius)
 {
-    if (shot_origin.x() < field.friendlyGoalCenter().x() ||
-        shot_origin.x() > field.enemyGoalCenter().x())
+    if (isOutsideGoalLines(field, shot_origin))
     {
         return std::nullopt;
     }
 
-    std::vector<Robot> obstacles;
-    std::vector<Robot> all_robots;
-
-    size_t max_num_robots = enemy_team.numRobots() + friendly_team.numRobots();
-    all_robots.reserve(max_num_robots);
-    all_robots.insert(all_robots.begin(), enemy_team.getAllRobots().begin(),
-                      enemy_team.getAllRobots().end());
-    all_robots.insert(all_robots.begin(), friendly_team.getAllRobots().begin(),
-                      friendly_team.getAllRobots().end());
-
-    for (const Robot& robot : all_robots)
+    ShotObstacleBuffer<Point> obstacles(enemy_team.numRobots() +
+                                        friendly_team.numRobots());
+    for (const Team* team : {&enemy_team, &friendly_team})
     {
-        if (std::count(robots_to_ignore.begin(), robots_to_ignore.end(), robot) == 0)
+        for (const Robot& robot : team->getAllRobots())
         {
-            if (goal == TeamType::ENEMY)
+            if (!isBehindShotOrigin(robot.position(), shot_origin, goal) &&
+                std::find(robots_to_ignore.begin(), robots_to_ignore.end(), robot) ==
+                    robots_to_ignore.end())
             {
-                if (robot.position().x() < shot_origin.x())
-                {
-                    continue;
-                }
+                obstacles.push_back(robot.position());
             }
-            else
-            {
-                if (robot.position().x() > shot_origin.x())
-                {
-                    continue;
-                }
-            }
-
-            obstacles.emplace_back(robot);
         }
     }
 
-    if (goal == TeamType::FRIENDLY)
+    return sweepBestShotOnGoal(goalPostsFor(field, goal), shot_origin, obstacles, goal,
+                               radius, [](const Point&) { return false; });
+}
+
+std::vector<std::optional<Shot>> calcBestShotsOnGoal(
+    const Segment& goal_post, const std::vector<Point>& shot_origins,
+    const std::vector<Point>& obstacle_positions, TeamType goal, double radius)
+{
+    ShotObstacleBuffer<Point> obstacles(obstacle_positions.size());
+    for (const Point& obstacle : obstacle_positions)
+    {
+        obstacles.push_back(obstacle);
+    }
+
+    std::vector<std::optional<Shot>> shots;
+    shots.reserve(shot_origins.size());
+    for (const Point& shot_origin : shot_origins)
     {
-        return calcBestShotOnGoal(
-            Segment(field.friendlyGoalpostPos(), field.friendlyGoalpostNeg()),
-            shot_origin, obstacles, goal, radius);
+        shots.emplace_back(sweepBestShotOnGoal(
+            goal_post, shot_origin, obstacles, goal, radius,
+            [&shot_origin](const Point& obstacle) { return obstacle == shot_origin; }));
     }
-    else
+    return shots;
+}
+
+std::vector<std::optional<Shot>> calcBestShotsOnGoal(
+    const Field& field, const Team& friendly_team, const Team& enemy_team,
+    const std::vector<Point>& shot_origins, TeamType goal, double radius)
+{
+    ShotObstacleBuffer<Point> obstacles(enemy_team.numRobots() +
+                                        friendly_team.numRobots());
+    for (const Team* team : {&enemy_team, &friendly_team})
     {
-        return calcBestShotOnGoal(
-            Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg()), shot_origin,
-            obstacles, goal, radius);
+        for (const Robot& robot : team->getAllRobots())
+        {
+            obstacles.push_back(robot.position());
+        }
+    }
+
+    const Segment goal_post = goalPostsFor(field, goal);
+
+    std::vector<std::optional<Shot>> shots;
+    shots.reserve(shot_origins.size());
+    for (const Point& shot_origin : shot_origins)
+    {
+        if (isOutsideGoalLines(field, shot_origin))
+        {
+            shots.emplace_back(std::nullopt);
+            continue;
+        }
+
+        shots.emplace_back(sweepBestShotOnGoal(
+            goal_post, shot_origin, obstacles, goal, radius,
+            [&shot_origin, goal](const Point& obstacle)
+            {
+                return obstacle == shot_origin ||
+                       isBehindShotOrigin(obstacle, shot_origin, goal);
+            }));
     }
+    return shots;
 }
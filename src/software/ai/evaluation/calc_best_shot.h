@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+#include <vector>
+
 #include "shared/constants.h"
 #include "software/ai/evaluation/shot.h"
 #include "software/geom/angle_map.h"
@@ -58,3 +61,53 @@ std::optional<Shot> calcBestShotOnGoal(const Field& field, const Team& friendly_
                                        TeamType goal,
                                        const std::vector<Robot>& robots_to_ignore = {},
                                        double radius = ROBOT_MAX_RADIUS_METERS);
+
+/**
+ * Finds the best shot on the given goal from each of the given shot origins, treating
+ * the given obstacle positions as circular obstacles of the given radius.
+ *
+ * This gives the same result as calling calcBestShotOnGoal once per shot origin, but
+ * the obstacles are only gathered once and each shot origin is evaluated with a single
+ * sorted sweep over a fixed size buffer, so evaluating many shot origins against the
+ * same obstacles does not allocate per shot origin.
+ *
+ * Obstacles behind a shot origin (relative to the goal) and obstacles located exactly
+ * at a shot origin (i.e. the shooter itself) are ignored for that shot origin.
+ *
+ * @param goal_post The goal post of the net by the y-coordinate
+ * @param shot_origins The points that the shots will be taken from
+ * @param obstacle_positions The centres of the circular obstacles that may obstruct
+ * the shots
+ * @param goal The goal to shoot at
+ * @param radius The radius for the obstacles
+ *
+ * @return the best shot for each shot origin, in the same order as shot_origins. An
+ * entry is std::nullopt if no shot is possible from that shot origin
+ */
+std::vector<std::optional<Shot>> calcBestShotsOnGoal(
+    const Segment& goal_post, const std::vector<Point>& shot_origins,
+    const std::vector<Point>& obstacle_positions, TeamType goal,
+    double radius = ROBOT_MAX_RADIUS_METERS);
+
+/**
+ * Finds the best shot on the specified goal from each of the given shot origins,
+ * treating all robots on the field as obstacles.
+ *
+ * Robots located exactly at a shot origin are treated as the shooter and ignored for
+ * that shot origin, so this can be used to evaluate shots for every robot on a team
+ * in one call.
+ *
+ * @param field The field
+ * @param friendly_team The friendly team
+ * @param enemy_team The enemy team
+ * @param shot_origins The points that the shots will be taken from
+ * @param goal The goal to shoot at
+ * @param radius The radius for the robot obstacles
+ *
+ * @return the best shot for each shot origin, in the same order as shot_origins. An
+ * entry is std::nullopt if no shot can be found from that shot origin
+ */
+std::vector<std::optional<Shot>> calcBestShotsOnGoal(
+    const Field& field, const Team& friendly_team, const Team& enemy_team,
+    const std::vector<Point>& shot_origins, TeamType goal,
+    double radius = ROBOT_MAX_RADIUS_METERS);
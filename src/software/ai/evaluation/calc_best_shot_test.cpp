@@ -571,3 +571,111 @@ TEST(CalcBestShotTest, calc_best_shot_out_of_field_bounds)
     // We should not be able to find a shot
     ASSERT_FALSE(result);
 }
+
+TEST(CalcBestShotTest, calc_best_shots_on_enemy_goal_matches_individual_shots)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    ::TestUtil::setFriendlyRobotPositions(
+        world, {Point(1, -0.5), Point(2, 1), Point(-1, 0.3)}, Timestamp::fromSeconds(0));
+    ::TestUtil::setEnemyRobotPositions(
+        world, {world->field().enemyGoalCenter(), Point(2.5, 0.7), Point(3.5, -0.2)},
+        Timestamp::fromSeconds(0));
+
+    std::vector<Point> shot_origins;
+    for (const Robot& robot : world->friendlyTeam().getAllRobots())
+    {
+        shot_origins.emplace_back(robot.position());
+    }
+
+    auto results =
+        calcBestShotsOnGoal(world->field(), world->friendlyTeam(), world->enemyTeam(),
+                            shot_origins, TeamType::ENEMY);
+    ASSERT_EQ(shot_origins.size(), results.size());
+
+    for (size_t i = 0; i < shot_origins.size(); i++)
+    {
+        const Robot& shooting_robot = world->friendlyTeam().getAllRobots().at(i);
+        auto expected = calcBestShotOnGoal(world->field(), world->friendlyTeam(),
+                                           world->enemyTeam(), shooting_robot.position(),
+                                           TeamType::ENEMY, {shooting_robot});
+
+        ASSERT_EQ(expected.has_value(), results[i].has_value());
+        if (expected)
+        {
+            EXPECT_EQ(expected->getPointToShootAt(), results[i]->getPointToShootAt());
+            EXPECT_EQ(expected->getOpenAngle(), results[i]->getOpenAngle());
+        }
+    }
+}
+
+TEST(CalcBestShotTest, calc_best_shots_on_friendly_goal_matches_individual_shots)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    ::TestUtil::setFriendlyRobotPositions(
+        world,
+        {world->field().friendlyGoalCenter(), Point(-4.32821, 0.133333),
+         Point(-2.5, -0.7)},
+        Timestamp::fromSeconds(0));
+    ::TestUtil::setEnemyRobotPositions(
+        world, {Point(-3.44615, 0.0102564), Point(-1, 1.5), Point(0, -1)},
+        Timestamp::fromSeconds(0));
+
+    std::vector<Point> shot_origins;
+    for (const Robot& robot : world->enemyTeam().getAllRobots())
+    {
+        shot_origins.emplace_back(robot.position());
+    }
+
+    auto results =
+        calcBestShotsOnGoal(world->field(), world->friendlyTeam(), world->enemyTeam(),
+                            shot_origins, TeamType::FRIENDLY);
+    ASSERT_EQ(shot_origins.size(), results.size());
+
+    for (size_t i = 0; i < shot_origins.size(); i++)
+    {
+        const Robot& shooting_robot = world->enemyTeam().getAllRobots().at(i);
+        auto expected = calcBestShotOnGoal(world->field(), world->friendlyTeam(),
+                                           world->enemyTeam(), shooting_robot.position(),
+                                           TeamType::FRIENDLY, {shooting_robot});
+
+        ASSERT_EQ(expected.has_value(), results[i].has_value());
+        if (expected)
+        {
+            EXPECT_EQ(expected->getPointToShootAt(), results[i]->getPointToShootAt());
+            EXPECT_EQ(expected->getOpenAngle(), results[i]->getOpenAngle());
+        }
+    }
+}
+
+TEST(CalcBestShotTest, calc_best_shots_from_goal_post_segment_with_no_shot_origins)
+{
+    auto results = calcBestShotsOnGoal(Segment(Point(4.5, 0.5), Point(4.5, -0.5)), {},
+                                       {Point(3, 0)}, TeamType::ENEMY);
+    EXPECT_TRUE(results.empty());
+}
+
+TEST(CalcBestShotTest, calc_best_shots_from_goal_post_segment_ignores_shooter)
+{
+    Segment goal_post(Point(4.5, 0.5), Point(4.5, -0.5));
+    std::vector<Point> obstacles = {Point(1, 0), Point(3.5, 0.3), Point(3, -0.4)};
+
+    auto results =
+        calcBestShotsOnGoal(goal_post, {Point(1, 0), Point(5, 0)}, obstacles,
+                            TeamType::ENEMY);
+    ASSERT_EQ(2, results.size());
+
+    Robot obstacle_0 = Robot(1, obstacles[1], Vector(0, 0), Angle::zero(),
+                             AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Robot obstacle_1 = Robot(2, obstacles[2], Vector(0, 0), Angle::zero(),
+                             AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    auto expected = calcBestShotOnGoal(goal_post, Point(1, 0), {obstacle_0, obstacle_1},
+                                       TeamType::ENEMY);
+
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(results[0]);
+    EXPECT_EQ(expected->getPointToShootAt(), results[0]->getPointToShootAt());
+    EXPECT_EQ(expected->getOpenAngle(), results[0]->getOpenAngle());
+
+    // The second shot origin is behind the net
+    EXPECT_FALSE(results[1]);
+}
@@ -5,8 +5,10 @@
 #include "shared/constants.h"
 #include "software/ai/evaluation/calc_best_shot.h"
 #include "software/ai/evaluation/intercept.h"
+#include "software/ai/evaluation/pass_reachability_graph.h"
 #include "software/ai/evaluation/possession.h"
 #include "software/geom/algorithms/intersects.h"
+#include "software/util/memoize/memoized.hpp"
 #include "software/world/team.h"
 
 std::map<Robot, std::vector<Robot>, Robot::cmpRobotByID> findAllReceiverPasserPairs(
@@ -229,10 +231,35 @@ std::vector<EnemyThreat> getAllEnemyThreats(const Field& field, const Team& frie
         enemy_team.removeRobotWithId(*enemy_team.getGoalieId());
     }
 
+    std::vector<Point> enemy_robot_positions;
+    enemy_robot_positions.reserve(enemy_team.numRobots());
+    for (const auto& robot : enemy_team.getAllRobots())
+    {
+        enemy_robot_positions.emplace_back(robot.position());
+    }
+
+    // Evaluate the shots for every enemy robot against the same set of obstacles at once
+    auto best_shots = calcBestShotsOnGoal(field, friendly_team, enemy_team,
+                                          enemy_robot_positions, TeamType::FRIENDLY);
+
+    // The robot with possession and the passing routes between enemy robots are the
+    // same for every threat, so we only find the number of passes to each enemy robot
+    // once rather than repeating the search for every robot
+    std::vector<std::optional<PassReachabilityGraph::PassesToRobot>> passes_to_robots(
+        enemy_team.numRobots(), std::nullopt);
+    auto robot_with_effective_possession =
+        getRobotWithEffectiveBallPossession(enemy_team, ball, field);
+    if (robot_with_effective_possession)
+    {
+        passes_to_robots = PassReachabilityGraph(enemy_team).getNumPassesToAllRobots(
+            robot_with_effective_possession.value());
+    }
+
     std::vector<EnemyThreat> threats;
 
-    for (const auto& robot : enemy_team.getAllRobots())
+    for (size_t i = 0; i < enemy_team.numRobots(); i++)
     {
+        const Robot& robot = enemy_team.getAllRobots()[i];
         bool has_ball = robot.isNearDribbler(ball.position());
 
         // Get the angle from the robot to each friendly goalpost, then find the
@@ -245,9 +272,7 @@ std::vector<EnemyThreat> getAllEnemyThreats(const Field& field, const Team& frie
 
         std::optional<Angle> best_shot_angle  = std::nullopt;
         std::optional<Point> best_shot_target = std::nullopt;
-        auto best_shot_data =
-            calcBestShotOnGoal(field, friendly_team, enemy_team, robot.position(),
-                               TeamType::FRIENDLY, {robot});
+        const auto& best_shot_data = best_shots[i];
         if (best_shot_data)
         {
             best_shot_angle  = best_shot_data->getOpenAngle();
@@ -259,17 +284,10 @@ std::vector<EnemyThreat> getAllEnemyThreats(const Field& field, const Team& frie
         // passer to be an empty optional
         int num_passes              = static_cast<int>(enemy_team.numRobots());
         std::optional<Robot> passer = std::nullopt;
-        auto robot_with_effective_possession =
-            getRobotWithEffectiveBallPossession(enemy_team, ball, field);
-        if (robot_with_effective_possession)
+        if (passes_to_robots[i])
         {
-            auto pass_data = getNumPassesToRobot(robot_with_effective_possession.value(),
-                                                 robot, enemy_team, friendly_team);
-            if (pass_data)
-            {
-                num_passes = pass_data->first;
-                passer     = pass_data->second;
-            }
+            num_passes = passes_to_robots[i]->first;
+            passer     = passes_to_robots[i]->second;
         }
 
         EnemyThreat threat{robot,           has_ball,         goal_angle,
@@ -285,3 +303,18 @@ std::vector<EnemyThreat> getAllEnemyThreats(const Field& field, const Team& frie
 
     return threats;
 }
+
+std::vector<EnemyThreat> getAllEnemyThreats(const World& world, bool include_goalie)
+{
+    thread_local Memoized<std::vector<EnemyThreat>, uint64_t, uint64_t, uint64_t,
+                          uint64_t, bool>
+        memoized_threats;
+    return memoized_threats.get(
+        world.fieldGeneration(), world.friendlyTeamGeneration(),
+        world.enemyTeamGeneration(), world.ballGeneration(), include_goalie,
+        [&]()
+        {
+            return getAllEnemyThreats(world.field(), world.friendlyTeam(),
+                                      world.enemyTeam(), world.ball(), include_goalie);
+        });
+}
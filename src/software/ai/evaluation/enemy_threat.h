@@ -117,3 +117,17 @@ void sortThreatsInDecreasingOrder(std::vector<EnemyThreat>& threats);
 std::vector<EnemyThreat> getAllEnemyThreats(const Field& field, const Team& friendly_team,
                                             Team enemy_team, const Ball& ball,
                                             bool include_goalie);
+
+/**
+ * Calculates the threat of each enemy robot in the world, like the function above.
+ *
+ * The threats are only recalculated when the field, ball or either team in the world
+ * changed since the threats were last calculated on the same thread, so plays and
+ * tactics can all ask for the threats in the same tick without repeating the work.
+ *
+ * @param world The world to calculate the threats in
+ * @param include_goalie Whether or not to include the enemy goalie in the evaluation
+ * and resultant threats
+ * @return A list of EnemyThreats in order of decreasing threat
+ */
+std::vector<EnemyThreat> getAllEnemyThreats(const World& world, bool include_goalie);
@@ -554,3 +554,33 @@ TEST(EnemyThreatTest, three_enemies_vs_one_friendly)
     ASSERT_TRUE(threat_2.passer);
     EXPECT_EQ(threat_2.passer, enemy_robot_1);
 }
+
+TEST(EnemyThreatTest, threats_in_world_are_recalculated_when_the_enemy_team_changes)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    Robot enemy_robot_0 =
+        Robot(0, Point(world->field().friendlyGoalCenter()) + Vector(2, 0), Vector(0, 0),
+              Angle::half(), AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Team enemy_team = Team(Duration::fromSeconds(1));
+    enemy_team.updateRobots({enemy_robot_0});
+    world->updateEnemyTeamState(enemy_team);
+
+    auto result = getAllEnemyThreats(*world, false);
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result.at(0).robot, enemy_robot_0);
+    // Asking again for the same world gives the same threats
+    EXPECT_EQ(result.size(), getAllEnemyThreats(*world, false).size());
+
+    Robot enemy_robot_1 =
+        Robot(1, Point(world->field().friendlyGoalCenter()) + Vector(3, 1), Vector(0, 0),
+              Angle::half(), AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    enemy_team.updateRobots({enemy_robot_0, enemy_robot_1});
+    world->updateEnemyTeamState(enemy_team);
+
+    result = getAllEnemyThreats(*world, false);
+    EXPECT_EQ(result.size(), 2);
+    EXPECT_EQ(result.size(),
+              getAllEnemyThreats(world->field(), world->friendlyTeam(),
+                                 world->enemyTeam(), world->ball(), false)
+                  .size());
+}
@@ -1,8 +1,34 @@
 #include "software/ai/evaluation/find_open_areas.h"
 
+#include <algorithm>
+
 #include "proto/parameters.pb.h"
 #include "software/geom/algorithms/find_open_circles.h"
 
+namespace
+{
+    /**
+     * Gets the area to chip the ball to when no target area is given
+     *
+     * @param world The world. We assume the ball is being chipped from its current
+     * position
+     *
+     * @return a rectangle from the ball to the enemy's end of the field
+     */
+    Rectangle defaultChipTargetArea(const World& world)
+    {
+        double inset     = 0.3;  // Determined experimentally to be a reasonable value
+        double ballX     = world.ball().position().x();
+        double fieldX    = world.field().enemyGoalCenter().x() - inset;
+        double negFieldY = world.field().enemyCornerNeg().y() + inset;
+        double posFieldY = world.field().enemyCornerPos().y() - inset;
+
+        // A rectangle from the ball to the enemy's end of the field, inset by a small
+        // amount to give us enough space to catch the ball before it goes out of bounds
+        return Rectangle(Point(ballX, negFieldY), Point(fieldX, posFieldY));
+    }
+}  // namespace
+
 std::vector<Circle> findGoodChipTargets(const World& world, const Rectangle& target_area)
 {
     std::vector<Point> enemy_locations;
@@ -14,18 +40,41 @@ std::vector<Circle> findGoodChipTargets(const World& world, const Rectangle& tar
     return findOpenCircles(target_area, enemy_locations);
 }
 
+std::vector<Circle> findGoodChipTargets(const World& world, const Rectangle& target_area,
+                                        const TimeToReachMap& time_to_reach_map)
+{
+    std::vector<Circle> chip_targets = findGoodChipTargets(world, target_area);
+
+    // The nearest enemy isn't necessarily the first enemy to get to a chip target,
+    // since it could be moving away from it. Sample how much sooner we can get to each
+    // target instead. Targets that are equally good stay sorted by radius.
+    std::vector<std::pair<Duration, Circle>> chip_targets_with_advantage;
+    chip_targets_with_advantage.reserve(chip_targets.size());
+    for (const Circle& chip_target : chip_targets)
+    {
+        chip_targets_with_advantage.emplace_back(
+            time_to_reach_map.getFriendlyTimeAdvantage(chip_target.origin()),
+            chip_target);
+    }
+    std::stable_sort(chip_targets_with_advantage.begin(),
+                     chip_targets_with_advantage.end(),
+                     [](const auto& a, const auto& b)
+                     { return a.first.toSeconds() > b.first.toSeconds(); });
+
+    std::transform(chip_targets_with_advantage.begin(),
+                   chip_targets_with_advantage.end(), chip_targets.begin(),
+                   [](const auto& chip_target_with_advantage)
+                   { return chip_target_with_advantage.second; });
+    return chip_targets;
+}
+
 std::vector<Circle> findGoodChipTargets(const World& world)
 {
-    double inset     = 0.3;  // Determined experimentally to be a reasonable value
-    double ballX     = world.ball().position().x();
-    double fieldX    = world.field().enemyGoalCenter().x() - inset;
-    double negFieldY = world.field().enemyCornerNeg().y() + inset;
-    double posFieldY = world.field().enemyCornerPos().y() - inset;
-
-    // A rectangle from the ball to the enemy's end of the field, inset by a small amount
-    // to give us enough space to catch the ball before it goes out of bounds
-    Rectangle target_area_rectangle =
-        Rectangle(Point(ballX, negFieldY), Point(fieldX, posFieldY));
-
-    return findGoodChipTargets(world, target_area_rectangle);
+    return findGoodChipTargets(world, defaultChipTargetArea(world));
+}
+
+std::vector<Circle> findGoodChipTargets(const World& world,
+                                        const TimeToReachMap& time_to_reach_map)
+{
+    return findGoodChipTargets(world, defaultChipTargetArea(world), time_to_reach_map);
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "software/ai/evaluation/time_to_reach_map.h"
 #include "software/geom/circle.h"
 #include "software/world/world.h"
 
@@ -15,6 +16,23 @@
  */
 std::vector<Circle> findGoodChipTargets(const World& world, const Rectangle& target_area);
 
+/**
+ * Finds good points to chip the ball to within the specified target area, preferring
+ * points the friendly team can get to well before the enemy team
+ *
+ * @param world the world; we assume the ball is being chipped from its current
+ * position
+ * @param target_area the area on the field that chip targets should be restrained to
+ * @param time_to_reach_map the time to reach map for the current world
+ *
+ * @return a vector of circles where the center is a good point to chip to, and the
+ *         radius is the distance to the nearest enemy. The circles are sorted by how
+ *         much sooner the friendly team can reach their centers than the enemy team,
+ *         best first
+ */
+std::vector<Circle> findGoodChipTargets(const World& world, const Rectangle& target_area,
+                                        const TimeToReachMap& time_to_reach_map);
+
 /**
  * Finds good points to chip the ball to
  *
@@ -25,3 +43,18 @@ std::vector<Circle> findGoodChipTargets(const World& world, const Rectangle& tar
  *         radius is the distance to the nearest enemy
  */
 std::vector<Circle> findGoodChipTargets(const World& world);
+
+/**
+ * Finds good points to chip the ball to, preferring points the friendly team can get
+ * to well before the enemy team
+ *
+ * @param world The world. We assume the ball is being chipped from its current
+ * position
+ * @param time_to_reach_map the time to reach map for the current world
+ *
+ * @return a vector of circles where the center is a good point to chip to, and the
+ *         radius is the distance to the nearest enemy, sorted by how much sooner the
+ *         friendly team can reach their centers than the enemy team, best first
+ */
+std::vector<Circle> findGoodChipTargets(const World& world,
+                                        const TimeToReachMap& time_to_reach_map);
@@ -3,89 +3,213 @@
 #include "shared/constants.h"
 #include "software/ai/evaluation/time_to_travel.h"
 #include "software/geom/algorithms/contains.h"
-#include "software/optimization/gradient_descent_optimizer.hpp"
+#include "software/optimization/brent_root_finder.hpp"
 
-std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball& ball,
-                                                                   const Field& field,
-                                                                   const Robot& robot)
+namespace
 {
-    static const double gradient_approx_step_size = 0.000001;
+    // How far apart in time we sample the ball's path when looking for the first
+    // point the robot can reach in time
+    constexpr double BALL_PATH_SAMPLE_PERIOD_S = 0.05;
 
-    // We use this to take a smooth absolute value in our objective function
-    static const double smooth_abs_eps = 1000 * gradient_approx_step_size;
+    // How far into the future we look for an intercept
+    constexpr double MAX_INTERCEPT_SEARCH_TIME_S = 10.0;
 
-    // This is the objective function that we want to minimize, finding the
-    // shortest duration in the future at which we can feasibly intercept the
-    // ball
-    auto objective_function = [&](std::array<double, 1> x)
+    // How precisely we solve for the time the robot and ball arrive together
+    constexpr double INTERCEPT_TIME_TOLERANCE_S = 1e-4;
+
+    // The ball's predicted position at some time in the future
+    struct BallPathSample
     {
-        // We take the absolute value here because a negative time makes no sense
-        double duration = std::abs(x.at(0));
+        Point position;
+        bool on_field;
+    };
 
-        // If the ball timestamp is less then the robot timestamp, add the difference
-        // here so that we're optimizing to a duration that is after the robot
-        // timestamp
-        if (ball.timestamp() < robot.timestamp())
+    /**
+     * Predicts the ball's position at regular intervals, stopping once the ball has
+     * left the field since we never intercept outside of the field.
+     *
+     * Samples are only predicted when they are first asked for, and are then cached
+     * so that they can be shared between robots.
+     */
+    class BallPathSampler
+    {
+       public:
+        /**
+         * Creates a sampler for the path of the given ball
+         *
+         * @param ball The ball to predict the path of
+         * @param field The field the ball is on
+         */
+        explicit BallPathSampler(const Ball& ball, const Field& field)
+            : ball(ball), field(field), entered_field(false), path_ended(false)
         {
-            duration += (robot.timestamp() - ball.timestamp()).toSeconds();
         }
 
-        // Estimate the ball position
-        Point new_ball_pos =
-            ball.estimateFutureState(Duration::fromSeconds(duration)).position();
+        /**
+         * Gets the ball's position i * BALL_PATH_SAMPLE_PERIOD_S seconds after the
+         * ball's timestamp
+         *
+         * @param i The index of the sample
+         *
+         * @return The sample, or nullptr if the ball has left the field or we've gone
+         * past MAX_INTERCEPT_SEARCH_TIME_S by then
+         */
+        const BallPathSample* at(size_t i)
+        {
+            while (samples.size() <= i && !path_ended)
+            {
+                double time =
+                    static_cast<double>(samples.size()) * BALL_PATH_SAMPLE_PERIOD_S;
+                if (time > MAX_INTERCEPT_SEARCH_TIME_S)
+                {
+                    path_ended = true;
+                    break;
+                }
+
+                Point position =
+                    ball.estimateFutureState(Duration::fromSeconds(time)).position();
+                bool on_field = contains(field.fieldLines(), position);
 
-        // Figure out how long it will take the robot to get to the new ball position
-        Duration time_to_ball_pos = robot.getTimeToPosition(new_ball_pos);
+                // The ball can roll onto the field, but once it has left the field we
+                // can't intercept it anymore
+                if (entered_field && !on_field)
+                {
+                    path_ended = true;
+                    break;
+                }
+                entered_field |= on_field;
+                samples.emplace_back(BallPathSample{position, on_field});
+            }
 
-        // Figure out when the robot will reach the new ball position relative to the
-        // time that the ball will get there (ie. will we get there in time?)
-        double ball_robot_time_diff = duration - time_to_ball_pos.toSeconds();
+            return i < samples.size() ? &samples[i] : nullptr;
+        }
 
-        // We want to get to the ball at the earliest opportunity possible, so
-        // aim for a time diff of zero. We use a smooth approximation of
-        // the maximum here
-        return std::sqrt(std::pow(ball_robot_time_diff, 2) + smooth_abs_eps);
+       private:
+        const Ball& ball;
+        const Field& field;
+        std::vector<BallPathSample> samples;
+        bool entered_field;
+        bool path_ended;
     };
 
-    // Figure out when/where to intercept the ball. We do this by optimizing over
-    // the ball position as a function of it's travel time
-    // We make the weight here an inverse of the ball speed, so that the gradient
-    // descent takes smaller steps when the ball is moving faster
-    double descent_weight = 1 / (std::exp(ball.currentState().velocity().length() * 0.5));
-    GradientDescentOptimizer<1> optimizer({descent_weight}, gradient_approx_step_size);
-    Duration best_ball_travel_duration = Duration::fromSeconds(
-        std::abs(optimizer.minimize(objective_function, {0}, 50).at(0)));
-
-    // In the objective function above, if the robot timestamp > ball timestamp, we
-    // add on the difference so we get a intercept time after the robot timestamp, so
-    // we need to do the same here to get the duration we actually optimized on
-    if (robot.timestamp() > ball.timestamp())
+    /**
+     * Finds the best place for the given robot to intercept the ball, given the
+     * ball's predicted path
+     *
+     * @param ball The ball to intercept
+     * @param field The field on which we want the intercept to occur
+     * @param robot The robot that will hopefully intercept the ball
+     * @param ball_path The ball's predicted path
+     *
+     * @return The best intercept, as described by findBestInterceptForBall
+     */
+    std::optional<std::pair<Point, Duration>> findBestInterceptAlongBallPath(
+        const Ball& ball, const Field& field, const Robot& robot,
+        BallPathSampler& ball_path)
     {
-        best_ball_travel_duration =
-            best_ball_travel_duration + (robot.timestamp() - ball.timestamp());
-    }
+        auto intercept_at = [&](const Point& intercept_position)
+            -> std::optional<std::pair<Point, Duration>>
+        {
+            // Check that the intercept position is actually on the field
+            if (!contains(field.fieldLines(), intercept_position))
+            {
+                return std::nullopt;
+            }
+            return std::make_pair(intercept_position,
+                                  robot.getTimeToPosition(intercept_position));
+        };
 
-    Point best_ball_intercept_pos =
-        ball.estimateFutureState(best_ball_travel_duration).position();
+        // If the ball isn't moving the robot can intercept it wherever it is, as soon
+        // as the robot gets there
+        if (ball.velocity().length() == 0 && ball.acceleration().length() == 0)
+        {
+            return intercept_at(ball.position());
+        }
 
-    // Check that we can get to the best position in time
-    Duration time_to_ball_pos     = robot.getTimeToPosition(best_ball_intercept_pos);
-    Duration ball_robot_time_diff = time_to_ball_pos - best_ball_travel_duration;
-    // NOTE: if ball velocity is 0 then ball travel duration is infinite, so this
-    // check isn't relevant in that case
-    if (ball.currentState().velocity().length() != 0 &&
-        std::abs(ball_robot_time_diff.toSeconds()) > descent_weight)
-    {
+        // All times here are relative to the ball timestamp. If the robot timestamp is
+        // later than the ball timestamp, the robot can't intercept the ball before then
+        double start_time = 0;
+        if (ball.timestamp() < robot.timestamp())
+        {
+            start_time = (robot.timestamp() - ball.timestamp()).toSeconds();
+        }
+
+        // How much earlier the robot can get to where the ball will be at the given
+        // time than the ball. The best intercept is the earliest root of this function
+        auto time_to_spare = [&](double time)
+        {
+            Point ball_position =
+                ball.estimateFutureState(Duration::fromSeconds(time)).position();
+            return time - robot.getTimeToPosition(ball_position).toSeconds();
+        };
+
+        Point start_position =
+            ball.estimateFutureState(Duration::fromSeconds(start_time)).position();
+        if (time_to_spare(start_time) >= 0 &&
+            contains(field.fieldLines(), start_position))
+        {
+            return intercept_at(start_position);
+        }
+
+        // Step along the ball's path until the robot can get there in time, then solve
+        // for exactly when the robot and ball get there at the same time
+        const size_t first_sample_after_start =
+            static_cast<size_t>(std::floor(start_time / BALL_PATH_SAMPLE_PERIOD_S)) + 1;
+
+        double prev_time = start_time;
+        for (size_t i = first_sample_after_start; ball_path.at(i) != nullptr; i++)
+        {
+            const BallPathSample& sample = *ball_path.at(i);
+
+            double time = static_cast<double>(i) * BALL_PATH_SAMPLE_PERIOD_S;
+            if (sample.on_field &&
+                time - robot.getTimeToPosition(sample.position).toSeconds() >= 0)
+            {
+                double intercept_time =
+                    findRootWithBrentsMethod(time_to_spare, prev_time, time,
+                                             INTERCEPT_TIME_TOLERANCE_S)
+                        .value_or(time);
+                Point intercept_position =
+                    ball.estimateFutureState(Duration::fromSeconds(intercept_time))
+                        .position();
+
+                // The ball may have only just come onto the field, in which case we
+                // intercept it where it first comes onto the field
+                if (!contains(field.fieldLines(), intercept_position))
+                {
+                    intercept_position = sample.position;
+                }
+                return intercept_at(intercept_position);
+            }
+            prev_time = time;
+        }
+
+        // The ball leaves the field before the robot can catch up to it
         return std::nullopt;
     }
+}  // namespace
 
-    // Check that the best intercept position is actually on the field
-    if (!contains(field.fieldLines(), best_ball_intercept_pos))
+std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball& ball,
+                                                                   const Field& field,
+                                                                   const Robot& robot)
+{
+    BallPathSampler ball_path(ball, field);
+    return findBestInterceptAlongBallPath(ball, field, robot, ball_path);
+}
+
+std::vector<std::optional<std::pair<Point, Duration>>> findBestInterceptsForBall(
+    const Ball& ball, const Field& field, const std::vector<Robot>& robots)
+{
+    BallPathSampler ball_path(ball, field);
+
+    std::vector<std::optional<std::pair<Point, Duration>>> intercepts;
+    intercepts.reserve(robots.size());
+    for (const Robot& robot : robots)
     {
-        return std::nullopt;
+        intercepts.emplace_back(
+            findBestInterceptAlongBallPath(ball, field, robot, ball_path));
     }
-
-    return std::make_pair(best_ball_intercept_pos, time_to_ball_pos);
+    return intercepts;
 }
 
 Point findOvershootInterceptPosition(const Robot& robot, const Point intercept_position,
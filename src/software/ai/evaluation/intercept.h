@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "software/geom/point.h"
 #include "software/world/ball.h"
@@ -10,6 +11,11 @@
 /**
  * Finds the best place for the given robot to intercept the given ball
  *
+ * The best intercept is the earliest point along the ball's path that the robot can
+ * reach before the ball does. This is found by stepping along the ball's path until
+ * the robot can get there in time, then solving for the exact time the robot and ball
+ * arrive together with Brent's method.
+ *
  * @param ball The ball to intercept
  * @param field The field on which we want the intercept to occur
  * @param robot The robot that will hopefully intercept the ball
@@ -23,6 +29,22 @@ std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball& b
                                                                    const Field& field,
                                                                    const Robot& robot);
 
+/**
+ * Finds the best place for each of the given robots to intercept the given ball
+ *
+ * This gives the same result as calling findBestInterceptForBall for each robot, but
+ * the ball's path is only predicted once and shared between all robots.
+ *
+ * @param ball The ball to intercept
+ * @param field The field on which we want the intercepts to occur
+ * @param robots The robots that will hopefully intercept the ball
+ *
+ * @return The best intercept for each robot, in the same order as the given robots.
+ * See findBestInterceptForBall for the details of each intercept
+ */
+std::vector<std::optional<std::pair<Point, Duration>>> findBestInterceptsForBall(
+    const Ball& ball, const Field& field, const std::vector<Robot>& robots);
+
 
 /**
  * Attempts to find a reachable overshoot destination for intercepting the ball,
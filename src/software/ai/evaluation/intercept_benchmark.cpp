@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include "software/ai/evaluation/intercept.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/optimization/gradient_descent_optimizer.hpp"
+
+namespace
+{
+    /**
+     * The gradient descent intercept that findBestInterceptForBall used before it
+     * was replaced by a root finder, kept here as a baseline to compare against
+     */
+    std::optional<std::pair<Point, Duration>> findBestInterceptWithGradientDescent(
+        const Ball& ball, const Field& field, const Robot& robot)
+    {
+        static const double gradient_approx_step_size = 0.000001;
+        static const double smooth_abs_eps            = 1000 * gradient_approx_step_size;
+
+        auto objective_function = [&](std::array<double, 1> x)
+        {
+            double duration = std::abs(x.at(0));
+            if (ball.timestamp() < robot.timestamp())
+            {
+                duration += (robot.timestamp() - ball.timestamp()).toSeconds();
+            }
+            Point new_ball_pos =
+                ball.estimateFutureState(Duration::fromSeconds(duration)).position();
+            Duration time_to_ball_pos   = robot.getTimeToPosition(new_ball_pos);
+            double ball_robot_time_diff = duration - time_to_ball_pos.toSeconds();
+            return std::sqrt(std::pow(ball_robot_time_diff, 2) + smooth_abs_eps);
+        };
+
+        double descent_weight =
+            1 / (std::exp(ball.currentState().velocity().length() * 0.5));
+        GradientDescentOptimizer<1> optimizer({descent_weight},
+                                              gradient_approx_step_size);
+        Duration best_ball_travel_duration = Duration::fromSeconds(
+            std::abs(optimizer.minimize(objective_function, {0}, 50).at(0)));
+        if (robot.timestamp() > ball.timestamp())
+        {
+            best_ball_travel_duration =
+                best_ball_travel_duration + (robot.timestamp() - ball.timestamp());
+        }
+
+        Point best_ball_intercept_pos =
+            ball.estimateFutureState(best_ball_travel_duration).position();
+        Duration time_to_ball_pos     = robot.getTimeToPosition(best_ball_intercept_pos);
+        Duration ball_robot_time_diff = time_to_ball_pos - best_ball_travel_duration;
+        if (ball.currentState().velocity().length() != 0 &&
+            std::abs(ball_robot_time_diff.toSeconds()) > descent_weight)
+        {
+            return std::nullopt;
+        }
+        if (!contains(field.fieldLines(), best_ball_intercept_pos))
+        {
+            return std::nullopt;
+        }
+        return std::make_pair(best_ball_intercept_pos, time_to_ball_pos);
+    }
+
+    /**
+     * Creates a full division A team spread across the field
+     *
+     * @return the robots on the team
+     */
+    std::vector<Robot> createTeam()
+    {
+        std::vector<Robot> robots;
+        for (unsigned int id = 0; id < DIV_A_NUM_ROBOTS; id++)
+        {
+            double x = -5.0 + static_cast<double>(id);
+            double y = id % 2 == 0 ? 1.5 : -1.5;
+            robots.emplace_back(id, Point(x, y), Vector(0.5, 0), Angle::zero(),
+                                AngularVelocity::zero(), Timestamp::fromSeconds(0));
+        }
+        return robots;
+    }
+
+    const Field FIELD = Field::createSSLDivisionAField();
+    const Ball BALL   = Ball(Point(-1, 0.5), Vector(3, -0.5), Timestamp::fromSeconds(0));
+}  // namespace
+
+static void BM_findBestInterceptWithGradientDescent(benchmark::State& state)
+{
+    const std::vector<Robot> robots = createTeam();
+    for (auto _ : state)
+    {
+        for (const Robot& robot : robots)
+        {
+            benchmark::DoNotOptimize(
+                findBestInterceptWithGradientDescent(BALL, FIELD, robot));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(robots.size()));
+}
+BENCHMARK(BM_findBestInterceptWithGradientDescent);
+
+static void BM_findBestInterceptForBall(benchmark::State& state)
+{
+    const std::vector<Robot> robots = createTeam();
+    for (auto _ : state)
+    {
+        for (const Robot& robot : robots)
+        {
+            benchmark::DoNotOptimize(findBestInterceptForBall(BALL, FIELD, robot));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(robots.size()));
+}
+BENCHMARK(BM_findBestInterceptForBall);
+
+static void BM_findBestInterceptsForBall(benchmark::State& state)
+{
+    const std::vector<Robot> robots = createTeam();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(findBestInterceptsForBall(BALL, FIELD, robots));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(robots.size()));
+}
+BENCHMARK(BM_findBestInterceptsForBall);
@@ -256,3 +256,62 @@ TEST(InterceptEvaluationTest, findBestInterceptForBall_ball_moving_too_fast_to_i
     auto best_intercept = findBestInterceptForBall(ball, field, robot);
     ASSERT_FALSE(best_intercept);
 }
+
+TEST(InterceptEvaluationTest, findBestInterceptForBall_ball_entering_field)
+{
+    // Test where the ball starts outside the field and rolls onto it
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({-2, 4}, {0, -2}, Timestamp::fromSeconds(0));
+    Robot robot(0, {-2, 0}, {0, 0}, Angle::quarter(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+
+    // We should be able to find an intercept
+    auto best_intercept = findBestInterceptForBall(ball, field, robot);
+    ASSERT_TRUE(best_intercept);
+
+    // The intercept must be on the field, somewhere between where the ball enters the
+    // field and where the robot is
+    auto [intercept_pos, robot_time_to_move_to_intercept] = *best_intercept;
+    EXPECT_NEAR(-2, intercept_pos.x(), 1e-9);
+    EXPECT_LE(0, intercept_pos.y());
+    EXPECT_GE(field.fieldLines().yMax(), intercept_pos.y());
+    EXPECT_LE(0, robot_time_to_move_to_intercept.toSeconds());
+}
+
+TEST(InterceptEvaluationTest, findBestInterceptsForBall_matches_individual_intercepts)
+{
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({-1, 0.5}, {2, -0.5}, Timestamp::fromSeconds(0));
+    std::vector<Robot> robots = {
+        Robot(0, {2, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(1, {0, -1}, {1, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0.5)),
+        Robot(2, {-3, 0.5}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(3, {-4, -2.5}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+    };
+
+    auto intercepts = findBestInterceptsForBall(ball, field, robots);
+    ASSERT_EQ(robots.size(), intercepts.size());
+
+    for (size_t i = 0; i < robots.size(); i++)
+    {
+        auto expected = findBestInterceptForBall(ball, field, robots[i]);
+        ASSERT_EQ(expected.has_value(), intercepts[i].has_value());
+        if (expected)
+        {
+            EXPECT_EQ(expected->first, intercepts[i]->first);
+            EXPECT_EQ(expected->second, intercepts[i]->second);
+        }
+    }
+}
+
+TEST(InterceptEvaluationTest, findBestInterceptsForBall_no_robots)
+{
+    Field field = Field::createSSLDivisionBField();
+    Ball ball({0, 0}, {1, 0}, Timestamp::fromSeconds(0));
+
+    EXPECT_TRUE(findBestInterceptsForBall(ball, field, {}).empty());
+}
@@ -0,0 +1,155 @@
+#include "software/ai/evaluation/pass_reachability_graph.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "shared/constants.h"
+#include "software/geom/algorithms/intersects.h"
+
+PassReachabilityGraph::PassReachabilityGraph(const Team& passing_team)
+    : robots(passing_team.getAllRobots()),
+      indices_by_id(robots.size()),
+      adjacency(robots.size())
+{
+    if (robots.size() > MAX_NUM_ROBOTS)
+    {
+        throw std::invalid_argument(
+            "PassReachabilityGraph cannot hold more than " +
+            std::to_string(MAX_NUM_ROBOTS) + " robots, but the team has " +
+            std::to_string(robots.size()));
+    }
+
+    std::iota(indices_by_id.begin(), indices_by_id.end(), 0);
+    std::sort(indices_by_id.begin(), indices_by_id.end(),
+              [this](size_t a, size_t b) { return robots[a].id() < robots[b].id(); });
+
+    // A pass is blocked by the same robots in either direction, so we only need to
+    // check each pair of robots once
+    for (size_t i = 0; i < robots.size(); i++)
+    {
+        for (size_t j = i + 1; j < robots.size(); j++)
+        {
+            Segment pass(robots[i].position(), robots[j].position());
+
+            bool pass_blocked = false;
+            for (size_t k = 0; k < robots.size() && !pass_blocked; k++)
+            {
+                pass_blocked =
+                    k != i && k != j &&
+                    intersects(Circle(robots[k].position(), ROBOT_MAX_RADIUS_METERS),
+                               pass);
+            }
+
+            adjacency[i][j] = !pass_blocked;
+            adjacency[j][i] = !pass_blocked;
+        }
+    }
+}
+
+bool PassReachabilityGraph::canPass(const Robot& passer, const Robot& receiver) const
+{
+    auto passer_index   = indexOf(passer);
+    auto receiver_index = indexOf(receiver);
+    if (!passer_index || !receiver_index)
+    {
+        return false;
+    }
+    return adjacency[*passer_index][*receiver_index];
+}
+
+std::vector<std::optional<PassReachabilityGraph::PassesToRobot>>
+PassReachabilityGraph::getNumPassesToAllRobots(const Robot& initial_passer) const
+{
+    std::vector<std::optional<PassesToRobot>> passes_to_robots(robots.size(),
+                                                               std::nullopt);
+
+    auto initial_passer_index = indexOf(initial_passer);
+    if (!initial_passer_index)
+    {
+        return passes_to_robots;
+    }
+
+    passes_to_robots[*initial_passer_index] = std::make_pair(0, std::nullopt);
+
+    // Breadth first search outwards from the initial passer. Every robot that can be
+    // passed to from the current frontier is reached in one more pass than the
+    // frontier, and becomes part of the next frontier
+    RobotSet visited;
+    visited.set(*initial_passer_index);
+    RobotSet frontier = visited;
+
+    for (int pass_num = 1; frontier.any(); pass_num++)
+    {
+        RobotSet next_frontier;
+        for (size_t i = 0; i < robots.size(); i++)
+        {
+            if (frontier[i])
+            {
+                next_frontier |= adjacency[i];
+            }
+        }
+        next_frontier &= ~visited;
+
+        for (size_t receiver = 0; receiver < robots.size(); receiver++)
+        {
+            if (!next_frontier[receiver])
+            {
+                continue;
+            }
+
+            // If there are multiple robots that can pass to the robot, we assume it
+            // will receive the ball from the closest one since this is more likely
+            const Point& receiver_position = robots[receiver].position();
+            std::optional<size_t> closest_passer;
+            for (size_t passer : indices_by_id)
+            {
+                if (frontier[passer] && adjacency[passer][receiver] &&
+                    (!closest_passer ||
+                     (receiver_position - robots[passer].position()).length() <
+                         (robots[*closest_passer].position() - receiver_position)
+                             .length()))
+                {
+                    closest_passer = passer;
+                }
+            }
+
+            passes_to_robots[receiver] =
+                std::make_pair(pass_num, robots[closest_passer.value()]);
+        }
+
+        visited |= next_frontier;
+        frontier = next_frontier;
+    }
+
+    return passes_to_robots;
+}
+
+std::optional<PassReachabilityGraph::PassesToRobot>
+PassReachabilityGraph::getNumPassesToRobot(const Robot& initial_passer,
+                                           const Robot& final_receiver) const
+{
+    if (initial_passer == final_receiver)
+    {
+        return std::make_pair(0, std::nullopt);
+    }
+
+    auto final_receiver_index = indexOf(final_receiver);
+    if (!final_receiver_index)
+    {
+        return std::nullopt;
+    }
+    return getNumPassesToAllRobots(initial_passer)[*final_receiver_index];
+}
+
+std::optional<size_t> PassReachabilityGraph::indexOf(const Robot& robot) const
+{
+    for (size_t i = 0; i < robots.size(); i++)
+    {
+        if (robots[i].id() == robot.id())
+        {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <bitset>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "software/world/team.h"
+
+/**
+ * A graph of which robots on a team can pass the ball directly to each other, without
+ * the pass being blocked by another robot on the same team.
+ *
+ * The graph is built once from a snapshot of the team, and is stored as an adjacency
+ * bitset per robot. This lets the minimum number of passes from one robot to every
+ * other robot on the team be found with a single breadth first search, rather than
+ * repeating the search (and the pass blocking checks) for every receiver.
+ *
+ * Robots are identified by their ID, and passes are only blocked by robots on the same
+ * team, matching getNumPassesToRobot.
+ */
+class PassReachabilityGraph
+{
+   public:
+    // The maximum number of robots the graph can hold
+    static constexpr size_t MAX_NUM_ROBOTS = 64;
+
+    // The number of passes it takes to reach a robot, and the robot the final pass
+    // would most likely come from
+    using PassesToRobot = std::pair<int, std::optional<Robot>>;
+
+    PassReachabilityGraph() = delete;
+
+    /**
+     * Creates the pass reachability graph for the given team
+     *
+     * @param passing_team The team passing the ball between its robots
+     *
+     * @throws std::invalid_argument if the team has more than MAX_NUM_ROBOTS robots
+     */
+    explicit PassReachabilityGraph(const Team& passing_team);
+
+    /**
+     * Returns whether the passer can pass directly to the receiver without any other
+     * robot on the team blocking the pass
+     *
+     * @param passer The robot passing the ball
+     * @param receiver The robot receiving the ball
+     *
+     * @return true if the pass is not blocked, and false if it is blocked or either
+     * robot is not part of this graph
+     */
+    bool canPass(const Robot& passer, const Robot& receiver) const;
+
+    /**
+     * Returns how many passes it would take for the given passer to pass the ball to
+     * every robot on the team, and the intermediate passer each robot is most likely
+     * to receive the ball from.
+     *
+     * The results match calling getNumPassesToRobot for each robot on the team.
+     *
+     * @param initial_passer The robot the passes start from
+     *
+     * @return the number of passes and intermediate passer for each robot, in the same
+     * order as the robots in the team this graph was created from. An entry is
+     * std::nullopt if the robot cannot be passed to. All entries are std::nullopt if
+     * the initial passer is not part of this graph
+     */
+    std::vector<std::optional<PassesToRobot>> getNumPassesToAllRobots(
+        const Robot& initial_passer) const;
+
+    /**
+     * Returns how many passes it would take for the given passer to pass the ball to
+     * the receiver, and the intermediate passer the receiver is most likely to
+     * receive the ball from.
+     *
+     * @param initial_passer The robot the passes start from
+     * @param final_receiver The robot trying to be passed to
+     *
+     * @return the same result as getNumPassesToRobot
+     */
+    std::optional<PassesToRobot> getNumPassesToRobot(const Robot& initial_passer,
+                                                     const Robot& final_receiver) const;
+
+   private:
+    using RobotSet = std::bitset<MAX_NUM_ROBOTS>;
+
+    /**
+     * Returns the index of the robot with the same ID as the given robot
+     *
+     * @param robot The robot to find
+     *
+     * @return the index of the robot in this graph, or std::nullopt if it is not part
+     * of this graph
+     */
+    std::optional<size_t> indexOf(const Robot& robot) const;
+
+    std::vector<Robot> robots;
+    // The indices of the robots, sorted by robot ID. Candidate passers are considered
+    // in this order so ties are broken the same way as getNumPassesToRobot
+    std::vector<size_t> indices_by_id;
+    // Bit j of adjacency[i] is set if robot i can pass directly to robot j
+    std::vector<RobotSet> adjacency;
+};
@@ -0,0 +1,136 @@
+#include "software/ai/evaluation/pass_reachability_graph.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/ai/evaluation/enemy_threat.h"
+#include "software/test_util/test_util.h"
+
+class PassReachabilityGraphTest : public ::testing::Test
+{
+   protected:
+    Robot createRobot(RobotId id, const Point& position)
+    {
+        return Robot(id, position, Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+                     Timestamp::fromSeconds(0));
+    }
+};
+
+TEST_F(PassReachabilityGraphTest, robot_passing_to_itself)
+{
+    Robot robot_0 = createRobot(0, Point(0, 0));
+    Team team(Duration::fromSeconds(1));
+    team.updateRobots({robot_0});
+
+    PassReachabilityGraph graph(team);
+    auto result = graph.getNumPassesToRobot(robot_0, robot_0);
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(0, result->first);
+    EXPECT_FALSE(result->second);
+}
+
+TEST_F(PassReachabilityGraphTest, pass_blocked_by_robot_in_between)
+{
+    Robot robot_0 = createRobot(0, Point(0, 0));
+    Robot robot_1 = createRobot(1, Point(2, 0));
+    Robot robot_2 = createRobot(2, Point(4, 0));
+    Team team(Duration::fromSeconds(1));
+    team.updateRobots({robot_0, robot_1, robot_2});
+
+    PassReachabilityGraph graph(team);
+
+    EXPECT_TRUE(graph.canPass(robot_0, robot_1));
+    EXPECT_TRUE(graph.canPass(robot_1, robot_2));
+    EXPECT_FALSE(graph.canPass(robot_0, robot_2));
+    EXPECT_FALSE(graph.canPass(robot_2, robot_0));
+
+    auto result = graph.getNumPassesToRobot(robot_0, robot_2);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(2, result->first);
+    EXPECT_EQ(robot_1, result->second);
+}
+
+TEST_F(PassReachabilityGraphTest, robot_not_on_team_cannot_be_passed_to)
+{
+    Robot robot_0 = createRobot(0, Point(0, 0));
+    Robot robot_1 = createRobot(1, Point(2, 0));
+    Team team(Duration::fromSeconds(1));
+    team.updateRobots({robot_0});
+
+    PassReachabilityGraph graph(team);
+
+    EXPECT_FALSE(graph.canPass(robot_0, robot_1));
+    EXPECT_FALSE(graph.getNumPassesToRobot(robot_0, robot_1));
+}
+
+TEST_F(PassReachabilityGraphTest, multiple_passers_picks_closest_passer)
+{
+    Robot robot_0 = createRobot(0, Point(0, 0));
+    Robot robot_1 = createRobot(1, Point(1, 1));
+    Robot robot_2 = createRobot(2, Point(1, -2));
+    Robot robot_3 = createRobot(3, Point(2, 0));
+    // Blocks the direct pass from robot 0 to robot 3
+    Robot robot_4 = createRobot(4, Point(1, 0));
+    Team team(Duration::fromSeconds(1));
+    team.updateRobots({robot_0, robot_1, robot_2, robot_3, robot_4});
+
+    PassReachabilityGraph graph(team);
+    auto result = graph.getNumPassesToRobot(robot_0, robot_3);
+
+    // Robots 1, 2 and 4 can all pass to robot 3, but robot 4 is the closest
+    ASSERT_TRUE(result);
+    EXPECT_EQ(2, result->first);
+    EXPECT_EQ(robot_4, result->second);
+}
+
+TEST_F(PassReachabilityGraphTest,
+       num_passes_to_all_robots_matches_get_num_passes_to_robot_for_random_teams)
+{
+    std::mt19937 random_engine(42);
+    std::uniform_real_distribution<double> x_distribution(-4.5, 4.5);
+    // Robots spread over a thin strip block each other's passes far more often, so we
+    // also get routes that take several passes
+    std::uniform_real_distribution<double> wide_y_distribution(-3, 3);
+    std::uniform_real_distribution<double> narrow_y_distribution(-0.2, 0.2);
+    std::uniform_int_distribution<unsigned int> num_robots_distribution(
+        1, DIV_A_NUM_ROBOTS);
+
+    for (int trial = 0; trial < 200; trial++)
+    {
+        auto& y_distribution =
+            trial % 2 == 0 ? wide_y_distribution : narrow_y_distribution;
+
+        std::vector<Robot> robots;
+        unsigned int num_robots = num_robots_distribution(random_engine);
+        for (unsigned int id = 0; id < num_robots; id++)
+        {
+            robots.emplace_back(createRobot(
+                id, Point(x_distribution(random_engine), y_distribution(random_engine))));
+        }
+        std::shuffle(robots.begin(), robots.end(), random_engine);
+
+        Team passing_team(Duration::fromSeconds(1));
+        passing_team.updateRobots(robots);
+        Team other_team(Duration::fromSeconds(1));
+
+        PassReachabilityGraph graph(passing_team);
+        for (const Robot& initial_passer : passing_team.getAllRobots())
+        {
+            auto results = graph.getNumPassesToAllRobots(initial_passer);
+            ASSERT_EQ(passing_team.numRobots(), results.size());
+
+            for (size_t i = 0; i < passing_team.numRobots(); i++)
+            {
+                const Robot& final_receiver = passing_team.getAllRobots()[i];
+                auto expected = getNumPassesToRobot(initial_passer, final_receiver,
+                                                    passing_team, other_team);
+
+                EXPECT_EQ(expected, results[i]);
+                EXPECT_EQ(expected,
+                          graph.getNumPassesToRobot(initial_passer, final_receiver));
+            }
+        }
+    }
+}
@@ -13,18 +13,20 @@ std::optional<Robot> getRobotWithEffectiveBallPossession(const Team& team,
         return std::nullopt;
     }
 
-    auto best_intercept =
-        findBestInterceptForBall(ball, field, team.getAllRobots().at(0));
-    auto baller_robot = team.getAllRobots().at(0);
+    const std::vector<Robot>& robots = team.getAllRobots();
+    auto intercepts = findBestInterceptsForBall(ball, field, robots);
+
+    auto best_intercept = intercepts.at(0);
+    size_t baller_index = 0;
 
     // Find the robot that can intercept the ball the quickest
-    for (const auto& robot : team.getAllRobots())
+    for (size_t i = 0; i < robots.size(); i++)
     {
-        auto intercept = findBestInterceptForBall(ball, field, robot);
+        const auto& intercept = intercepts[i];
         if (!best_intercept || (intercept && intercept->second < best_intercept->second))
         {
             best_intercept = intercept;
-            baller_robot   = robot;
+            baller_index   = i;
         }
     }
 
@@ -33,7 +35,7 @@ std::optional<Robot> getRobotWithEffectiveBallPossession(const Team& team,
     // robot to the ball
     if (best_intercept)
     {
-        return baller_robot;
+        return robots[baller_index];
     }
     else
     {
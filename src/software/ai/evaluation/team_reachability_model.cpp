@@ -0,0 +1,245 @@
+#include "software/ai/evaluation/team_reachability_model.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "software/geom/geom_constants.h"
+
+TeamReachabilityModel::TeamReachabilityModel(const std::vector<Robot>& robots)
+    : robots(robots)
+{
+    for (const Robot& robot : robots)
+    {
+        position_x.push_back(robot.position().x());
+        position_y.push_back(robot.position().y());
+        velocity_x.push_back(robot.velocity().x());
+        velocity_y.push_back(robot.velocity().y());
+        max_speed.push_back(robot.robotConstants().robot_trajectory_max_speed_m_per_s);
+        max_acceleration.push_back(
+            robot.robotConstants().robot_trajectory_max_acceleration_m_per_s_2);
+    }
+}
+
+TeamReachabilityModel::TeamReachabilityModel(const std::vector<Robot>& robots,
+                                             double max_speed, double max_acceleration)
+    : robots(robots),
+      max_speed(robots.size(), max_speed),
+      max_acceleration(robots.size(), max_acceleration)
+{
+    for (const Robot& robot : robots)
+    {
+        position_x.push_back(robot.position().x());
+        position_y.push_back(robot.position().y());
+        velocity_x.push_back(robot.velocity().x());
+        velocity_y.push_back(robot.velocity().y());
+    }
+}
+
+TeamReachabilityModel::TeamReachabilityModel(const Team& team)
+    : TeamReachabilityModel(team.getAllRobots())
+{
+}
+
+TeamReachabilityModel::TeamReachabilityModel(const Team& team, double max_speed,
+                                             double max_acceleration)
+    : TeamReachabilityModel(team.getAllRobots(), max_speed, max_acceleration)
+{
+}
+
+const std::vector<Robot>& TeamReachabilityModel::getRobots() const
+{
+    return robots;
+}
+
+size_t TeamReachabilityModel::numRobots() const
+{
+    return robots.size();
+}
+
+Duration TeamReachabilityModel::getTimeToPosition(size_t robot_index,
+                                                  const Point& destination,
+                                                  double final_speed) const
+{
+    if (robot_index >= robots.size())
+    {
+        throw std::out_of_range("Robot index " + std::to_string(robot_index) +
+                                " is not in a reachability model of " +
+                                std::to_string(robots.size()) + " robots");
+    }
+
+    const double destination_x = destination.x();
+    const double destination_y = destination.y();
+    double time;
+    computeTimesToPositions<1>(robot_index, 1, &destination_x, &destination_y,
+                               final_speed, 0, &time);
+    return Duration::fromSeconds(time);
+}
+
+std::vector<double> TeamReachabilityModel::getTimesToPosition(const Point& destination,
+                                                              double final_speed) const
+{
+    std::vector<double> destination_x(robots.size(), destination.x());
+    std::vector<double> destination_y(robots.size(), destination.y());
+    std::vector<double> times(robots.size());
+    computeTimesToPositions<1>(0, robots.size(), destination_x.data(),
+                               destination_y.data(), final_speed, 0, times.data());
+    return times;
+}
+
+std::vector<double> TeamReachabilityModel::getTimesToPositions(
+    const std::vector<Point>& destinations, double final_speed,
+    double reach_distance) const
+{
+    if (destinations.size() != robots.size())
+    {
+        throw std::invalid_argument(
+            "Expected one destination for each of the " + std::to_string(robots.size()) +
+            " robots in the reachability model, but got " +
+            std::to_string(destinations.size()));
+    }
+
+    std::vector<double> destination_x;
+    std::vector<double> destination_y;
+    destination_x.reserve(destinations.size());
+    destination_y.reserve(destinations.size());
+    for (const Point& destination : destinations)
+    {
+        destination_x.push_back(destination.x());
+        destination_y.push_back(destination.y());
+    }
+
+    std::vector<double> times(robots.size());
+    computeTimesToPositions<1>(0, robots.size(), destination_x.data(),
+                               destination_y.data(), final_speed, reach_distance,
+                               times.data());
+    return times;
+}
+
+std::optional<TeamReachabilityModel::RobotArrival>
+TeamReachabilityModel::getEarliestRobotToPosition(const Point& destination) const
+{
+    return getEarliestRobotsToPositions({destination}).front();
+}
+
+std::vector<std::optional<TeamReachabilityModel::RobotArrival>>
+TeamReachabilityModel::getEarliestRobotsToPositions(
+    const std::vector<Point>& destinations) const
+{
+    std::vector<std::optional<RobotArrival>> earliest_arrivals(destinations.size(),
+                                                               std::nullopt);
+    if (robots.empty())
+    {
+        return earliest_arrivals;
+    }
+
+    std::vector<double> destination_x(robots.size());
+    std::vector<double> destination_y(robots.size());
+    std::vector<double> times(robots.size());
+    for (size_t i = 0; i < destinations.size(); i++)
+    {
+        std::fill(destination_x.begin(), destination_x.end(), destinations[i].x());
+        std::fill(destination_y.begin(), destination_y.end(), destinations[i].y());
+        computeTimesToPositions<1>(0, robots.size(), destination_x.data(),
+                                   destination_y.data(), 0, 0, times.data());
+
+        auto earliest = std::min_element(times.begin(), times.end());
+        earliest_arrivals[i] =
+            std::make_pair(static_cast<size_t>(std::distance(times.begin(), earliest)),
+                           Duration::fromSeconds(*earliest));
+    }
+    return earliest_arrivals;
+}
+
+std::vector<double> TeamReachabilityModel::getRobotTimesToPositions(
+    size_t robot_index, const std::vector<double>& destination_x,
+    const std::vector<double>& destination_y, double final_speed) const
+{
+    if (robot_index >= robots.size())
+    {
+        throw std::out_of_range("Robot index " + std::to_string(robot_index) +
+                                " is not in a reachability model of " +
+                                std::to_string(robots.size()) + " robots");
+    }
+    if (destination_x.size() != destination_y.size())
+    {
+        throw std::invalid_argument("Got " + std::to_string(destination_x.size()) +
+                                    " destination x coordinates but " +
+                                    std::to_string(destination_y.size()) +
+                                    " destination y coordinates");
+    }
+
+    std::vector<double> times(destination_x.size());
+    computeTimesToPositions<0>(robot_index, destination_x.size(), destination_x.data(),
+                               destination_y.data(), final_speed, 0, times.data());
+    return times;
+}
+
+template <size_t ROBOT_STRIDE>
+void TeamReachabilityModel::computeTimesToPositions(
+    size_t first_robot_index, size_t num_destinations, const double* destination_x,
+    const double* destination_y, double final_speed, double reach_distance,
+    double* times) const
+{
+    const double* robot_position_x       = position_x.data() + first_robot_index;
+    const double* robot_position_y       = position_y.data() + first_robot_index;
+    const double* robot_velocity_x       = velocity_x.data() + first_robot_index;
+    const double* robot_velocity_y       = velocity_y.data() + first_robot_index;
+    const double* robot_max_speed        = max_speed.data() + first_robot_index;
+    const double* robot_max_acceleration = max_acceleration.data() + first_robot_index;
+
+    // This is the same calculation as Robot::getTimeToPosition followed by
+    // getTimeToTravelDistance, but every case of the motion profile is computed and
+    // the result is selected at the end instead of branching, so the loop can be
+    // vectorized
+    for (size_t i = 0; i < num_destinations; i++)
+    {
+        const size_t robot = i * ROBOT_STRIDE;
+
+        double dx     = destination_x[i] - robot_position_x[robot];
+        double dy     = destination_y[i] - robot_position_y[robot];
+        double length = std::sqrt(dx * dx + dy * dy);
+
+        // Project the velocities onto the direction of the destination. Like
+        // Vector::normalize, very short vectors have no direction
+        bool has_direction = length >= 2 * FIXED_EPSILON;
+        double projected_velocity =
+            (robot_velocity_x[robot] * dx + robot_velocity_y[robot] * dy) /
+            std::max(length, 2 * FIXED_EPSILON);
+        double initial_velocity = has_direction ? projected_velocity : 0.0;
+        double final_velocity   = has_direction ? final_speed : 0.0;
+
+        // Bound all values to be realistic
+        double d_total = std::max(0.0, length - reach_distance);
+        double v_max   = std::max(0.0, robot_max_speed[robot]);
+        double v_i     = std::min(std::max(initial_velocity, -v_max), v_max);
+        double v_f     = std::min(std::max(final_velocity, 0.0), v_max);
+        double a_max   = std::max(1e-6, robot_max_acceleration[robot]);
+
+        // The robot can't reach the final velocity within the distance, so it
+        // accelerates or decelerates towards it the whole way
+        double dist_required_to_reach_v_f = std::abs(v_f * v_f - v_i * v_i) / (2 * a_max);
+        double a_max_signed               = v_f < v_i ? -a_max : a_max;
+        double t_towards_v_f =
+            (-v_i + std::sqrt(std::max(0.0, v_i * v_i + 2 * a_max_signed * d_total))) /
+            a_max_signed;
+
+        // The robot accelerates, then decelerates as late as possible
+        double t_accel_decel =
+            -(v_i + v_f - std::sqrt(2 * (2 * a_max * d_total + v_i * v_i + v_f * v_f))) /
+            a_max;
+        double v_max_reached = (a_max * t_accel_decel + v_f + v_i) / 2;
+
+        // The robot accelerates, cruises at max speed, then decelerates
+        double t_accel       = (v_max - v_i) / a_max;
+        double t_decel       = (v_f - v_max) / -a_max;
+        double d_accel       = t_accel * (v_i + v_max) / 2;
+        double d_decel       = t_decel * (v_f + v_max) / 2;
+        double t_cruising    = (d_total - d_accel - d_decel) / v_max;
+        double t_with_cruise = t_accel + t_cruising + t_decel;
+
+        double t_reaching_v_f = v_max_reached > v_max ? t_with_cruise : t_accel_decel;
+        times[i] = dist_required_to_reach_v_f > d_total ? t_towards_v_f : t_reaching_v_f;
+    }
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "software/time/duration.h"
+#include "software/world/team.h"
+
+/**
+ * A model of how quickly each robot on a team can reach points on the field.
+ *
+ * Robot::getTimeToPosition projects the robot's velocity onto the direction of the
+ * destination and then solves a 1D bang-bang motion profile using the robot's speed
+ * and acceleration limits. This model takes a snapshot of everything that calculation
+ * needs for every robot on a team, and stores it as one contiguous array per quantity.
+ * Time to position queries for a whole team (or a whole batch of points) are then
+ * evaluated in tight loops over those arrays, which the compiler can vectorize, rather
+ * than one robot and one point at a time.
+ *
+ * The model is meant to be created once per tick and shared by every evaluation that
+ * needs robot travel times during that tick.
+ */
+class TeamReachabilityModel
+{
+   public:
+    // The index of a robot in the model, and the time it takes that robot to reach a
+    // point
+    using RobotArrival = std::pair<size_t, Duration>;
+
+    TeamReachabilityModel() = delete;
+
+    /**
+     * Creates a reachability model for the given robots, using each robot's own speed
+     * and acceleration limits
+     *
+     * @param robots The robots to model
+     */
+    explicit TeamReachabilityModel(const std::vector<Robot>& robots);
+
+    /**
+     * Creates a reachability model for the given robots, using the same speed and
+     * acceleration limits for all of them. This is useful for robots whose limits we
+     * don't know, such as enemy robots.
+     *
+     * @param robots The robots to model
+     * @param max_speed The max speed of every robot (m/s)
+     * @param max_acceleration The max acceleration of every robot (m/s^2)
+     */
+    explicit TeamReachabilityModel(const std::vector<Robot>& robots, double max_speed,
+                                   double max_acceleration);
+
+    /**
+     * Creates a reachability model for the robots on the given team, using each
+     * robot's own speed and acceleration limits
+     *
+     * @param team The team to model
+     */
+    explicit TeamReachabilityModel(const Team& team);
+
+    /**
+     * Creates a reachability model for the robots on the given team, using the same
+     * speed and acceleration limits for all of them
+     *
+     * @param team The team to model
+     * @param max_speed The max speed of every robot (m/s)
+     * @param max_acceleration The max acceleration of every robot (m/s^2)
+     */
+    explicit TeamReachabilityModel(const Team& team, double max_speed,
+                                   double max_acceleration);
+
+    /**
+     * Gets the robots in this model, in the same order as the robots they were
+     * created from
+     *
+     * @return the robots in this model
+     */
+    const std::vector<Robot>& getRobots() const;
+
+    /**
+     * Gets the number of robots in this model
+     *
+     * @return the number of robots in this model
+     */
+    size_t numRobots() const;
+
+    /**
+     * Estimates the minimum time it would take a robot to reach a point. This matches
+     * Robot::getTimeToPosition when the final velocity is along the direction of travel.
+     *
+     * @param robot_index The index of the robot in this model
+     * @param destination The point the robot is moving to
+     * @param final_speed The speed the robot should be moving at towards the
+     * destination once it reaches it
+     *
+     * @throws std::out_of_range if the robot index is not in this model
+     *
+     * @return the minimum time it would take the robot to reach the destination
+     */
+    Duration getTimeToPosition(size_t robot_index, const Point& destination,
+                               double final_speed = 0) const;
+
+    /**
+     * Estimates the minimum time it would take each robot to reach the given point
+     *
+     * @param destination The point the robots are moving to
+     * @param final_speed The speed the robots should be moving at towards the
+     * destination once they reach it
+     *
+     * @return the minimum time in seconds for each robot to reach the destination, in
+     * the same order as the robots in this model
+     */
+    std::vector<double> getTimesToPosition(const Point& destination,
+                                           double final_speed = 0) const;
+
+    /**
+     * Estimates the minimum time it would take each robot to get within the given
+     * distance of its own destination
+     *
+     * @param destinations The destination of each robot, in the same order as the
+     * robots in this model
+     * @param final_speed The speed the robots should be moving at towards their
+     * destinations once they reach them
+     * @param reach_distance How close the robots need to get to their destinations
+     *
+     * @throws std::invalid_argument if there is not exactly one destination per robot
+     *
+     * @return the minimum time in seconds for each robot to reach its destination, in
+     * the same order as the robots in this model
+     */
+    std::vector<double> getTimesToPositions(const std::vector<Point>& destinations,
+                                            double final_speed    = 0,
+                                            double reach_distance = 0) const;
+
+    /**
+     * Finds the robot that can reach the given point first
+     *
+     * @param destination The point the robots are moving to
+     *
+     * @return the index of the robot that can reach the destination first and how long
+     * it would take, or std::nullopt if there are no robots in this model. Ties go to
+     * the robot that comes first in this model.
+     */
+    std::optional<RobotArrival> getEarliestRobotToPosition(
+        const Point& destination) const;
+
+    /**
+     * Finds the robot that can reach each of the given points first
+     *
+     * @param destinations The points the robots are moving to
+     *
+     * @return the earliest robot to reach each destination and how long it would take,
+     * in the same order as the destinations. All entries are std::nullopt if there are
+     * no robots in this model.
+     */
+    std::vector<std::optional<RobotArrival>> getEarliestRobotsToPositions(
+        const std::vector<Point>& destinations) const;
+
+    /**
+     * Estimates the minimum time it would take one robot to reach each of a batch of
+     * points. The points are given as separate x and y coordinates so large batches,
+     * such as every cell of a grid, can be built once and reused.
+     *
+     * @param robot_index The index of the robot in this model
+     * @param destination_x The x coordinate of each destination
+     * @param destination_y The y coordinate of each destination
+     * @param final_speed The speed the robot should be moving at towards each
+     * destination once it reaches it
+     *
+     * @throws std::out_of_range if the robot index is not in this model
+     * @throws std::invalid_argument if there are a different number of x and y
+     * coordinates
+     *
+     * @return the minimum time in seconds for the robot to reach each destination, in
+     * the same order as the destinations
+     */
+    std::vector<double> getRobotTimesToPositions(
+        size_t robot_index, const std::vector<double>& destination_x,
+        const std::vector<double>& destination_y, double final_speed = 0) const;
+
+   private:
+    /**
+     * Computes the time for robots to get within reach_distance of destinations. All
+     * time to position queries go through this loop so that it is the only place the
+     * motion profile needs to be vectorized.
+     *
+     * @tparam ROBOT_STRIDE 1 if each destination belongs to the next robot, starting
+     * from first_robot_index, or 0 if every destination belongs to the robot at
+     * first_robot_index
+     *
+     * @param first_robot_index The index of the robot the first destination belongs to
+     * @param num_destinations The number of destinations
+     * @param destination_x The x coordinate of each destination
+     * @param destination_y The y coordinate of each destination
+     * @param final_speed The speed the robots should be moving at towards their
+     * destinations once they reach them
+     * @param reach_distance How close the robots need to get to their destinations
+     * @param times Filled with the time in seconds to reach each destination
+     */
+    template <size_t ROBOT_STRIDE>
+    void computeTimesToPositions(size_t first_robot_index, size_t num_destinations,
+                                 const double* destination_x,
+                                 const double* destination_y, double final_speed,
+                                 double reach_distance, double* times) const;
+
+    std::vector<Robot> robots;
+
+    // The state of each robot, stored as one array per quantity so the time to
+    // position calculations can be vectorized across robots
+    std::vector<double> position_x;
+    std::vector<double> position_y;
+    std::vector<double> velocity_x;
+    std::vector<double> velocity_y;
+    std::vector<double> max_speed;
+    std::vector<double> max_acceleration;
+};
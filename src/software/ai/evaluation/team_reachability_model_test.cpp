@@ -0,0 +1,131 @@
+#include "software/ai/evaluation/team_reachability_model.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/ai/evaluation/time_to_travel.h"
+#include "software/test_util/test_util.h"
+
+class TeamReachabilityModelTest : public ::testing::Test
+{
+   protected:
+    Robot createRobot(RobotId id, const Point& position,
+                      const Vector& velocity = Vector(0, 0))
+    {
+        return Robot(id, position, velocity, Angle::zero(), AngularVelocity::zero(),
+                     Timestamp::fromSeconds(0));
+    }
+};
+
+TEST_F(TeamReachabilityModelTest, empty_team)
+{
+    TeamReachabilityModel model(Team(Duration::fromSeconds(1)));
+
+    EXPECT_EQ(0, model.numRobots());
+    EXPECT_TRUE(model.getTimesToPosition(Point(1, 1)).empty());
+    EXPECT_FALSE(model.getEarliestRobotToPosition(Point(1, 1)));
+    EXPECT_EQ(std::vector<std::optional<TeamReachabilityModel::RobotArrival>>(
+                  2, std::nullopt),
+              model.getEarliestRobotsToPositions({Point(1, 1), Point(2, 2)}));
+}
+
+TEST_F(TeamReachabilityModelTest, robot_already_at_destination)
+{
+    TeamReachabilityModel model(std::vector<Robot>{createRobot(0, Point(1, -1))});
+
+    EXPECT_EQ(Duration::fromSeconds(0), model.getTimeToPosition(0, Point(1, -1)));
+}
+
+TEST_F(TeamReachabilityModelTest, times_match_robot_get_time_to_position)
+{
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<double> position_distribution(-5, 5);
+    std::uniform_real_distribution<double> velocity_distribution(-3, 3);
+
+    std::vector<Robot> robots;
+    for (RobotId id = 0; id < DIV_A_NUM_ROBOTS; id++)
+    {
+        robots.push_back(createRobot(
+            id,
+            Point(position_distribution(random_engine),
+                  position_distribution(random_engine)),
+            Vector(velocity_distribution(random_engine),
+                   velocity_distribution(random_engine))));
+    }
+    TeamReachabilityModel model(robots);
+
+    for (int i = 0; i < 100; i++)
+    {
+        Point destination(position_distribution(random_engine),
+                          position_distribution(random_engine));
+        std::vector<double> times = model.getTimesToPosition(destination);
+        ASSERT_EQ(robots.size(), times.size());
+
+        for (size_t j = 0; j < robots.size(); j++)
+        {
+            double expected = robots[j].getTimeToPosition(destination).toSeconds();
+            EXPECT_NEAR(expected, times[j], 1e-9);
+            EXPECT_NEAR(expected, model.getTimeToPosition(j, destination).toSeconds(),
+                        1e-9);
+
+            // A final velocity towards the destination
+            Vector final_velocity = (destination - robots[j].position()).normalize(1.5);
+            EXPECT_NEAR(
+                robots[j].getTimeToPosition(destination, final_velocity).toSeconds(),
+                model.getTimeToPosition(j, destination, 1.5).toSeconds(), 1e-9);
+        }
+    }
+}
+
+TEST_F(TeamReachabilityModelTest, times_to_positions_with_reach_distance)
+{
+    Robot robot_0 = createRobot(0, Point(0, 0), Vector(1, 0));
+    Robot robot_1 = createRobot(1, Point(0, 0), Vector(0, -1));
+    TeamReachabilityModel model({robot_0, robot_1}, 2.0, 3.0);
+
+    std::vector<double> times =
+        model.getTimesToPositions({Point(3, 0), Point(0, 0.05)}, 0.5, 0.1);
+
+    ASSERT_EQ(2, times.size());
+    // Robot 0 only needs to travel 2.9m, starting at 1m/s towards its destination
+    EXPECT_NEAR(getTimeToTravelDistance(2.9, 2.0, 3.0, 1.0, 0.5).toSeconds(), times[0],
+                1e-9);
+    // Robot 1 is already close enough to its destination, but still has to stop moving
+    // away from it
+    EXPECT_NEAR(getTimeToTravelDistance(0, 2.0, 3.0, -1.0, 0.5).toSeconds(), times[1],
+                1e-9);
+}
+
+TEST_F(TeamReachabilityModelTest, times_to_positions_with_wrong_number_of_destinations)
+{
+    TeamReachabilityModel model(std::vector<Robot>{createRobot(0, Point(0, 0))});
+
+    EXPECT_THROW(model.getTimesToPositions({Point(1, 1), Point(2, 2)}),
+                 std::invalid_argument);
+    EXPECT_THROW(model.getTimeToPosition(1, Point(1, 1)), std::out_of_range);
+}
+
+TEST_F(TeamReachabilityModelTest, earliest_robot_is_not_always_the_closest)
+{
+    // Robot 0 is closer to (1, 0), but robot 1 is already moving towards it at full
+    // speed. Robot 1 is closer to (-3, 0), but is moving away from it
+    Robot robot_0 = createRobot(0, Point(0, 0), Vector(-2, 0));
+    Robot robot_1 = createRobot(1, Point(-1.5, 0), Vector(2, 0));
+    Robot robot_2 = createRobot(2, Point(3, 3));
+    TeamReachabilityModel model({robot_0, robot_1, robot_2}, 2.0, 3.0);
+
+    auto earliest = model.getEarliestRobotToPosition(Point(1, 0));
+    ASSERT_TRUE(earliest);
+    EXPECT_EQ(1, earliest->first);
+    EXPECT_NEAR(model.getTimesToPosition(Point(1, 0))[1], earliest->second.toSeconds(),
+                1e-9);
+
+    auto earliest_robots =
+        model.getEarliestRobotsToPositions({Point(1, 0), Point(3, 2.5), Point(-3, 0)});
+    ASSERT_EQ(3, earliest_robots.size());
+    ASSERT_TRUE(earliest_robots[0] && earliest_robots[1] && earliest_robots[2]);
+    EXPECT_EQ(1, earliest_robots[0]->first);
+    EXPECT_EQ(2, earliest_robots[1]->first);
+    EXPECT_EQ(0, earliest_robots[2]->first);
+}
@@ -0,0 +1,165 @@
+#include "software/ai/evaluation/time_to_reach_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "software/geom/algorithms/distance.h"
+
+TimeToReachMap::TimeToReachMap(const Rectangle& area, double cell_size)
+    : area_(area), cell_size_(cell_size), num_robots_recomputed_(0)
+{
+    if (!(cell_size > 0))
+    {
+        throw std::invalid_argument("TimeToReachMap cell size must be positive, got " +
+                                    std::to_string(cell_size));
+    }
+
+    num_columns_ =
+        std::max<size_t>(1, static_cast<size_t>(std::ceil(area.xLength() / cell_size)));
+    num_rows_ =
+        std::max<size_t>(1, static_cast<size_t>(std::ceil(area.yLength() / cell_size)));
+
+    cell_center_x_.reserve(num_columns_ * num_rows_);
+    cell_center_y_.reserve(num_columns_ * num_rows_);
+    for (size_t row = 0; row < num_rows_; row++)
+    {
+        for (size_t column = 0; column < num_columns_; column++)
+        {
+            cell_center_x_.push_back(area.xMin() + (column + 0.5) * cell_size);
+            cell_center_y_.push_back(area.yMin() + (row + 0.5) * cell_size);
+        }
+    }
+}
+
+void TimeToReachMap::update(const TeamReachabilityModel& friendly_reachability,
+                            const TeamReachabilityModel& enemy_reachability)
+{
+    num_robots_recomputed_ = 0;
+    updateTeam(friendly_reachability, friendly_times_);
+    updateTeam(enemy_reachability, enemy_times_);
+}
+
+Duration TimeToReachMap::getFriendlyTimeToReach(const Point& point) const
+{
+    return Duration::fromSeconds(sample(friendly_times_.earliest_times, point));
+}
+
+Duration TimeToReachMap::getEnemyTimeToReach(const Point& point) const
+{
+    return Duration::fromSeconds(sample(enemy_times_.earliest_times, point));
+}
+
+Duration TimeToReachMap::getFriendlyTimeAdvantage(const Point& point) const
+{
+    double friendly_time = sample(friendly_times_.earliest_times, point);
+    double enemy_time    = sample(enemy_times_.earliest_times, point);
+    if (std::isinf(friendly_time) && std::isinf(enemy_time))
+    {
+        return Duration::fromSeconds(0);
+    }
+    return Duration::fromSeconds(enemy_time - friendly_time);
+}
+
+const Rectangle& TimeToReachMap::area() const
+{
+    return area_;
+}
+
+double TimeToReachMap::cellSize() const
+{
+    return cell_size_;
+}
+
+size_t TimeToReachMap::numRobotsRecomputedOnLastUpdate() const
+{
+    return num_robots_recomputed_;
+}
+
+void TimeToReachMap::updateTeam(const TeamReachabilityModel& reachability,
+                                TeamTimes& team_times)
+{
+    const std::vector<Robot>& robots = reachability.getRobots();
+
+    std::map<RobotId, RobotTimes> updated_robot_times;
+    bool times_changed = false;
+    for (size_t i = 0; i < robots.size(); i++)
+    {
+        const Robot& robot = robots[i];
+
+        // Reuse the times we already have for robots that have barely changed
+        auto existing_times = team_times.robot_times.find(robot.id());
+        if (existing_times != team_times.robot_times.end() &&
+            distance(existing_times->second.position, robot.position()) <=
+                POSITION_UPDATE_TOLERANCE_METERS &&
+            (existing_times->second.velocity - robot.velocity()).length() <=
+                VELOCITY_UPDATE_TOLERANCE_METERS_PER_SECOND)
+        {
+            updated_robot_times.emplace(robot.id(), std::move(existing_times->second));
+            continue;
+        }
+
+        std::vector<double> times =
+            reachability.getRobotTimesToPositions(i, cell_center_x_, cell_center_y_);
+        updated_robot_times.emplace(
+            robot.id(), RobotTimes{robot.position(), robot.velocity(),
+                                   std::vector<float>(times.begin(), times.end())});
+        num_robots_recomputed_++;
+        times_changed = true;
+    }
+
+    // Robots that are no longer on the team also change the earliest times
+    times_changed |= updated_robot_times.size() != team_times.robot_times.size();
+    team_times.robot_times = std::move(updated_robot_times);
+    if (!times_changed)
+    {
+        return;
+    }
+
+    team_times.earliest_times.clear();
+    for (const auto& [id, robot_times] : team_times.robot_times)
+    {
+        if (team_times.earliest_times.empty())
+        {
+            team_times.earliest_times = robot_times.times;
+            continue;
+        }
+
+        for (size_t cell = 0; cell < team_times.earliest_times.size(); cell++)
+        {
+            team_times.earliest_times[cell] =
+                std::min(team_times.earliest_times[cell], robot_times.times[cell]);
+        }
+    }
+}
+
+double TimeToReachMap::sample(const std::vector<float>& times, const Point& point) const
+{
+    if (times.empty())
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    // The position of the point in cells, relative to the centre of the first cell
+    double column = std::clamp((point.x() - area_.xMin()) / cell_size_ - 0.5, 0.0,
+                               static_cast<double>(num_columns_ - 1));
+    double row    = std::clamp((point.y() - area_.yMin()) / cell_size_ - 0.5, 0.0,
+                               static_cast<double>(num_rows_ - 1));
+
+    // Bilinearly interpolate between the four closest cell centres
+    size_t column_0        = static_cast<size_t>(column);
+    size_t row_0           = static_cast<size_t>(row);
+    size_t column_1        = std::min(column_0 + 1, num_columns_ - 1);
+    size_t row_1           = std::min(row_0 + 1, num_rows_ - 1);
+    double column_fraction = column - static_cast<double>(column_0);
+    double row_fraction    = row - static_cast<double>(row_0);
+
+    auto time_at = [&](size_t cell_row, size_t cell_column)
+    { return static_cast<double>(times[cell_row * num_columns_ + cell_column]); };
+    double bottom = time_at(row_0, column_0) * (1 - column_fraction) +
+                    time_at(row_0, column_1) * column_fraction;
+    double top    = time_at(row_1, column_0) * (1 - column_fraction) +
+                    time_at(row_1, column_1) * column_fraction;
+    return bottom * (1 - row_fraction) + top * row_fraction;
+}
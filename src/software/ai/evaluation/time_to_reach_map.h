@@ -0,0 +1,163 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "software/ai/evaluation/team_reachability_model.h"
+#include "software/geom/rectangle.h"
+#include "software/time/duration.h"
+
+/**
+ * A raster over an area of the field of how soon each team can get to every point in
+ * it.
+ *
+ * Every cell holds the earliest time any friendly robot, and any enemy robot, could
+ * reach the centre of the cell. Evaluations that ask "which team gets to this point
+ * first, and by how much" can sample the map instead of iterating over every robot on
+ * both teams for every point they look at.
+ *
+ * The map keeps the time it takes each robot to reach every cell. When it is updated,
+ * only the robots that have moved or changed velocity since their times were last
+ * computed are recomputed, so consecutive vision frames where most robots barely move
+ * are cheap to apply.
+ */
+class TimeToReachMap
+{
+   public:
+    // The default side length of each cell (m)
+    static constexpr double DEFAULT_CELL_SIZE_METERS = 0.05;
+
+    // How far a robot can move, and how much its velocity can change, before the times
+    // for it to reach each cell are recomputed
+    static constexpr double POSITION_UPDATE_TOLERANCE_METERS           = 0.01;
+    static constexpr double VELOCITY_UPDATE_TOLERANCE_METERS_PER_SECOND = 0.05;
+
+    TimeToReachMap() = delete;
+
+    /**
+     * Creates a time to reach map over the given area. The map contains no robots
+     * until it is updated.
+     *
+     * @param area The area covered by the map
+     * @param cell_size The side length of each cell (m)
+     *
+     * @throws std::invalid_argument if the cell size is not positive
+     */
+    explicit TimeToReachMap(const Rectangle& area,
+                            double cell_size = DEFAULT_CELL_SIZE_METERS);
+
+    /**
+     * Updates the map to the current state of both teams
+     *
+     * @param friendly_reachability The reachability model of the friendly team
+     * @param enemy_reachability The reachability model of the enemy team
+     */
+    void update(const TeamReachabilityModel& friendly_reachability,
+                const TeamReachabilityModel& enemy_reachability);
+
+    /**
+     * Gets the earliest time any friendly robot could reach the given point. Times are
+     * interpolated between cell centres, and points outside the map use the closest
+     * point in the map.
+     *
+     * @param point The point to sample
+     *
+     * @return the earliest time any friendly robot could reach the point, or an
+     * infinite duration if there are no friendly robots
+     */
+    Duration getFriendlyTimeToReach(const Point& point) const;
+
+    /**
+     * Gets the earliest time any enemy robot could reach the given point. Times are
+     * interpolated between cell centres, and points outside the map use the closest
+     * point in the map.
+     *
+     * @param point The point to sample
+     *
+     * @return the earliest time any enemy robot could reach the point, or an infinite
+     * duration if there are no enemy robots
+     */
+    Duration getEnemyTimeToReach(const Point& point) const;
+
+    /**
+     * Gets how much sooner the friendly team could reach the given point than the
+     * enemy team
+     *
+     * @param point The point to sample
+     *
+     * @return the enemy team's time to reach the point minus the friendly team's. This
+     * is positive if the friendly team would get there first. It is infinite if only
+     * one team has robots, and zero if neither team has robots.
+     */
+    Duration getFriendlyTimeAdvantage(const Point& point) const;
+
+    /**
+     * Gets the area covered by the map
+     *
+     * @return the area covered by the map
+     */
+    const Rectangle& area() const;
+
+    /**
+     * Gets the side length of each cell (m)
+     *
+     * @return the side length of each cell
+     */
+    double cellSize() const;
+
+    /**
+     * Gets the number of robots whose times to reach each cell were recomputed during
+     * the last update
+     *
+     * @return the number of robots recomputed during the last update
+     */
+    size_t numRobotsRecomputedOnLastUpdate() const;
+
+   private:
+    // The times for a single robot to reach each cell
+    struct RobotTimes
+    {
+        Point position;
+        Vector velocity;
+        std::vector<float> times;
+    };
+
+    // The times for a team to reach each cell
+    struct TeamTimes
+    {
+        std::map<RobotId, RobotTimes> robot_times;
+        // The earliest time any robot on the team could reach each cell
+        std::vector<float> earliest_times;
+    };
+
+    /**
+     * Updates the times for a team to reach each cell
+     *
+     * @param reachability The reachability model of the team
+     * @param team_times The times to update
+     */
+    void updateTeam(const TeamReachabilityModel& reachability, TeamTimes& team_times);
+
+    /**
+     * Samples a grid of times at a point, interpolating between cell centres
+     *
+     * @param times The time for each cell, in row major order
+     * @param point The point to sample
+     *
+     * @return the time at the point in seconds
+     */
+    double sample(const std::vector<float>& times, const Point& point) const;
+
+    Rectangle area_;
+    double cell_size_;
+    size_t num_columns_;
+    size_t num_rows_;
+
+    // The coordinates of the centre of each cell, in row major order
+    std::vector<double> cell_center_x_;
+    std::vector<double> cell_center_y_;
+
+    TeamTimes friendly_times_;
+    TeamTimes enemy_times_;
+    size_t num_robots_recomputed_;
+};
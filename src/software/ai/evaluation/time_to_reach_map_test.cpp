@@ -0,0 +1,157 @@
+#include "software/ai/evaluation/time_to_reach_map.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/test_util/test_util.h"
+
+class TimeToReachMapTest : public ::testing::Test
+{
+   protected:
+    Robot createRobot(RobotId id, const Point& position,
+                      const Vector& velocity = Vector(0, 0))
+    {
+        return Robot(id, position, velocity, Angle::zero(), AngularVelocity::zero(),
+                     Timestamp::fromSeconds(0));
+    }
+
+    TeamReachabilityModel createModel(const std::vector<Robot>& robots)
+    {
+        return TeamReachabilityModel(robots, 2.0, 3.0);
+    }
+
+    Rectangle area = Rectangle(Point(-3, -2), Point(3, 2));
+};
+
+TEST_F(TimeToReachMapTest, invalid_cell_size)
+{
+    EXPECT_THROW(TimeToReachMap(area, 0), std::invalid_argument);
+    EXPECT_THROW(TimeToReachMap(area, -0.1), std::invalid_argument);
+}
+
+TEST_F(TimeToReachMapTest, no_robots)
+{
+    TimeToReachMap map(area);
+    map.update(createModel({}), createModel({}));
+
+    EXPECT_TRUE(std::isinf(map.getFriendlyTimeToReach(Point(0, 0)).toSeconds()));
+    EXPECT_TRUE(std::isinf(map.getEnemyTimeToReach(Point(0, 0)).toSeconds()));
+    EXPECT_EQ(Duration::fromSeconds(0), map.getFriendlyTimeAdvantage(Point(0, 0)));
+}
+
+TEST_F(TimeToReachMapTest, times_at_cell_centres_match_reachability_model)
+{
+    std::mt19937 random_engine(1);
+    std::uniform_real_distribution<double> x_distribution(-3, 3);
+    std::uniform_real_distribution<double> y_distribution(-2, 2);
+    std::uniform_real_distribution<double> velocity_distribution(-2, 2);
+    std::uniform_int_distribution<int> column_distribution(0, 59);
+    std::uniform_int_distribution<int> row_distribution(0, 39);
+
+    std::vector<Robot> friendly_robots;
+    std::vector<Robot> enemy_robots;
+    for (RobotId id = 0; id < DIV_A_NUM_ROBOTS; id++)
+    {
+        for (auto robots : {&friendly_robots, &enemy_robots})
+        {
+            robots->push_back(
+                createRobot(id, Point(x_distribution(random_engine),
+                                      y_distribution(random_engine)),
+                            Vector(velocity_distribution(random_engine),
+                                   velocity_distribution(random_engine))));
+        }
+    }
+    TeamReachabilityModel friendly_model = createModel(friendly_robots);
+    TeamReachabilityModel enemy_model    = createModel(enemy_robots);
+
+    TimeToReachMap map(area, 0.1);
+    map.update(friendly_model, enemy_model);
+
+    for (int i = 0; i < 200; i++)
+    {
+        // The centre of a random cell
+        Point cell_centre(-3 + (column_distribution(random_engine) + 0.5) * 0.1,
+                          -2 + (row_distribution(random_engine) + 0.5) * 0.1);
+
+        double friendly_time =
+            friendly_model.getEarliestRobotToPosition(cell_centre)->second.toSeconds();
+        double enemy_time =
+            enemy_model.getEarliestRobotToPosition(cell_centre)->second.toSeconds();
+
+        EXPECT_NEAR(friendly_time, map.getFriendlyTimeToReach(cell_centre).toSeconds(),
+                    1e-5);
+        EXPECT_NEAR(enemy_time, map.getEnemyTimeToReach(cell_centre).toSeconds(), 1e-5);
+        EXPECT_NEAR(enemy_time - friendly_time,
+                    map.getFriendlyTimeAdvantage(cell_centre).toSeconds(), 1e-5);
+    }
+}
+
+TEST_F(TimeToReachMapTest, times_are_interpolated_between_cell_centres)
+{
+    TimeToReachMap map(area, 0.1);
+    map.update(createModel({createRobot(0, Point(0, 0))}), createModel({}));
+
+    // Halfway between the centres of two cells
+    double left  = map.getFriendlyTimeToReach(Point(1.05, 0.05)).toSeconds();
+    double right = map.getFriendlyTimeToReach(Point(1.15, 0.05)).toSeconds();
+    double middle = map.getFriendlyTimeToReach(Point(1.1, 0.05)).toSeconds();
+    EXPECT_NEAR((left + right) / 2, middle, 1e-6);
+    EXPECT_LT(left, right);
+}
+
+TEST_F(TimeToReachMapTest, points_outside_map_use_closest_point_in_map)
+{
+    TimeToReachMap map(area, 0.1);
+    map.update(createModel({createRobot(0, Point(0, 0))}), createModel({}));
+
+    EXPECT_DOUBLE_EQ(map.getFriendlyTimeToReach(Point(2.95, 1.95)).toSeconds(),
+                     map.getFriendlyTimeToReach(Point(10, 10)).toSeconds());
+}
+
+TEST_F(TimeToReachMapTest, friendly_time_advantage_sign)
+{
+    TimeToReachMap map(area, 0.1);
+    map.update(createModel({createRobot(0, Point(-2, 0))}),
+               createModel({createRobot(0, Point(2, 0))}));
+
+    EXPECT_GT(map.getFriendlyTimeAdvantage(Point(-1.5, 0)).toSeconds(), 0);
+    EXPECT_LT(map.getFriendlyTimeAdvantage(Point(1.5, 0)).toSeconds(), 0);
+    // Both robots are the same distance from the centre of the field
+    EXPECT_NEAR(0, map.getFriendlyTimeAdvantage(Point(0, 0)).toSeconds(), 1e-6);
+}
+
+TEST_F(TimeToReachMapTest, only_robots_that_changed_are_recomputed)
+{
+    Robot robot_0 = createRobot(0, Point(-1, 0));
+    Robot robot_1 = createRobot(1, Point(1, 0));
+    Robot enemy   = createRobot(0, Point(0, 1));
+
+    TimeToReachMap map(area, 0.1);
+    map.update(createModel({robot_0, robot_1}), createModel({enemy}));
+    EXPECT_EQ(3, map.numRobotsRecomputedOnLastUpdate());
+
+    // Nothing has changed
+    map.update(createModel({robot_0, robot_1}), createModel({enemy}));
+    EXPECT_EQ(0, map.numRobotsRecomputedOnLastUpdate());
+
+    // Moving within the tolerance doesn't need to be recomputed
+    Robot robot_1_barely_moved = createRobot(1, Point(1.005, 0));
+    map.update(createModel({robot_0, robot_1_barely_moved}), createModel({enemy}));
+    EXPECT_EQ(0, map.numRobotsRecomputedOnLastUpdate());
+
+    // Robot 1 moves over to robot 0, so it now takes a while for any robot to get
+    // back to where robot 1 was
+    Robot robot_1_moved = createRobot(1, Point(-1, 0), Vector(1, 0));
+    map.update(createModel({robot_0, robot_1_moved}), createModel({enemy}));
+    EXPECT_EQ(1, map.numRobotsRecomputedOnLastUpdate());
+    EXPECT_GT(map.getFriendlyTimeToReach(Point(1.05, 0.05)).toSeconds(), 0.5);
+
+    // Removing a robot updates the earliest times without recomputing anything
+    map.update(createModel({robot_1_moved}), createModel({enemy}));
+    EXPECT_EQ(0, map.numRobotsRecomputedOnLastUpdate());
+    EXPECT_NEAR(createModel({robot_1_moved})
+                    .getTimeToPosition(0, Point(-2.95, 0.05))
+                    .toSeconds(),
+                map.getFriendlyTimeToReach(Point(-2.95, 0.05)).toSeconds(), 1e-5);
+}
@@ -71,8 +71,8 @@ std::unique_ptr<TbotsProto::PrimitiveSet> AssignedTacticsPlay::get(
         world_ptr->getMostRecentTimestamp().toSeconds());
 
     // Visualize all obstacles and paths
-    LOG(VISUALIZE) << obstacle_list;
-    LOG(VISUALIZE) << path_visualization;
+    Visualizer::publish(obstacle_list);
+    Visualizer::publish(path_visualization);
 
     return primitives_to_run;
 }
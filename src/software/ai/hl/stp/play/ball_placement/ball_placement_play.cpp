@@ -23,7 +23,7 @@ void BallPlacementPlay::updateTactics(const PlayUpdate& play_update)
         *(ball_placement_vis_msg.mutable_ball_placement_point()) =
             *createPointProto(placement_point.value());
 
-        LOG(VISUALIZE) << ball_placement_vis_msg;
+        Visualizer::publish(ball_placement_vis_msg);
     }
 }
 
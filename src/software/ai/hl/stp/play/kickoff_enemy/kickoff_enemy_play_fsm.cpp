@@ -152,9 +152,7 @@ void KickoffEnemyPlayFSM::kickoff(const Update& event)
         LOG(WARNING) << "No Robot on the Field!";
     }
 
-    auto enemy_threats =
-        getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                           world_ptr->enemyTeam(), world_ptr->ball(), false);
+    auto enemy_threats = getAllEnemyThreats(*world_ptr, false);
 
     size_t defense_position_index = 0;
     size_t shadower_count         = std::min<size_t>(2, enemy_threats.size());
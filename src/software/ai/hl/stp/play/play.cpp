@@ -2,6 +2,8 @@
 
 #include <munkres/munkres.h>
 
+#include <chrono>
+
 #include <Tracy.hpp>
 
 #include "proto/message_translation/tbots_protobuf.h"
@@ -9,6 +11,22 @@
 #include "software/ai/motion_constraint/motion_constraint_set_builder.h"
 #include "software/logger/logger.h"
 
+namespace
+{
+    /**
+     * Returns how many milliseconds have passed since the given time
+     *
+     * @param start_time The time to measure from
+     *
+     * @return the milliseconds since start_time
+     */
+    double millisecondsSince(std::chrono::steady_clock::time_point start_time)
+    {
+        return std::chrono::duration<double, std::milli>(
+                   std::chrono::steady_clock::now() - start_time)
+            .count();
+    }
+}  // namespace
 
 Play::Play(std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr,
            bool requires_goalie)
@@ -53,6 +71,7 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Play::get(
     path_visualization.Clear();
 
     tactic_robot_id_assignment.clear();
+    tactic_run_times_ms.clear();
 
     std::optional<Robot> goalie_robot = world_ptr->friendlyTeam().goalie();
     std::vector<Robot> robots         = world_ptr->friendlyTeam().getAllRobots();
@@ -67,6 +86,7 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Play::get(
             robots.erase(std::remove(robots.begin(), robots.end(), goalie_robot.value()),
                          robots.end());
 
+            const auto goalie_start_time = tacticStartTime();
             auto motion_constraints =
                 buildMotionConstraintSet(world_ptr->gameState(), *goalie_tactic);
             auto primitives = goalie_tactic->get(world_ptr);
@@ -91,6 +111,7 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Play::get(
 
             primitives[goalie_robot_id]->getVisualizationProtos(obstacle_list,
                                                                 path_visualization);
+            addTacticRunTime(*goalie_tactic, goalie_start_time);
         }
         else if (world_ptr->friendlyTeam().getGoalieId().has_value())
         {
@@ -151,8 +172,8 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Play::get(
 
     // TODO (#3104): Remove duplicated obstacles from obstacle_list
     // Visualize all obstacles and paths
-    LOG(VISUALIZE) << obstacle_list;
-    LOG(VISUALIZE) << path_visualization;
+    Visualizer::publish(obstacle_list);
+    Visualizer::publish(path_visualization);
 
     primitives_to_run->mutable_time_sent()->set_epoch_timestamp_seconds(
         world_ptr->getMostRecentTimestamp().toSeconds());
@@ -167,6 +188,11 @@ const std::map<std::shared_ptr<const Tactic>, RobotId>& Play::getTacticRobotIdAs
     return tactic_robot_id_assignment;
 }
 
+const std::map<const Tactic*, double>& Play::getTacticRunTimesMs() const
+{
+    return tactic_run_times_ms;
+}
+
 std::tuple<std::vector<Robot>, std::unique_ptr<TbotsProto::PrimitiveSet>,
            std::map<std::shared_ptr<const Tactic>, RobotId>>
 Play::assignTactics(const WorldPtr& world_ptr, TacticVector tactic_vector,
@@ -182,7 +208,9 @@ Play::assignTactics(const WorldPtr& world_ptr, TacticVector tactic_vector,
 
     for (auto tactic : tactic_vector)
     {
+        const auto tactic_start_time = tacticStartTime();
         primitive_sets.emplace_back(tactic->get(world_ptr));
+        addTacticRunTime(*tactic, tactic_start_time);
         CHECK(primitive_sets.back().size() == world_ptr->friendlyTeam().numRobots())
             << primitive_sets.back().size() << " primitives from "
             << objectTypeName(*tactic)
@@ -214,25 +242,18 @@ Play::assignTactics(const WorldPtr& world_ptr, TacticVector tactic_vector,
     {
         for (size_t col = 0; col < num_cols; col++)
         {
-            Robot robot                    = robots_to_assign.at(row);
+            const Robot& robot             = robots_to_assign.at(row);
             std::shared_ptr<Tactic> tactic = tactic_vector.at(col);
-            auto primitives                = primitive_sets.at(col);
+            const auto& primitives         = primitive_sets.at(col);
             CHECK(primitives.contains(robot.id()))
                 << "Couldn't find a primitive for robot id " << robot.id();
             double robot_cost_for_tactic =
                 primitives.at(robot.id())->getEstimatedPrimitiveCost();
 
-            std::set<RobotCapability> required_capabilities =
-                tactic->robotCapabilityRequirements();
-            std::set<RobotCapability> robot_capabilities =
-                robot.getAvailableCapabilities();
-            std::set<RobotCapability> missing_capabilities;
-            std::set_difference(
-                required_capabilities.begin(), required_capabilities.end(),
-                robot_capabilities.begin(), robot_capabilities.end(),
-                std::inserter(missing_capabilities, missing_capabilities.begin()));
-
-            if (missing_capabilities.size() > 0)
+            RobotCapabilityFlags required_capabilities(
+                tactic->robotCapabilityRequirements());
+
+            if (!robot.availableCapabilityFlags().containsAll(required_capabilities))
             {
                 // We arbitrarily increase the cost, so that robots with missing
                 // capabilities are not assigned
@@ -275,6 +296,8 @@ Play::assignTactics(const WorldPtr& world_ptr, TacticVector tactic_vector,
                 CHECK(primitives.contains(robot_id))
                     << "Couldn't find a primitive for robot id " << robot_id;
 
+                const auto primitive_start_time = tacticStartTime();
+
                 // Create the list of obstacles
                 auto motion_constraints = buildMotionConstraintSet(
                     world_ptr->gameState(), *tactic_vector.at(col));
@@ -306,6 +329,7 @@ Play::assignTactics(const WorldPtr& world_ptr, TacticVector tactic_vector,
 
                 primitives[robot_id]->getVisualizationProtos(obstacle_list,
                                                              path_visualization);
+                addTacticRunTime(*tactic_vector.at(col), primitive_start_time);
                 break;
             }
         }
@@ -317,6 +341,25 @@ Play::assignTactics(const WorldPtr& world_ptr, TacticVector tactic_vector,
         current_tactic_robot_id_assignment};
 }
 
+std::optional<std::chrono::steady_clock::time_point> Play::tacticStartTime() const
+{
+    if (!ai_config_ptr->ai_control_config().time_tactics())
+    {
+        return std::nullopt;
+    }
+    return std::chrono::steady_clock::now();
+}
+
+void Play::addTacticRunTime(
+    const Tactic& tactic,
+    const std::optional<std::chrono::steady_clock::time_point>& start_time)
+{
+    if (start_time)
+    {
+        tactic_run_times_ms[&tactic] += millisecondsSince(*start_time);
+    }
+}
+
 std::vector<std::string> Play::getState()
 {
     // by default just return the name of the play
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <boost/coroutine2/all.hpp>
+#include <chrono>
+#include <optional>
 #include <vector>
 
 #include "proto/parameters.pb.h"
@@ -63,6 +65,15 @@ class Play
     const std::map<std::shared_ptr<const Tactic>, RobotId>& getTacticRobotIdAssignment()
         const;
 
+    /**
+     * Gets how long each tactic took to run during the last call to get, including
+     * generating the primitive of the robot it was assigned to. Tactics are only timed
+     * if time_tactics is set in the AiControlConfig.
+     *
+     * @return a map from tactic to its run time in milliseconds
+     */
+    const std::map<const Tactic*, double>& getTacticRunTimesMs() const;
+
     virtual ~Play() = default;
 
     /**
@@ -82,6 +93,9 @@ class Play
 
     std::map<std::shared_ptr<const Tactic>, RobotId> tactic_robot_id_assignment;
 
+    // How long each tactic took to run during the last iteration, in milliseconds
+    std::map<const Tactic*, double> tactic_run_times_ms;
+
     // Cached robot trajectories
     std::map<RobotId, TrajectoryPath> robot_trajectories;
 
@@ -116,6 +130,23 @@ class Play
     assignTactics(const WorldPtr& world_ptr, TacticVector tactic_vector,
                   const std::vector<Robot>& robots_to_assign);
 
+    /**
+     * Returns when a tactic started running, if tactics are being timed
+     *
+     * @return the current time if tactics are being timed, otherwise std::nullopt
+     */
+    std::optional<std::chrono::steady_clock::time_point> tacticStartTime() const;
+
+    /**
+     * Adds how long a tactic has been running to its run time
+     *
+     * @param tactic The tactic
+     * @param start_time When the tactic started running, or std::nullopt if tactics
+     * aren't being timed
+     */
+    void addTacticRunTime(
+        const Tactic& tactic,
+        const std::optional<std::chrono::steady_clock::time_point>& start_time);
 
     // HaltTactics common to all plays for robots that don't have tactics assigned
     TacticVector halt_tactics;
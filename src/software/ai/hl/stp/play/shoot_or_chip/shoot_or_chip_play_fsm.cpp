@@ -5,6 +5,7 @@
 #include "software/ai/evaluation/enemy_threat.h"
 #include "software/ai/evaluation/find_open_areas.h"
 #include "software/ai/evaluation/possession.h"
+#include "software/ai/evaluation/team_reachability_model.h"
 #include "software/ai/hl/stp/tactic/attacker/attacker_tactic.h"
 #include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
 #include "software/ai/hl/stp/tactic/move/move_tactic.h"
@@ -61,7 +62,8 @@ void ShootOrChipPlayFSM::updateShootOrChip(const Update& event)
     result[0].emplace_back(std::get<1>(crease_defender_tactics));
 
     // Update tactics moving to open areas
-    std::vector<Circle> chip_targets = findGoodChipTargets(*event.common.world_ptr);
+    std::vector<Circle> chip_targets = findGoodChipTargets(
+        *event.common.world_ptr, updateTimeToReachMap(*event.common.world_ptr));
     for (unsigned i = 0; i < chip_targets.size() && i < move_to_open_area_tactics.size();
          i++)
     {
@@ -95,3 +97,18 @@ bool ShootOrChipPlayFSM::attackerDone(const Update& event)
 {
     return attacker->done();
 }
+
+const TimeToReachMap& ShootOrChipPlayFSM::updateTimeToReachMap(const World& world)
+{
+    const Rectangle& field_lines = world.field().fieldLines();
+    if (!time_to_reach_map || !(time_to_reach_map->area() == field_lines))
+    {
+        time_to_reach_map.emplace(field_lines, TIME_TO_REACH_MAP_CELL_SIZE_METERS);
+    }
+
+    time_to_reach_map->update(
+        TeamReachabilityModel(world.friendlyTeam()),
+        TeamReachabilityModel(world.enemyTeam(), ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND,
+                              ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED));
+    return *time_to_reach_map;
+}
@@ -2,6 +2,7 @@
 
 #include "proto/parameters.pb.h"
 #include "shared/constants.h"
+#include "software/ai/evaluation/time_to_reach_map.h"
 #include "software/ai/hl/stp/play/play_fsm.hpp"
 #include "software/ai/hl/stp/tactic/attacker/attacker_tactic.h"
 #include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
@@ -22,7 +23,10 @@ struct ShootOrChipPlayFSM : PlayFSM<ShootOrChipPlayFSM>
 
     bool attackerDone(const Update& event);
 
-
+    // The side length of the cells of the time to reach map used to pick chip
+    // targets. Coarser than the default, since chip targets only need to be compared
+    // roughly and the map is updated every tick.
+    static constexpr double TIME_TO_REACH_MAP_CELL_SIZE_METERS = 0.1;
 
     auto operator()()
     {
@@ -42,7 +46,20 @@ struct ShootOrChipPlayFSM : PlayFSM<ShootOrChipPlayFSM>
     }
 
    private:
+    /**
+     * Updates the time to reach map to the given world, creating it if the field
+     * changed
+     *
+     * @param world The world
+     *
+     * @return the updated time to reach map
+     */
+    const TimeToReachMap& updateTimeToReachMap(const World& world);
+
     std::array<std::shared_ptr<CreaseDefenderTactic>, 2> crease_defender_tactics;
     std::array<std::shared_ptr<MoveTactic>, 2> move_to_open_area_tactics;
     std::shared_ptr<AttackerTactic> attacker;
+
+    // Kept between ticks so only the robots that moved are recomputed
+    std::optional<TimeToReachMap> time_to_reach_map;
 };
@@ -90,5 +90,5 @@ void AttackerTactic::visualizeControlParams(const World& world)
             *createPointProto(control_params.chip_target.value());
     }
 
-    LOG(VISUALIZE) << pass_visualization_msg;
+    Visualizer::publish(pass_visualization_msg);
 }
@@ -42,10 +42,9 @@ std::optional<Point> CreaseDefenderFSM::findBlockThreatPoint(
 
 bool CreaseDefenderFSM::isAnyEnemyInZone(const Update& event, const Stadium& zone)
 {
-    std::vector<Robot> enemy_robots = event.common.world_ptr->enemyTeam().getAllRobots();
-    return std::any_of(enemy_robots.begin(), enemy_robots.end(),
-                       [zone, enemy_robots](const Robot& robot)
-                       { return contains(zone, robot.position()); });
+    const TeamView& enemies = event.common.world_ptr->enemyTeam().view();
+    return std::any_of(enemies.positions().begin(), enemies.positions().end(),
+                       [&](const Point& position) { return contains(zone, position); });
 }
 
 void CreaseDefenderFSM::blockThreat(
@@ -198,22 +198,9 @@ void MovePrimitive::updateObstacles(
     obstacles = field_obstacles;
 
     // Adding virtual obstacles
-    auto virtual_obstacles = world.getVirtualObstacles().obstacles();
-    for (TbotsProto::Obstacle& obstacle : virtual_obstacles)
-    {
-        if (!obstacle.has_polygon())
-        {
-            LOG(WARNING)
-                << "Virtual Obstacles contain obstacle that is not a polygon. Shape ignored";
-
-            continue;
-        }
-
-        Polygon obstacle_polygon     = createPolygon(obstacle.polygon());
-        ObstaclePtr current_obstacle = obstacle_factory.createFromShape(obstacle_polygon);
-        obstacles.push_back(current_obstacle);
-    }
-
+    std::vector<ObstaclePtr> virtual_obstacles =
+        obstacle_factory.createFromVirtualObstacles(world);
+    obstacles.insert(obstacles.end(), virtual_obstacles.begin(), virtual_obstacles.end());
 
     for (const Robot& enemy : world.enemyTeam().getAllRobots())
     {
@@ -1,5 +1,6 @@
 #include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
 
+#include "proto/message_translation/tbots_geometry.h"
 #include "software/ai/navigator/obstacle/const_velocity_obstacle.hpp"
 #include "software/ai/navigator/obstacle/trajectory_obstacle.hpp"
 
@@ -177,14 +178,63 @@ RobotNavigationObstacleFactory::createObstaclesFromMotionConstraints(
     std::vector<ObstaclePtr> obstacles;
     for (auto motion_constraint : motion_constraints)
     {
-        auto new_obstacles =
-            createObstaclesFromMotionConstraint(motion_constraint, world);
-        obstacles.insert(obstacles.end(), new_obstacles.begin(), new_obstacles.end());
+        if (onlyDependsOnField(motion_constraint))
+        {
+            const std::vector<ObstaclePtr>& new_obstacles =
+                field_obstacles[motion_constraint].get(
+                    world.fieldGeneration(),
+                    [&]()
+                    {
+                        return createObstaclesFromMotionConstraint(motion_constraint,
+                                                                   world);
+                    });
+            obstacles.insert(obstacles.end(), new_obstacles.begin(),
+                             new_obstacles.end());
+        }
+        else
+        {
+            auto new_obstacles =
+                createObstaclesFromMotionConstraint(motion_constraint, world);
+            obstacles.insert(obstacles.end(), new_obstacles.begin(),
+                             new_obstacles.end());
+        }
     }
 
     return obstacles;
 }
 
+std::vector<ObstaclePtr> RobotNavigationObstacleFactory::createFromVirtualObstacles(
+    const World& world) const
+{
+    return virtual_obstacles.get(
+        world.virtualObstaclesGeneration(),
+        [&]()
+        {
+            std::vector<ObstaclePtr> obstacles;
+            for (const TbotsProto::Obstacle& obstacle :
+                 world.getVirtualObstacles().obstacles())
+            {
+                if (!obstacle.has_polygon())
+                {
+                    LOG(WARNING) << "Virtual Obstacles contain obstacle that is not a "
+                                    "polygon. Shape ignored";
+                    continue;
+                }
+                obstacles.push_back(createFromShape(createPolygon(obstacle.polygon())));
+            }
+            return obstacles;
+        });
+}
+
+bool RobotNavigationObstacleFactory::onlyDependsOnField(
+    const TbotsProto::MotionConstraint& motion_constraint)
+{
+    return !TbotsProto::MotionConstraint_descriptor()
+                ->FindValueByNumber(motion_constraint)
+                ->options()
+                .GetExtension(TbotsProto::dynamic);
+}
+
 ObstaclePtr RobotNavigationObstacleFactory::createFromBallPosition(
     const Point& ball_position) const
 {
@@ -8,12 +8,17 @@
 #include "software/geom/point.h"
 #include "software/geom/polygon.h"
 #include "software/logger/logger.h"
+#include "software/util/memoize/memoized.hpp"
 #include "software/world/world.h"
 
 /**
  * The RobotNavigationObstacleFactory creates obstacles for navigation with a robot
  * NOTE: All obstacles created include at least an additional robot radius margin on all
  * sides of the obstacle
+ *
+ * Obstacles that only depend on the field or the virtual obstacles in the world are
+ * remembered, and shared by every robot, until the field or virtual obstacles change.
+ * The factory is therefore not thread safe.
  */
 class RobotNavigationObstacleFactory
 {
@@ -37,6 +42,16 @@ class RobotNavigationObstacleFactory
         const std::set<TbotsProto::MotionConstraint>& motion_constraints,
         const World& world) const;
 
+    /**
+     * Create obstacles for the virtual obstacles in the world. Virtual obstacles that
+     * aren't polygons are ignored.
+     *
+     * @param world World with the virtual obstacles
+     *
+     * @return Obstacles representing the virtual obstacles
+     */
+    std::vector<ObstaclePtr> createFromVirtualObstacles(const World& world) const;
+
     /**
      * Create static obstacles for the given motion constraint
      *
@@ -141,10 +156,27 @@ class RobotNavigationObstacleFactory
     ObstaclePtr createFromBallPlacement(const Point& placement_point,
                                         const Point& ball_point) const;
 
+    /**
+     * Returns whether the obstacles for a motion constraint only depend on the field,
+     * which is the case unless the motion constraint is marked as dynamic in its proto
+     *
+     * @param motion_constraint The motion constraint
+     *
+     * @return whether the obstacles for the motion constraint only depend on the field
+     */
+    static bool onlyDependsOnField(const TbotsProto::MotionConstraint& motion_constraint);
+
    private:
     TbotsProto::RobotNavigationObstacleConfig config;
     double robot_radius_expansion_amount;
 
+    // The obstacles for each motion constraint that only depends on the field, and the
+    // obstacles for the virtual obstacles, keyed on the generation they were created for
+    mutable std::map<TbotsProto::MotionConstraint,
+                     Memoized<std::vector<ObstaclePtr>, uint64_t>>
+        field_obstacles;
+    mutable Memoized<std::vector<ObstaclePtr>, uint64_t> virtual_obstacles;
+
     /**
      * Returns an obstacle for the field_rectangle expanded on all sides to account for
      * the size of the robot. If a side of the field_rectangle lies along a field line,
@@ -4,6 +4,7 @@
 
 #include <iostream>
 
+#include "proto/message_translation/tbots_geometry.h"
 #include "software/ai/navigator/obstacle/const_velocity_obstacle.hpp"
 #include "software/ai/navigator/obstacle/geom_obstacle.hpp"
 #include "software/ai/navigator/obstacle/trajectory_obstacle.hpp"
@@ -500,3 +501,70 @@ TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest, ball_placement_rotate
         ADD_FAILURE() << "Stadium Obstacle was not created";
     }
 }
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       field_obstacles_are_reused_until_the_field_changes)
+{
+    std::set<TbotsProto::MotionConstraint> motion_constraints = {
+        TbotsProto::MotionConstraint::CENTER_CIRCLE,
+        TbotsProto::MotionConstraint::HALF_METER_AROUND_BALL};
+
+    auto obstacles =
+        robot_navigation_obstacle_factory.createObstaclesFromMotionConstraints(
+            motion_constraints, *world_ptr);
+    ASSERT_EQ(2, obstacles.size());
+
+    // The centre circle only depends on the field, so the same obstacle is returned
+    world_ptr->updateBall(Ball(Point(-1, 0), Vector(), current_time));
+    auto next_obstacles =
+        robot_navigation_obstacle_factory.createObstaclesFromMotionConstraints(
+            motion_constraints, *world_ptr);
+    ASSERT_EQ(2, next_obstacles.size());
+    EXPECT_EQ(obstacles[0], next_obstacles[0]);
+    EXPECT_NE(obstacles[1], next_obstacles[1]);
+    EXPECT_TRUE(next_obstacles[1]->contains(Point(-1, 0)));
+
+    World world_on_new_field(Field::createSSLDivisionAField(), world_ptr->ball(),
+                             world_ptr->friendlyTeam(), world_ptr->enemyTeam());
+    auto new_field_obstacles =
+        robot_navigation_obstacle_factory.createObstaclesFromMotionConstraints(
+            motion_constraints, world_on_new_field);
+    ASSERT_EQ(2, new_field_obstacles.size());
+    EXPECT_NE(obstacles[0], new_field_obstacles[0]);
+}
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest, virtual_obstacles)
+{
+    TbotsProto::VirtualObstacles virtual_obstacles;
+    *virtual_obstacles.add_obstacles()->mutable_polygon() = *createPolygonProto(
+        Polygon({Point(0, 0), Point(1, 0), Point(1, 1), Point(0, 1)}));
+    // Obstacles that aren't polygons are ignored
+    virtual_obstacles.add_obstacles()->mutable_circle();
+    world_ptr->setVirtualObstacles(virtual_obstacles);
+
+    auto obstacles =
+        robot_navigation_obstacle_factory.createFromVirtualObstacles(*world_ptr);
+    ASSERT_EQ(1, obstacles.size());
+    EXPECT_TRUE(obstacles[0]->contains(Point(0.5, 0.5)));
+    EXPECT_EQ(obstacles,
+              robot_navigation_obstacle_factory.createFromVirtualObstacles(*world_ptr));
+
+    world_ptr->setVirtualObstacles(TbotsProto::VirtualObstacles());
+    EXPECT_TRUE(
+        robot_navigation_obstacle_factory.createFromVirtualObstacles(*world_ptr).empty());
+}
+
+TEST(RobotNavigationObstacleFactoryOnlyDependsOnFieldTest,
+     only_motion_constraints_that_are_not_dynamic_only_depend_on_field)
+{
+    const google::protobuf::EnumDescriptor* descriptor =
+        TbotsProto::MotionConstraint_descriptor();
+    for (int i = 0; i < descriptor->value_count(); i++)
+    {
+        const google::protobuf::EnumValueDescriptor* value = descriptor->value(i);
+        EXPECT_EQ(RobotNavigationObstacleFactory::onlyDependsOnField(
+                      static_cast<TbotsProto::MotionConstraint>(value->number())),
+                  !value->options().GetExtension(TbotsProto::dynamic))
+            << value->name();
+    }
+}
@@ -3,6 +3,7 @@
 #include "collision_evaluator.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/geom/algorithms/distance.h"
+#include "software/tracing/tracer.h"
 
 
 TrajectoryPlanner::TrajectoryPlanner()
@@ -60,6 +61,8 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
     const KinematicConstraints& constraints, const std::vector<ObstaclePtr>& obstacles,
     const Rectangle& navigable_area, const std::optional<Point>& prev_sub_destination)
 {
+    TRACE_ZONE("TrajectoryPlanner: findTrajectory");
+
     if (constraints.getMaxVelocity() <= 0.0 || constraints.getMaxAcceleration() <= 0.0 ||
         constraints.getMaxDeceleration() <= 0.0)
     {
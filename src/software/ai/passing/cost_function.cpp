@@ -6,7 +6,6 @@
 #include "proto/parameters.pb.h"
 #include "software/../shared/constants.h"
 #include "software/ai/evaluation/calc_best_shot.h"
-#include "software/ai/evaluation/time_to_travel.h"
 #include "software/ai/passing/eighteen_zone_pitch_division.h"
 #include "software/geom/algorithms/closest_point.h"
 #include "software/geom/algorithms/contains.h"
@@ -16,6 +15,15 @@
 
 double ratePass(const World& world, const Pass& pass,
                 const TbotsProto::PassingConfig& passing_config)
+{
+    return ratePass(world, TeamReachabilityModel(world.friendlyTeam()),
+                    createEnemyReachabilityModel(world.enemyTeam()), pass,
+                    passing_config);
+}
+
+double ratePass(const World& world, const TeamReachabilityModel& friendly_reachability,
+                const TeamReachabilityModel& enemy_reachability, const Pass& pass,
+                const TbotsProto::PassingConfig& passing_config)
 {
     double static_pass_quality =
         getStaticPositionQuality(world.field(), pass.receiverPoint(), passing_config);
@@ -23,11 +31,12 @@ double ratePass(const World& world, const Pass& pass,
     double receiver_not_too_close_rating = ratePassNotTooClose(pass, passing_config);
 
     double friendly_pass_rating =
-        ratePassFriendlyCapability(world.friendlyTeam(), pass, passing_config);
+        ratePassFriendlyCapability(friendly_reachability, pass, passing_config);
 
     double pass_forward_rating = ratePassForwardQuality(pass, passing_config);
 
-    double enemy_pass_rating = ratePassEnemyRisk(world.enemyTeam(), pass, passing_config);
+    double enemy_pass_rating =
+        ratePassEnemyRisk(world.enemyTeam(), enemy_reachability, pass, passing_config);
 
     double shoot_pass_rating =
         ratePassShootScore(world.field(), world.enemyTeam(), pass, passing_config);
@@ -118,88 +127,130 @@ double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass
 
 double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
                          const TbotsProto::PassingConfig& passing_config)
+{
+    return ratePassEnemyRisk(enemy_team, createEnemyReachabilityModel(enemy_team), pass,
+                             passing_config);
+}
+
+double ratePassEnemyRisk(const Team& enemy_team,
+                         const TeamReachabilityModel& enemy_reachability,
+                         const Pass& pass,
+                         const TbotsProto::PassingConfig& passing_config)
 {
     double enemy_receiver_proximity_risk =
         calculateProximityRisk(pass.receiverPoint(), enemy_team, passing_config);
-    double intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_config);
+    double intercept_risk =
+        calculateInterceptRisk(enemy_reachability, pass, passing_config);
 
     // We want to rate a pass more highly if it is lower risk, so subtract from 1
     return 1 - std::max(intercept_risk, enemy_receiver_proximity_risk);
 }
 
+TeamReachabilityModel createEnemyReachabilityModel(const Team& enemy_team)
+{
+    // We don't know the limits of the enemy robots, so we assume they are all the same
+    return TeamReachabilityModel(enemy_team, ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND,
+                                 ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED);
+}
+
 double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
                               const TbotsProto::PassingConfig& passing_config)
+{
+    return calculateInterceptRisk(createEnemyReachabilityModel(enemy_team), pass,
+                                  passing_config);
+}
+
+double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
+                              const TbotsProto::PassingConfig& passing_config)
+{
+    return calculateInterceptRisk(
+        TeamReachabilityModel({enemy_robot}, ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND,
+                              ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED),
+        pass, passing_config);
+}
+
+double calculateInterceptRisk(const TeamReachabilityModel& enemy_reachability,
+                              const Pass& pass,
+                              const TbotsProto::PassingConfig& passing_config)
 {
     // Return the highest risk for all the enemy robots, if there are any
-    const std::vector<Robot>& enemy_robots = enemy_team.getAllRobots();
+    const std::vector<Robot>& enemy_robots = enemy_reachability.getRobots();
     if (enemy_robots.empty())
     {
         return 0;
     }
-    std::vector<double> enemy_intercept_risks(enemy_robots.size());
-    std::transform(enemy_robots.begin(), enemy_robots.end(),
-                   enemy_intercept_risks.begin(),
-                   [&](const Robot& robot)
-                   { return calculateInterceptRisk(robot, pass, passing_config); });
-    return *std::max_element(enemy_intercept_risks.begin(), enemy_intercept_risks.end());
-}
 
-double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
-                              const TbotsProto::PassingConfig& passing_config)
-{
     // Return early to avoid division by zero
     if (pass.speed() == 0)
     {
         return 1.0;
     }
 
-    // We estimate the intercept by the risk that the enemy robot will get to the closest
-    // point on the pass before the ball
-    Point closest_interception_point = closestPoint(
-        enemy_robot.position(), Segment(pass.passerPoint(), pass.receiverPoint()));
-    Vector enemy_interception_vector =
-        closest_interception_point - enemy_robot.position();
-    // Take into account the enemy robot's radius for minimum min_interception_distance
-    // required to travel to intercept the pass.
-    double min_interception_distance =
-        std::max(0.0, enemy_interception_vector.length() - ROBOT_MAX_RADIUS_METERS);
+    // We estimate the intercept by the risk that each enemy robot will get to the
+    // closest point on the pass before the ball
+    Segment pass_segment(pass.passerPoint(), pass.receiverPoint());
+    std::vector<Point> closest_interception_points;
+    closest_interception_points.reserve(enemy_robots.size());
+    for (const Robot& enemy_robot : enemy_robots)
+    {
+        closest_interception_points.push_back(
+            closestPoint(enemy_robot.position(), pass_segment));
+    }
 
+    // Take into account the enemy robot's radius for minimum distance required to
+    // travel to intercept the pass.
     const double ENEMY_ROBOT_INTERCEPTION_SPEED_METERS_PER_SECOND = 0.5;
-    double signed_1d_enemy_vel =
-        enemy_robot.velocity().dot(enemy_interception_vector.normalize());
-    double enemy_robot_time_to_interception_point_sec =
-        getTimeToTravelDistance(
-            min_interception_distance, ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND,
-            ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED, signed_1d_enemy_vel,
-            ENEMY_ROBOT_INTERCEPTION_SPEED_METERS_PER_SECOND)
-            .toSeconds();
-    // Scale the time to interception point by the enemy robot's interception capability
-    Duration enemy_robot_time_to_interception_point =
-        Duration::fromSeconds(enemy_robot_time_to_interception_point_sec *
-                              passing_config.enemy_interception_time_multiplier());
+    std::vector<double> enemy_robot_times_to_interception_points_sec =
+        enemy_reachability.getTimesToPositions(
+            closest_interception_points,
+            ENEMY_ROBOT_INTERCEPTION_SPEED_METERS_PER_SECOND, ROBOT_MAX_RADIUS_METERS);
 
-    // TODO (#2988): We should generate a more realistic ball trajectory
-    Duration ball_time_to_interception_point =
-        Duration::fromSeconds(distance(pass.passerPoint(), closest_interception_point) /
-                              pass.speed()) +
-        Duration::fromSeconds(passing_config.pass_delay_sec());
-
-    Duration interception_delta_time =
-        ball_time_to_interception_point - enemy_robot_time_to_interception_point;
-
-    // Whether or not the enemy will be able to intercept the pass can be determined
-    // by whether or not they will be able to reach the pass receive position before
-    // the pass does.
-    return std::clamp(interception_delta_time.toSeconds() *
-                          passing_config.enemy_interception_risk_importance(),
-                      0.0, 1.0);
+    double max_intercept_risk = 0;
+    for (size_t i = 0; i < enemy_robots.size(); i++)
+    {
+        // Scale the time to interception point by the enemy robot's interception
+        // capability
+        Duration enemy_robot_time_to_interception_point =
+            Duration::fromSeconds(enemy_robot_times_to_interception_points_sec[i] *
+                                  passing_config.enemy_interception_time_multiplier());
+
+        // TODO (#2988): We should generate a more realistic ball trajectory
+        Duration ball_time_to_interception_point =
+            Duration::fromSeconds(
+                distance(pass.passerPoint(), closest_interception_points[i]) /
+                pass.speed()) +
+            Duration::fromSeconds(passing_config.pass_delay_sec());
+
+        Duration interception_delta_time =
+            ball_time_to_interception_point - enemy_robot_time_to_interception_point;
+
+        // Whether or not the enemy will be able to intercept the pass can be
+        // determined by whether or not they will be able to reach the pass receive
+        // position before the pass does.
+        double intercept_risk =
+            std::clamp(interception_delta_time.toSeconds() *
+                           passing_config.enemy_interception_risk_importance(),
+                       0.0, 1.0);
+        max_intercept_risk = std::max(max_intercept_risk, intercept_risk);
+    }
+    return max_intercept_risk;
 }
 
 double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
                                   const TbotsProto::PassingConfig& passing_config)
+{
+    return ratePassFriendlyCapability(TeamReachabilityModel(friendly_team), pass,
+                                      passing_config);
+}
+
+double ratePassFriendlyCapability(const TeamReachabilityModel& friendly_reachability,
+                                  const Pass& pass,
+                                  const TbotsProto::PassingConfig& passing_config)
 {
     // We need at least one robot to pass to
-    if (friendly_team.getAllRobots().empty())
+    auto earliest_arrival =
+        friendly_reachability.getEarliestRobotToPosition(pass.receiverPoint());
+    if (!earliest_arrival)
     {
         return 0;
     }
@@ -210,18 +261,9 @@ double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
         return 0;
     }
 
-    // Get the robot that is closest to where the pass would be received
-    Robot best_receiver = friendly_team.getAllRobots()[0];
-    for (const Robot& robot : friendly_team.getAllRobots())
-    {
-        double distance = (robot.position() - pass.receiverPoint()).length();
-        double curr_best_distance =
-            (best_receiver.position() - pass.receiverPoint()).length();
-        if (distance < curr_best_distance)
-        {
-            best_receiver = robot;
-        }
-    }
+    // Get the robot that can get to where the pass would be received the soonest
+    const auto& [best_receiver_index, min_robot_travel_time] = earliest_arrival.value();
+    const Robot& best_receiver = friendly_reachability.getRobots()[best_receiver_index];
 
     // Figure out what time the robot would have to receive the ball at
     // TODO (#2988): We should generate a more realistic ball trajectory
@@ -232,8 +274,6 @@ double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
     Timestamp receive_time = best_receiver.timestamp() + ball_travel_time;
 
     // Figure out how long it would take our robot to get there
-    Duration min_robot_travel_time =
-        best_receiver.getTimeToPosition(pass.receiverPoint());
     Timestamp earliest_time_to_receive_point =
         best_receiver.timestamp() + min_robot_travel_time;
 
@@ -360,6 +400,12 @@ void samplePassesForVisualization(const World& world,
     double width  = world.field().xLength() / num_cols;
     double height = world.field().yLength() / num_rows;
 
+    // The robots don't move while we sample, so their reachability is shared by all
+    // the sampled passes
+    TeamReachabilityModel friendly_reachability(world.friendlyTeam());
+    TeamReachabilityModel enemy_reachability =
+        createEnemyReachabilityModel(world.enemyTeam());
+
     std::vector<double> costs;
     double static_pos_quality_costs;
     double pass_friendly_capability_costs;
@@ -420,14 +466,14 @@ void samplePassesForVisualization(const World& world,
             if (passing_config.cost_vis_config().pass_friendly_capability())
             {
                 pass_friendly_capability_costs = ratePassFriendlyCapability(
-                    world.friendlyTeam(), pass, passing_config);
+                    friendly_reachability, pass, passing_config);
             }
 
             // ratePassEnemyRisk
             if (passing_config.cost_vis_config().pass_enemy_risk())
             {
-                pass_enemy_risk_costs =
-                    ratePassEnemyRisk(world.enemyTeam(), pass, passing_config);
+                pass_enemy_risk_costs = ratePassEnemyRisk(
+                    world.enemyTeam(), enemy_reachability, pass, passing_config);
             }
 
             // ratePassShootScore
@@ -441,7 +487,7 @@ void samplePassesForVisualization(const World& world,
             if (passing_config.cost_vis_config().enemy_interception_risk())
             {
                 enemy_interception_costs =
-                    calculateInterceptRisk(world.enemyTeam(), pass, passing_config);
+                    calculateInterceptRisk(enemy_reachability, pass, passing_config);
             }
 
             // calculateProximityRisk
@@ -475,5 +521,5 @@ void samplePassesForVisualization(const World& world,
         }
     }
 
-    LOG(VISUALIZE) << *createCostVisualization(costs, num_rows, num_cols);
+    Visualizer::publish(*createCostVisualization(costs, num_rows, num_cols));
 }
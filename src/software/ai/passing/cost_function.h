@@ -4,6 +4,7 @@
 
 #include "proto/message_translation/tbots_protobuf.h"
 #include "proto/parameters.pb.h"
+#include "software/ai/evaluation/team_reachability_model.h"
 #include "software/ai/passing/pass.h"
 #include "software/math/math_functions.h"
 #include "software/util/make_enum/make_enum.hpp"
@@ -24,6 +25,24 @@
 double ratePass(const World& world, const Pass& pass,
                 const TbotsProto::PassingConfig& passing_config);
 
+/**
+ * Calculate the quality of a given pass, reusing reachability models of both teams
+ * that were created once for the current world
+ *
+ * @param world The world in which to rate the pass
+ * @param friendly_reachability The reachability model of the friendly team
+ * @param enemy_reachability The reachability model of the enemy team, as created by
+ * createEnemyReachabilityModel
+ * @param pass The pass to rate
+ * @param passing_config The passing config used for tuning
+ *
+ * @return A value in [0,1] representing the quality of the pass, with 1 being an
+ *         ideal pass, and 0 being the worst pass possible
+ */
+double ratePass(const World& world, const TeamReachabilityModel& friendly_reachability,
+                const TeamReachabilityModel& enemy_reachability, const Pass& pass,
+                const TbotsProto::PassingConfig& passing_config);
+
 /**
  * Rate a pass based on the quality of the receiving position
  *
@@ -79,6 +98,37 @@ double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass
 double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
                          const TbotsProto::PassingConfig& passing_config);
 
+/**
+ * Calculates the risk of an enemy robot interfering with a given pass, reusing a
+ * reachability model of the enemy team
+ *
+ * @param enemy_team The team of enemy robots
+ * @param enemy_reachability The reachability model of the enemy team, as created by
+ * createEnemyReachabilityModel
+ * @param pass The pass to rate
+ * @param passing_config The passing config used for tuning
+ * @return A value in [0,1] indicating the quality of the pass based on the risk
+ *         that an enemy interfere with it, with 1 indicating the pass is guaranteed
+ *         to run without interference, and 0 indicating that the pass will certainly
+ *         be interfered with (and so is very poor)
+ */
+double ratePassEnemyRisk(const Team& enemy_team,
+                         const TeamReachabilityModel& enemy_reachability,
+                         const Pass& pass,
+                         const TbotsProto::PassingConfig& passing_config);
+
+/**
+ * Creates the reachability model used to estimate how quickly enemy robots can
+ * intercept a pass. We don't know the enemy robots' limits, so they are all assumed to
+ * move at ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND and
+ * ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED.
+ *
+ * @param enemy_team The team of enemy robots
+ *
+ * @return the reachability model of the enemy team
+ */
+TeamReachabilityModel createEnemyReachabilityModel(const Team& enemy_team);
+
 /**
  * Rate the pass based on if it moves the ball up the field or not
  * Passes moving the ball up the field are rated higher
@@ -131,6 +181,22 @@ double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
 double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
                               const TbotsProto::PassingConfig& passing_config);
 
+/**
+ * Calculates the likelihood that the given pass will be intercepted by any of the
+ * robots in a reachability model
+ *
+ * @param enemy_reachability The reachability model of the robots that might
+ * intercept our pass, as created by createEnemyReachabilityModel
+ * @param pass The pass we want to get the intercept probability for
+ * @param passing_config The passing config used for tuning
+ * @return A value in [0,1] indicating the probability that the given pass will be
+ *         intercepted, with 1 indicating the pass is guaranteed to be intercepted,
+ *         and 0 indicating it's impossible for the pass to be intercepted
+ */
+double calculateInterceptRisk(const TeamReachabilityModel& enemy_reachability,
+                              const Pass& pass,
+                              const TbotsProto::PassingConfig& passing_config);
+
 
 /**
  * Calculate the probability of a friendly robot receiving the given pass
@@ -149,6 +215,26 @@ double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
 double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
                                   const TbotsProto::PassingConfig& passing_config);
 
+/**
+ * Calculate the probability of a friendly robot receiving the given pass, reusing a
+ * reachability model of the friendly team
+ *
+ * The robot that can get to the pass reception point the soonest is assumed to
+ * receive the pass
+ *
+ * @param friendly_reachability The reachability model of the robots that might
+ * receive the given pass
+ * @param pass The pass we want a robot to receive
+ * @param passing_config The passing config used for tuning
+ *
+ * @return A value in [0,1] indicating how likely it would be for a robot on the
+ *         friendly team to receive the given pass, with 1 being very likely, 0
+ *         being impossible
+ */
+double ratePassFriendlyCapability(const TeamReachabilityModel& friendly_reachability,
+                                  const Pass& pass,
+                                  const TbotsProto::PassingConfig& passing_config);
+
 /**
  * Calculates the static position quality for a given position on a given field
  *
@@ -4,6 +4,7 @@
 
 #include "software/geom/algorithms/contains.h"
 #include "software/logger/logger.h"
+#include "software/tracing/tracer.h"
 
 PassGenerator::PassGenerator(const TbotsProto::PassingConfig& passing_config)
     : optimizer_(optimizer_param_weights),
@@ -15,6 +16,8 @@ PassGenerator::PassGenerator(const TbotsProto::PassingConfig& passing_config)
 PassWithRating PassGenerator::getBestPass(const World& world,
                                           const std::vector<RobotId>& robots_to_ignore)
 {
+    TRACE_ZONE("PassGenerator: getBestPass");
+
     auto receiving_positions_map =
         sampleReceivingPositionsPerRobot(world, robots_to_ignore);
 
@@ -47,7 +50,7 @@ PassWithRating PassGenerator::getBestPass(const World& world,
         debug_shapes.push_back(
             *createDebugShape(Circle(best_pass.pass.receiverPoint(), 0.05),
                               std::to_string(debug_shapes.size()) + "pg", stream.str()));
-        LOG(VISUALIZE) << *createDebugShapes(debug_shapes);
+        Visualizer::publish(*createDebugShapes(debug_shapes));
     }
 
     // Generate sample passes across the field for cost visualization
@@ -124,11 +127,17 @@ PassWithRating PassGenerator::optimizeReceivingPositions(
 {
     // The objective function we minimize in gradient descent to improve each pass
     // that we're optimizing
+    // The world doesn't change while we optimize, so both teams' reachability is
+    // shared by every pass we rate
+    const TeamReachabilityModel friendly_reachability(world.friendlyTeam());
+    const TeamReachabilityModel enemy_reachability =
+        createEnemyReachabilityModel(world.enemyTeam());
     const auto objective_function =
-        [this, &world](const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& pass_array)
+        [this, &world, &friendly_reachability, &enemy_reachability](
+            const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& pass_array)
     {
         // get a pass with the new appropriate speed using the new destination
-        return ratePass(world,
+        return ratePass(world, friendly_reachability, enemy_reachability,
                         Pass::fromDestReceiveSpeed(world.ball().position(),
                                                    Point(pass_array[0], pass_array[1]),
                                                    passing_config_),
@@ -150,7 +159,8 @@ PassWithRating PassGenerator::optimizeReceivingPositions(
                 world.ball().position(),
                 Point(optimized_receiving_pos_array[0], optimized_receiving_pos_array[1]),
                 passing_config_);
-            double score = ratePass(world, optimized_pass, passing_config_);
+            double score = ratePass(world, friendly_reachability, enemy_reachability,
+                                    optimized_pass, passing_config_);
 
             if (score > best_pass_for_robot.rating)
             {
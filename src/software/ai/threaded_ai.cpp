@@ -42,7 +42,7 @@ void ThreadedAi::overrideTactics(
     play->updateControlParams(tactic_assignment_map);
     ai.overridePlay(std::move(play));
 
-    LOG(VISUALIZE) << ai.getPlayInfo();
+    Visualizer::publish(ai.getPlayInfo());
 }
 
 void ThreadedAi::onValueReceived(World world)
@@ -67,11 +67,18 @@ void ThreadedAi::runAiAndSendPrimitives(const WorldPtr& world_ptr)
     std::scoped_lock lock(ai_mutex);
     if (ai_control_config.run_ai())
     {
-        auto new_primitives = ai.getPrimitives(world_ptr);
+        const double ai_start_time = getCurrentEpochTimeSeconds();
+        auto new_primitives        = ai.getPrimitives(world_ptr);
+
+        TbotsProto::PipelineLatencyTrace* latency_trace =
+            new_primitives->mutable_latency_trace();
+        *latency_trace = world_ptr->getLatencyTrace();
+        latency_trace->set_ai_start_time(ai_start_time);
+        latency_trace->set_ai_end_time(getCurrentEpochTimeSeconds());
 
         TbotsProto::PlayInfo play_info_msg = ai.getPlayInfo();
 
-        LOG(VISUALIZE) << play_info_msg;
+        Visualizer::publish(play_info_msg);
 
         Subject<TbotsProto::PlayInfo>::sendValueToObservers(play_info_msg);
 
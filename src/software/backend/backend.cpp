@@ -8,33 +8,38 @@
 void Backend::receiveRobotStatus(TbotsProto::RobotStatus msg)
 {
     SensorProto sensor_msg;
-    *(sensor_msg.add_robot_status_msgs())         = msg;
+    *(sensor_msg.add_robot_status_msgs())         = std::move(msg);
     *(sensor_msg.mutable_backend_received_time()) = *createCurrentTimestamp();
-    Subject<SensorProto>::sendValueToObservers(sensor_msg);
+    Subject<SensorProto>::sendValueToObservers(std::move(sensor_msg));
 }
 
 void Backend::receiveSSLWrapperPacket(SSLProto::SSL_WrapperPacket msg)
 {
     SensorProto sensor_msg;
-    *(sensor_msg.mutable_ssl_vision_msg())        = msg;
+    *(sensor_msg.mutable_ssl_vision_msg())        = std::move(msg);
     *(sensor_msg.mutable_backend_received_time()) = *createCurrentTimestamp();
-    Subject<SensorProto>::sendValueToObservers(sensor_msg);
+    Subject<SensorProto>::sendValueToObservers(std::move(sensor_msg));
 }
 
 void Backend::receiveSSLReferee(SSLProto::Referee msg)
 {
     SensorProto sensor_msg;
-    *(sensor_msg.mutable_ssl_referee_msg())       = msg;
+    *(sensor_msg.mutable_ssl_referee_msg())       = std::move(msg);
     *(sensor_msg.mutable_backend_received_time()) = *createCurrentTimestamp();
-    Subject<SensorProto>::sendValueToObservers(sensor_msg);
+    Subject<SensorProto>::sendValueToObservers(std::move(sensor_msg));
 }
 
 void Backend::receiveSensorProto(SensorProto sensor_msg)
 {
-    Subject<SensorProto>::sendValueToObservers(sensor_msg);
+    if (!sensor_msg.has_backend_received_time())
+    {
+        *(sensor_msg.mutable_backend_received_time()) = *createCurrentTimestamp();
+    }
+    Subject<SensorProto>::sendValueToObservers(std::move(sensor_msg));
 }
 
 void Backend::receiveObstacleList(TbotsProto::VirtualObstacles new_obstacle_list)
 {
-    Subject<TbotsProto::VirtualObstacles>::sendValueToObservers(new_obstacle_list);
+    Subject<TbotsProto::VirtualObstacles>::sendValueToObservers(
+        std::move(new_obstacle_list));
 }
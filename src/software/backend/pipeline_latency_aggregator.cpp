@@ -0,0 +1,111 @@
+#include "software/backend/pipeline_latency_aggregator.h"
+
+#include <algorithm>
+#include <cmath>
+
+PipelineLatencyAggregator::PipelineLatencyAggregator(double report_period_s)
+    : report_period_s(report_period_s), period_start_time(), stage_latencies_ms()
+{
+}
+
+std::optional<TbotsProto::PipelineLatencyStatistics>
+PipelineLatencyAggregator::addPrimitiveSet(const TbotsProto::PrimitiveSet& primitive_set)
+{
+    for (size_t i = 0; i < STAGES.size(); i++)
+    {
+        const double start_time = STAGES[i].start_time(primitive_set);
+        const double end_time   = STAGES[i].end_time(primitive_set);
+        // Unset times are 0, and the system clock can jump backwards
+        if (start_time > 0.0 && end_time >= start_time)
+        {
+            stage_latencies_ms[i].push_back((end_time - start_time) * 1000.0);
+        }
+    }
+
+    const double sent_time = sentTime(primitive_set);
+    if (!period_start_time)
+    {
+        period_start_time = sent_time;
+    }
+    if (sent_time - *period_start_time < report_period_s)
+    {
+        return std::nullopt;
+    }
+
+    TbotsProto::PipelineLatencyStatistics statistics;
+    statistics.set_period_start_time(*period_start_time);
+    statistics.set_period_end_time(sent_time);
+    for (size_t i = 0; i < STAGES.size(); i++)
+    {
+        if (!stage_latencies_ms[i].empty())
+        {
+            *statistics.add_histograms() =
+                createHistogram(STAGES[i], stage_latencies_ms[i]);
+            stage_latencies_ms[i].clear();
+        }
+    }
+    period_start_time = sent_time;
+    return statistics;
+}
+
+double PipelineLatencyAggregator::sensorReceivedTime(
+    const TbotsProto::PrimitiveSet& primitive_set)
+{
+    return primitive_set.latency_trace().sensor_received_time();
+}
+
+double PipelineLatencyAggregator::sensorFusionDoneTime(
+    const TbotsProto::PrimitiveSet& primitive_set)
+{
+    return primitive_set.latency_trace().sensor_fusion_done_time();
+}
+
+double PipelineLatencyAggregator::aiStartTime(
+    const TbotsProto::PrimitiveSet& primitive_set)
+{
+    return primitive_set.latency_trace().ai_start_time();
+}
+
+double PipelineLatencyAggregator::aiEndTime(
+    const TbotsProto::PrimitiveSet& primitive_set)
+{
+    return primitive_set.latency_trace().ai_end_time();
+}
+
+double PipelineLatencyAggregator::sentTime(
+    const TbotsProto::PrimitiveSet& primitive_set)
+{
+    return primitive_set.time_sent().epoch_timestamp_seconds();
+}
+
+TbotsProto::LatencyHistogram PipelineLatencyAggregator::createHistogram(
+    const Stage& stage, std::vector<double>& latencies_ms)
+{
+    TbotsProto::LatencyHistogram histogram;
+    histogram.set_stage(stage.name);
+    histogram.mutable_bucket_upper_bounds_ms()->Add(BUCKET_UPPER_BOUNDS_MS.begin(),
+                                                    BUCKET_UPPER_BOUNDS_MS.end());
+    histogram.mutable_bucket_counts()->Resize(BUCKET_UPPER_BOUNDS_MS.size() + 1, 0);
+    for (double latency_ms : latencies_ms)
+    {
+        const int bucket = static_cast<int>(
+            std::lower_bound(BUCKET_UPPER_BOUNDS_MS.begin(), BUCKET_UPPER_BOUNDS_MS.end(),
+                             latency_ms) -
+            BUCKET_UPPER_BOUNDS_MS.begin());
+        histogram.set_bucket_counts(bucket, histogram.bucket_counts(bucket) + 1);
+    }
+
+    // The percentiles are nearest-rank percentiles of the exact latencies
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    auto percentile = [&](double fraction)
+    {
+        const auto rank = static_cast<size_t>(
+            std::ceil(fraction * static_cast<double>(latencies_ms.size())));
+        return latencies_ms[std::max<size_t>(rank, 1) - 1];
+    };
+    histogram.set_num_samples(latencies_ms.size());
+    histogram.set_p50_ms(percentile(0.5));
+    histogram.set_p99_ms(percentile(0.99));
+    histogram.set_max_ms(latencies_ms.back());
+    return histogram;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "proto/tbots_software_msgs.pb.h"
+#include "proto/visualization.pb.h"
+
+/**
+ * Collects the latency traces of the primitive sets full system sends, and summarizes
+ * the latency of each stage of the pipeline as a histogram once per report period.
+ */
+class PipelineLatencyAggregator
+{
+   public:
+    /**
+     * Creates a PipelineLatencyAggregator
+     *
+     * @param report_period_s How often to summarize the latencies, in seconds
+     */
+    explicit PipelineLatencyAggregator(double report_period_s = 1.0);
+
+    /**
+     * Adds the latency trace of a primitive set that was sent, whose last stage ends at
+     * the time the primitive set was sent. Stages whose start or end time wasn't traced
+     * are skipped.
+     *
+     * @param primitive_set The primitive set that was sent
+     *
+     * @return the latencies since the last report, if a report period has passed since
+     * then, according to the time the primitive set was sent
+     */
+    std::optional<TbotsProto::PipelineLatencyStatistics> addPrimitiveSet(
+        const TbotsProto::PrimitiveSet& primitive_set);
+
+    // The stage from receiving a vision packet to sending the primitives for it
+    static constexpr const char* VISION_TO_COMMAND_STAGE = "Vision to Command";
+
+    static constexpr std::array<double, 19> BUCKET_UPPER_BOUNDS_MS = {
+        1, 2, 3, 4, 5, 6, 8, 10, 12, 15, 20, 25, 30, 40, 50, 75, 100, 150, 200};
+
+   private:
+    using TraceTime = double (*)(const TbotsProto::PrimitiveSet& primitive_set);
+
+    /**
+     * A stage of the pipeline, which starts and ends at times in the latency trace of a
+     * primitive set or at the time it was sent
+     */
+    struct Stage
+    {
+        const char* name;
+        TraceTime start_time;
+        TraceTime end_time;
+    };
+
+    static double sensorReceivedTime(const TbotsProto::PrimitiveSet& primitive_set);
+    static double sensorFusionDoneTime(const TbotsProto::PrimitiveSet& primitive_set);
+    static double aiStartTime(const TbotsProto::PrimitiveSet& primitive_set);
+    static double aiEndTime(const TbotsProto::PrimitiveSet& primitive_set);
+    static double sentTime(const TbotsProto::PrimitiveSet& primitive_set);
+
+    static constexpr std::array<Stage, 5> STAGES = {{
+        {"Sensor Fusion", &sensorReceivedTime, &sensorFusionDoneTime},
+        {"AI Queue", &sensorFusionDoneTime, &aiStartTime},
+        {"AI", &aiStartTime, &aiEndTime},
+        {"Send Queue", &aiEndTime, &sentTime},
+        {VISION_TO_COMMAND_STAGE, &sensorReceivedTime, &sentTime},
+    }};
+
+    /**
+     * Summarizes the latencies of a stage as a histogram
+     *
+     * @param stage The stage
+     * @param latencies_ms The latencies of the stage, which are reordered
+     *
+     * @return the histogram
+     */
+    static TbotsProto::LatencyHistogram createHistogram(
+        const Stage& stage, std::vector<double>& latencies_ms);
+
+    const double report_period_s;
+    std::optional<double> period_start_time;
+    // The latencies of each stage since the last report, indexed like STAGES
+    std::array<std::vector<double>, STAGES.size()> stage_latencies_ms;
+};
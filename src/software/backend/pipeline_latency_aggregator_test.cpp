@@ -0,0 +1,108 @@
+#include "software/backend/pipeline_latency_aggregator.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    TbotsProto::PrimitiveSet createPrimitiveSet(double sensor_received_time,
+                                                double sent_time)
+    {
+        TbotsProto::PrimitiveSet primitive_set;
+        primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(sent_time);
+        TbotsProto::PipelineLatencyTrace* latency_trace =
+            primitive_set.mutable_latency_trace();
+        latency_trace->set_sensor_received_time(sensor_received_time);
+        latency_trace->set_sensor_fusion_done_time(sensor_received_time + 0.001);
+        latency_trace->set_ai_start_time(sensor_received_time + 0.002);
+        latency_trace->set_ai_end_time(sent_time - 0.001);
+        return primitive_set;
+    }
+}  // namespace
+
+TEST(PipelineLatencyAggregatorTest, test_nothing_is_reported_within_a_report_period)
+{
+    PipelineLatencyAggregator aggregator(1.0);
+    EXPECT_FALSE(aggregator.addPrimitiveSet(createPrimitiveSet(100.0, 100.01)));
+    EXPECT_FALSE(aggregator.addPrimitiveSet(createPrimitiveSet(100.5, 100.51)));
+}
+
+TEST(PipelineLatencyAggregatorTest, test_report_has_histograms_and_percentiles)
+{
+    PipelineLatencyAggregator aggregator(1.0);
+
+    // Start the report period with a primitive set that has nothing to report
+    TbotsProto::PrimitiveSet untraced_primitive_set;
+    untraced_primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(100.0);
+    EXPECT_FALSE(aggregator.addPrimitiveSet(untraced_primitive_set));
+
+    // 100 traces over a second whose vision to command latencies are 0.5 to 99.5 ms,
+    // so none of them are on the bounds of a bucket
+    std::optional<TbotsProto::PipelineLatencyStatistics> statistics;
+    for (int i = 1; i <= 100; i++)
+    {
+        const double sent_time = 100.0 + i / 100.0;
+        const double latency_s = (i - 0.5) / 1000.0;
+
+        statistics = aggregator.addPrimitiveSet(
+            createPrimitiveSet(sent_time - latency_s, sent_time));
+        if (i < 100)
+        {
+            EXPECT_FALSE(statistics);
+        }
+    }
+    ASSERT_TRUE(statistics);
+    EXPECT_DOUBLE_EQ(statistics->period_start_time(), 100.0);
+    EXPECT_DOUBLE_EQ(statistics->period_end_time(), 101.0);
+
+    const auto vision_to_command =
+        std::find_if(statistics->histograms().begin(), statistics->histograms().end(),
+                     [](const TbotsProto::LatencyHistogram& histogram)
+                     {
+                         return histogram.stage() ==
+                                PipelineLatencyAggregator::VISION_TO_COMMAND_STAGE;
+                     });
+    ASSERT_NE(vision_to_command, statistics->histograms().end());
+    EXPECT_EQ(vision_to_command->num_samples(), 100);
+    EXPECT_NEAR(vision_to_command->p50_ms(), 49.5, 1e-6);
+    EXPECT_NEAR(vision_to_command->p99_ms(), 98.5, 1e-6);
+    EXPECT_NEAR(vision_to_command->max_ms(), 99.5, 1e-6);
+
+    ASSERT_EQ(vision_to_command->bucket_counts_size(),
+              vision_to_command->bucket_upper_bounds_ms_size() + 1);
+    uint64_t num_counted = 0;
+    for (uint64_t bucket_count : vision_to_command->bucket_counts())
+    {
+        num_counted += bucket_count;
+    }
+    EXPECT_EQ(num_counted, 100);
+    // Latencies in (75, 100] ms
+    EXPECT_EQ(vision_to_command->bucket_counts(16), 25);
+    EXPECT_EQ(vision_to_command->bucket_counts(
+                  vision_to_command->bucket_counts_size() - 1),
+              0);
+}
+
+TEST(PipelineLatencyAggregatorTest, test_untraced_stages_are_skipped)
+{
+    PipelineLatencyAggregator aggregator(1.0);
+
+    // A primitive set from an AI that ran without a world from sensor fusion
+    TbotsProto::PrimitiveSet primitive_set;
+    primitive_set.mutable_latency_trace()->set_ai_start_time(100.0);
+    primitive_set.mutable_latency_trace()->set_ai_end_time(100.005);
+    primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(100.006);
+    EXPECT_FALSE(aggregator.addPrimitiveSet(primitive_set));
+
+    primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(101.5);
+    std::optional<TbotsProto::PipelineLatencyStatistics> statistics =
+        aggregator.addPrimitiveSet(primitive_set);
+    ASSERT_TRUE(statistics);
+    ASSERT_EQ(statistics->histograms_size(), 2);
+    EXPECT_EQ(statistics->histograms(0).stage(), "AI");
+    EXPECT_EQ(statistics->histograms(0).num_samples(), 2);
+    EXPECT_EQ(statistics->histograms(1).stage(), "Send Queue");
+
+    // The next period starts empty
+    primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(101.6);
+    EXPECT_FALSE(aggregator.addPrimitiveSet(primitive_set));
+}
@@ -19,20 +19,23 @@ UnixSimulatorBackend::UnixSimulatorBackend(
     // Protobuf Inputs
     robot_status_input.reset(new ThreadedProtoUnixListener<TbotsProto::RobotStatus>(
         runtime_dir + ROBOT_STATUS_PATH,
-        [&](TbotsProto::RobotStatus& msg) { receiveRobotStatus(msg); }, proto_logger));
+        [&](TbotsProto::RobotStatus& msg) { receiveRobotStatus(std::move(msg)); },
+        proto_logger));
 
     ssl_wrapper_input.reset(new ThreadedProtoUnixListener<SSLProto::SSL_WrapperPacket>(
         runtime_dir + SSL_WRAPPER_PATH,
-        [&](SSLProto::SSL_WrapperPacket& msg) { receiveSSLWrapperPacket(msg); },
+        [&](SSLProto::SSL_WrapperPacket& msg)
+        { receiveSSLWrapperPacket(std::move(msg)); },
         proto_logger));
 
     ssl_referee_input.reset(new ThreadedProtoUnixListener<SSLProto::Referee>(
         runtime_dir + SSL_REFEREE_PATH,
-        [&](SSLProto::Referee& msg) { receiveSSLReferee(msg); }, proto_logger));
+        [&](SSLProto::Referee& msg) { receiveSSLReferee(std::move(msg)); },
+        proto_logger));
 
     sensor_proto_input.reset(new ThreadedProtoUnixListener<SensorProto>(
         runtime_dir + SENSOR_PROTO_PATH,
-        [&](SensorProto& msg) { receiveSensorProto(msg); }, proto_logger));
+        [&](SensorProto& msg) { receiveSensorProto(std::move(msg)); }, proto_logger));
 
     dynamic_parameter_update_request_listener.reset(
         new ThreadedProtoUnixListener<TbotsProto::ThunderbotsConfig>(
@@ -44,7 +47,8 @@ UnixSimulatorBackend::UnixSimulatorBackend(
     external_obstacles_list_.reset(
         new ThreadedProtoUnixListener<TbotsProto::VirtualObstacles>(
             runtime_dir + VIRTUAL_OBSTACLES_UNIX_PATH,
-            [&](TbotsProto::VirtualObstacles& msg) { receiveObstacleList(msg); },
+            [&](TbotsProto::VirtualObstacles& msg)
+            { receiveObstacleList(std::move(msg)); },
             proto_logger));
 
     // The following listeners have an empty callback since their values are
@@ -88,22 +92,46 @@ void UnixSimulatorBackend::receiveThunderbotsConfig(TbotsProto::ThunderbotsConfi
 
 void UnixSimulatorBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 {
+    // Like the robot communication does for real robots, replace when the primitives
+    // were assigned with when they're sent, which also ends their latency trace
+    primitives.mutable_time_sent()->set_epoch_timestamp_seconds(
+        getCurrentEpochTimeSeconds());
     primitive_output->sendProto(primitives);
 
-    LOG(VISUALIZE) << *createNamedValue(
+    std::optional<TbotsProto::PipelineLatencyStatistics> latency_statistics =
+        latency_aggregator.addPrimitiveSet(primitives);
+    if (latency_statistics)
+    {
+        Visualizer::publish(*latency_statistics);
+        for (const TbotsProto::LatencyHistogram& histogram :
+             latency_statistics->histograms())
+        {
+            if (histogram.stage() == PipelineLatencyAggregator::VISION_TO_COMMAND_STAGE)
+            {
+                Visualizer::publish(
+                    *createNamedValue("Vision to Command p50 (ms)",
+                                      static_cast<float>(histogram.p50_ms())));
+                Visualizer::publish(
+                    *createNamedValue("Vision to Command p99 (ms)",
+                                      static_cast<float>(histogram.p99_ms())));
+            }
+        }
+    }
+
+    Visualizer::publish(*createNamedValue(
         "Primitive Hz",
         static_cast<float>(FirstInFirstOutThreadedObserver<
-                           TbotsProto::PrimitiveSet>::getDataReceivedPerSecond()));
+                           TbotsProto::PrimitiveSet>::getDataReceivedPerSecond())));
 }
 
 void UnixSimulatorBackend::onValueReceived(World world)
 {
     world_output->sendProto(*createWorldWithSequenceNumber(world, sequence_number++));
 
-    LOG(VISUALIZE) << *createNamedValue(
+    Visualizer::publish(*createNamedValue(
         "World Hz",
         static_cast<float>(
-            FirstInFirstOutThreadedObserver<World>::getDataReceivedPerSecond()));
+            FirstInFirstOutThreadedObserver<World>::getDataReceivedPerSecond())));
 
     last_world_time_sec.store(world.getMostRecentTimestamp().toSeconds());
 }
@@ -12,6 +12,7 @@
 #include "proto/validation.pb.h"
 #include "proto/world.pb.h"
 #include "software/backend/backend.h"
+#include "software/backend/pipeline_latency_aggregator.h"
 #include "software/logger/proto_logger.h"
 #include "software/networking/unix/threaded_proto_unix_listener.hpp"
 #include "software/networking/unix/threaded_proto_unix_sender.hpp"
@@ -70,4 +71,7 @@ class UnixSimulatorBackend : public Backend, public Subject<TbotsProto::Thunderb
 
     // The timestamp of the last world received
     std::atomic<double> last_world_time_sec = 0;
+
+    // Only used by the thread that sends primitives
+    PipelineLatencyAggregator latency_aggregator;
 };
@@ -40,6 +40,9 @@ const std::string VIRTUAL_OBSTACLES_UNIX_PATH       = "/virtual_obstacles";
 
 const unsigned UNIX_BUFFER_SIZE = 20000;
 
+// The trace file written by full system when tracing is enabled, in its runtime dir
+const std::string FULL_SYSTEM_TRACE_FILE_PATH = "/full_system.tbtrace";
+
 static const double BALL_TO_FRONT_OF_ROBOT_DISTANCE_WHEN_DRIBBLING =
     BALL_MAX_RADIUS_METERS -
     2 * BALL_MAX_RADIUS_METERS * MAX_FRACTION_OF_BALL_COVERED_BY_ROBOT;
@@ -17,6 +17,7 @@
 #include "software/logger/network_logger.h"
 #include "software/networking/tbots_network_exception.h"
 #include "software/physics/velocity_conversion_util.h"
+#include "software/tracing/tracer.h"
 #include "software/tracy/tracy_constants.h"
 #include "software/util/scoped_timespec_timer/scoped_timespec_timer.h"
 #include "software/world/robot_state.h"
@@ -209,6 +210,7 @@ void Thunderloop::runLoop()
             clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_shot, NULL);
 
             FrameMarkStart(TracyConstants::THUNDERLOOP_FRAME_MARKER);
+            TRACE_ZONE(TracyConstants::THUNDERLOOP_FRAME_MARKER);
 
             ScopedTimespecTimer iteration_timer(&iteration_time);
 
@@ -274,6 +276,7 @@ inline Thunderloop::NetworkPollResult Thunderloop::pollNetwork()
         ScopedTimespecTimer timer(&poll_time);
 
         ZoneNamedN(_tracy_network_poll, "Thunderloop: Poll NetworkService", true);
+        TRACE_ZONE("Thunderloop: Poll NetworkService");
 
         new_primitive = network_service_->poll(robot_status_);
     }
@@ -381,6 +384,7 @@ inline Thunderloop::PrimitiveStepResult Thunderloop::stepActivePrimitive(
         ScopedTimespecTimer timer(&poll_time);
 
         ZoneNamedN(_tracy_step_primitive, "Thunderloop: Step Primitive", true);
+        TRACE_ZONE("Thunderloop: Step Primitive");
 
         // If primitive not received in a while, stop the robot
         auto nanoseconds_elapsed_since_last_primitive =
@@ -530,6 +534,7 @@ double Thunderloop::pollMotorService(
         ScopedTimespecTimer timer(&poll_time);
 
         ZoneNamedN(_tracy_motor_service_poll, "Thunderloop: Poll MotorService", true);
+        TRACE_ZONE("Thunderloop: Poll MotorService");
 
         double time_since_prev_iteration_s =
             getMilliseconds(time_since_prev_iteration) * SECONDS_PER_MILLISECOND;
@@ -548,6 +553,7 @@ double Thunderloop::pollPowerService(
         ScopedTimespecTimer timer(&poll_time);
 
         ZoneNamedN(_tracy_power_service_poll, "Thunderloop: Poll PowerService", true);
+        TRACE_ZONE("Thunderloop: Poll PowerService");
 
         power_service_->poll(direct_control, robot_status_);
     }
@@ -15,6 +15,9 @@
 #include "shared/robot_constants.h"
 #include "software/embedded/thunderloop.h"
 #include "software/logger/network_logger.h"
+#include "software/tracing/file_trace_exporter.h"
+#include "software/tracing/tracer.h"
+#include "software/tracing/tracy_trace_exporter.h"
 #include "software/world/robot_state.h"
 
 // clang-format off
@@ -91,6 +94,7 @@ int main(int argc, char** argv)
     struct CommandLineArgs
     {
         bool enable_log_merging = true;
+        std::string trace_file  = "";
     };
 
     CommandLineArgs args;
@@ -99,6 +103,9 @@ int main(int argc, char** argv)
     desc.add_options()("enable_log_merging",
                        boost::program_options::value<bool>(&args.enable_log_merging),
                        "merging repeated log messages");
+    desc.add_options()(
+        "trace_file", boost::program_options::value<std::string>(&args.trace_file),
+        "If set, the thunderloop stages are traced to this file and to Tracy");
 
     boost::program_options::variables_map vm;
     boost::program_options::store(parse_command_line(argc, argv, desc), vm);
@@ -111,6 +118,14 @@ int main(int argc, char** argv)
     const int pre_allocation_size = 20 * 1024 * 1024;
     reserveProcessMemory(pre_allocation_size);
 
+    if (!args.trace_file.empty())
+    {
+        std::vector<std::unique_ptr<TraceExporter>> trace_exporters;
+        trace_exporters.push_back(std::make_unique<FileTraceExporter>(args.trace_file));
+        trace_exporters.push_back(std::make_unique<TracyTraceExporter>());
+        Tracer::start(std::move(trace_exporters));
+    }
+
     auto thunderloop = Thunderloop(robot_constants::createRobotConstants(),
                                    args.enable_log_merging, THUNDERLOOP_HZ);
     thunderloop.runLoop();
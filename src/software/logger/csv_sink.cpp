@@ -1,24 +1,94 @@
 #include "software/logger/csv_sink.h"
 
 #include "compat_flags.h"
+#include "software/tracing/tracer.h"
 
-CSVSink::CSVSink(const std::string& log_directory) : log_directory(log_directory) {}
+CSVSink::CSVSink(const std::string& log_directory,
+                 std::chrono::steady_clock::duration flush_period)
+    : log_directory(log_directory),
+      flush_period(flush_period),
+      num_dropped_messages(0),
+      num_dropped_messages_reported(0),
+      stop_flusher_thread(false),
+      flusher_thread(&CSVSink::flushFiles, this)
+{
+}
+
+CSVSink::~CSVSink()
+{
+    {
+        std::scoped_lock files_lock(files_mutex);
+        stop_flusher_thread = true;
+    }
+    flusher_thread_cv.notify_one();
+    flusher_thread.join();
+}
 
 void CSVSink::appendToFile(g3::LogMessageMover log_entry)
 {
     if (log_entry.get()._level.value == CSV.value)
     {
-        std::string msg = log_entry.get()._message;
-        size_t pos      = msg.find(file_ext) + file_ext.length();
+        const std::string& msg = log_entry.get()._message;
+        size_t pos             = msg.find(file_ext) + file_ext.length();
+
+        std::scoped_lock files_lock(files_mutex);
+        if (pos == std::string::npos + file_ext.length())
+        {
+            num_dropped_messages++;
+            return;
+        }
+
+        std::string file_name = msg.substr(0, pos);
+        auto file_iter        = open_files.find(file_name);
+        if (file_iter == open_files.end())
+        {
+            if (open_files.size() >= MAX_OPEN_FILES)
+            {
+                open_files.clear();
+            }
+            file_iter = open_files
+                            .emplace(file_name,
+                                     std::ofstream(log_directory + "/" + file_name,
+                                                   std::ios::out | std::ios_base::app))
+                            .first;
+        }
+
+        std::ofstream& csv_file = file_iter->second;
+        csv_file.write(msg.data() + pos,
+                       static_cast<std::streamsize>(msg.length() - pos));
+        if (!csv_file)
+        {
+            // Try to open the file again the next time it's logged to
+            num_dropped_messages++;
+            open_files.erase(file_iter);
+        }
+    }
+}
+
+uint64_t CSVSink::numDroppedMessages()
+{
+    std::scoped_lock files_lock(files_mutex);
+    return num_dropped_messages;
+}
+
+void CSVSink::flushFiles()
+{
+    std::unique_lock files_lock(files_mutex);
+    while (!stop_flusher_thread)
+    {
+        flusher_thread_cv.wait_for(files_lock, flush_period,
+                                   [this]() { return stop_flusher_thread; });
+        for (auto& [file_name, csv_file] : open_files)
+        {
+            csv_file.flush();
+        }
 
-        if (pos != std::string::npos + file_ext.length())
+        if (num_dropped_messages > num_dropped_messages_reported)
         {
-            std::string file_name = msg.substr(0, pos);
-            std::string file_data = msg.substr(pos, msg.length());
-            std::ofstream csv_file(log_directory + "/" + file_name,
-                                   std::ios::out | std::ios_base::app);
-            csv_file << file_data;
-            csv_file.close();
+            TRACE_COUNTER("CSV Messages Dropped",
+                          static_cast<double>(num_dropped_messages -
+                                              num_dropped_messages_reported));
+            num_dropped_messages_reported = num_dropped_messages;
         }
     }
 }
@@ -1,13 +1,21 @@
 #pragma once
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
 #include <g3log/logmessage.hpp>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 #include "software/logger/custom_logging_levels.h"
 
 /**
  * This class acts as a customer sink for g3log. In particular, it allows us to log to csv
  * files.
+ *
+ * Files are kept open after they're first logged to, and writes to them are buffered.
+ * A flusher thread flushes the buffered writes to the files every flush period.
  */
 class CSVSink
 {
@@ -16,8 +24,16 @@ class CSVSink
      * Creates a CSVSink that logs to the directory specified
      *
      * @param log_directory the directory to save files to
+     * @param flush_period How often to flush the buffered writes to the files
      */
-    CSVSink(const std::string& log_directory);
+    CSVSink(const std::string& log_directory,
+            std::chrono::steady_clock::duration flush_period = DEFAULT_FLUSH_PERIOD);
+
+    /**
+     * Stops the flusher thread and flushes the buffered writes to the files
+     */
+    ~CSVSink();
+
     /**
      * This function is called on every call to LOG(CSV, filename). It appends to the
      * specified file the message in log_entry. Note for .csv files: columns are separated
@@ -27,7 +43,37 @@ class CSVSink
      */
     void appendToFile(g3::LogMessageMover log_entry);
 
+    /**
+     * Returns how many messages were dropped because they didn't name a .csv file, or
+     * their file couldn't be written to
+     *
+     * @return the number of dropped messages
+     */
+    uint64_t numDroppedMessages();
+
+    static constexpr std::chrono::milliseconds DEFAULT_FLUSH_PERIOD{100};
+    // The most files kept open at once. All files are closed when a file is logged to
+    // while this many are open.
+    static constexpr size_t MAX_OPEN_FILES = 64;
+
    private:
+    /**
+     * Flushes the buffered writes to the files every flush period until the sink is
+     * destroyed
+     */
+    void flushFiles();
+
     std::string log_directory;
     const std::string file_ext = ".csv";
+    const std::chrono::steady_clock::duration flush_period;
+
+    // Guards the open files and the counters
+    std::mutex files_mutex;
+    std::unordered_map<std::string, std::ofstream> open_files;
+    uint64_t num_dropped_messages;
+    uint64_t num_dropped_messages_reported;
+    bool stop_flusher_thread;
+    std::condition_variable flusher_thread_cv;
+
+    std::thread flusher_thread;
 };
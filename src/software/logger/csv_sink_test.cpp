@@ -33,6 +33,25 @@ TEST(CSVSinkTest, test_csv_log_appends)
     EXPECT_EQ(output, "t1,t2,t3t7,t8,t9t4,t5,t6\ns1,s2,s3");
 }
 
+TEST(CSVSinkTest, test_csv_log_without_csv_file_is_dropped)
+{
+    std::unique_ptr<g3::LogWorker> logWorker = g3::LogWorker::createLogWorker();
+    auto csv_sink_handle = logWorker->addSink(std::make_unique<CSVSink>(logging_dir),
+                                              &CSVSink::appendToFile);
+    // We need to shut down logging started in tbots gtest main to setup the csv sinks
+    g3::internal::shutDownLogging();
+    g3::initializeLogging(logWorker.get());
+
+    LOG(CSV, "test_file3") << "d1,d2,d3";
+
+    // wait for asynchronous logger
+    sleep(1);
+
+    EXPECT_EQ(csv_sink_handle->call(&CSVSink::numDroppedMessages).get(), 1);
+    std::ifstream read_test(logging_dir + "/test_file3", std::ios::in);
+    EXPECT_FALSE(read_test.is_open());
+}
+
 TEST_P(CSVSinkTest, test_csv_log_levels_not_logging)
 {
     std::unique_ptr<g3::LogWorker> logWorker = g3::LogWorker::createLogWorker();
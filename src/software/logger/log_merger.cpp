@@ -1,7 +1,10 @@
 #include "software/logger/log_merger.h"
 
 LogMerger::LogMerger(bool enable_merging)
-    : passed_time(std::chrono::seconds(0)), enable_merging(enable_merging)
+    : oldest_message(nullptr),
+      newest_message(nullptr),
+      passed_time(std::chrono::seconds(0)),
+      enable_merging(enable_merging)
 {
 }
 
@@ -9,23 +12,32 @@ std::list<g3::LogMessage> LogMerger::log(g3::LogMessage& log)
 {
     if (enable_merging)
     {
-        std::string msg = log.message();
-
-        Clock::time_point current_time = std::chrono::system_clock::now();
         // add passed time from testing
-        current_time += passed_time;
+        Clock::time_point current_time            = Clock::now() + passed_time;
         std::list<g3::LogMessage> messages_to_log = _getOldMessages(current_time);
 
-        if (repeat_map.count(msg))
+        // The text of the message is only copied if it isn't a repeat
+        auto [message_iter, inserted] =
+            message_map.try_emplace(log._message, log, current_time);
+        if (!inserted)
         {
-            // msg is in the repeat map, add a repeat and return the old messages
-            repeat_map[msg]++;
+            // msg is in the map, add a repeat and return the old messages
+            message_iter->second.repeats++;
             return messages_to_log;
         }
 
-        // msg is not in the repeat map, add the log to the map and list and log it
-        repeat_map[msg] = 0;
-        message_list.push_back(Message(log, msg, current_time));
+        // msg is not in the map, add it to the back of the queue and log it
+        Message& message = message_iter->second;
+        message.msg      = &message_iter->first;
+        if (newest_message)
+        {
+            newest_message->next = &message;
+        }
+        else
+        {
+            oldest_message = &message;
+        }
+        newest_message = &message;
 
         messages_to_log.push_front(log);
         return messages_to_log;
@@ -40,36 +52,35 @@ std::list<g3::LogMessage> LogMerger::log(g3::LogMessage& log)
 std::list<g3::LogMessage> LogMerger::_getOldMessages(Clock::time_point current_time)
 {
     std::list<g3::LogMessage> result;
-    while (message_list.size() > 0)
+    // The queue is in time order, so the rest of the queue is new once a new message
+    // is found
+    while (oldest_message &&
+           current_time - LOG_MERGE_DURATION >= oldest_message->timestamp)
     {
-        Message current_message = message_list.front();
-        if (current_time - LOG_MERGE_DURATION >= current_message.timestamp)
+        Message& old_message = *oldest_message;
+        oldest_message       = old_message.next;
+        if (!oldest_message)
         {
-            // old, if it has repeats, add repeats to the message and add it to the list
-            int repeats = repeat_map[current_message.msg];
-            if (repeats > 0)
-            {
-                g3::LogMessage log = current_message.log;
-                result.push_back(_addRepeats(log, repeats));
-            }
-            repeat_map.erase(current_message.msg);
-            message_list.pop_front();
+            newest_message = nullptr;
         }
-        else
+
+        // old, if it has repeats, add repeats to the message and add it to the list
+        if (old_message.repeats > 0)
         {
-            // new message, rest of list is new
-            break;
+            _addRepeats(old_message.log, old_message.repeats);
+            result.push_back(std::move(old_message.log));
         }
+        message_map.erase(message_map.find(*old_message.msg));
     }
     return result;
 }
 
-g3::LogMessage LogMerger::_addRepeats(g3::LogMessage& log, int repeats)
+void LogMerger::_addRepeats(g3::LogMessage& log, int repeats)
 {
     // if no repeats, do nothing
     if (repeats == 0)
     {
-        return log;
+        return;
     }
 
     // remove newline from end of message
@@ -86,8 +97,6 @@ g3::LogMessage LogMerger::_addRepeats(g3::LogMessage& log, int repeats)
     {
         log.write() += " (1 repeat)";
     }
-
-    return log;
 }
 
 void LogMerger::pastime()
@@ -10,6 +10,10 @@
 
 /**
  * Handles merging repeated log messages into a single message
+ *
+ * Messages are looked up by their text in a hash map, and the messages in the map are
+ * linked together in the order they were first logged, so a log call only does a
+ * lookup and pops the messages that expired off the front of the queue.
  */
 class LogMerger
 {
@@ -21,6 +25,10 @@ class LogMerger
      */
     explicit LogMerger(bool enable_merging = true);
 
+    // The queue links point into the map, so the merger can't be copied or moved
+    LogMerger(const LogMerger&)            = delete;
+    LogMerger& operator=(const LogMerger&) = delete;
+
     /**
      * Returns a list of all logs that should be logged at the current time, starting
      * with the given log (if it isn't a repeat)
@@ -37,11 +45,11 @@ class LogMerger
     /**
      * Add number of repeats to a log
      */
-    g3::LogMessage _addRepeats(g3::LogMessage& log, int repeats);
+    void _addRepeats(g3::LogMessage& log, int repeats);
 
     /**
-     * Looks through the message list for expired messages, removes them from the list and
-     * map, and returns them as strings
+     * Pops the expired messages off the front of the queue, removes them from the map,
+     * and returns the ones that were repeated with their number of repeats added
      */
     std::list<g3::LogMessage> _getOldMessages(Clock::time_point current_time);
 
@@ -49,23 +57,31 @@ class LogMerger
 
    private:
     /**
-     * Stores messages and the time they were first seen within the last few seconds
+     * A message logged within the last few seconds, and how many times it was repeated
      */
     struct Message
     {
         g3::LogMessage log;
-        std::string msg;
         Clock::time_point timestamp;
+        int repeats;
+        // The text of the message, which is its key in the map
+        const std::string* msg;
+        // The message that was first logged after this one
+        Message* next;
 
-        Message(g3::LogMessage& log, std::string msg, Clock::time_point timestamp)
-            : log(log), msg(msg), timestamp(timestamp)
+        Message(const g3::LogMessage& log, Clock::time_point timestamp)
+            : log(log), timestamp(timestamp), repeats(0), msg(nullptr), next(nullptr)
         {
         }
     };
 
-    std::unordered_map<std::string, int>
-        repeat_map;  // maps string messages to their number of repeats for fast access
-    std::list<Message> message_list;  // used to keep track of time order for messages
+    // Maps the text of messages to the messages. References to the elements of an
+    // unordered_map stay valid until they're erased, so they can be linked together.
+    std::unordered_map<std::string, Message> message_map;
+
+    // The front and back of the queue of messages in the order they were first logged
+    Message* oldest_message;
+    Message* newest_message;
 
     Clock::duration passed_time;  // for testing, time passed manually
 
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "software/logger/log_merger.h"
+
+/**
+ * Measures how long the LogMerger takes to merge a small set of messages that are
+ * logged over and over again, like a warning logged every tick of a control loop.
+ *
+ * Messages are logged at the given rate, or as fast as possible, cycling through the
+ * distinct messages.
+ */
+
+int main(int argc, char** argv)
+{
+    struct CommandLineArgs
+    {
+        bool help                      = false;
+        double rate                    = 1000;
+        double duration                = 10;
+        unsigned int distinct_messages = 5;
+    };
+
+    CommandLineArgs args;
+    boost::program_options::options_description desc{"Options"};
+    desc.add_options()("help,h", boost::program_options::bool_switch(&args.help),
+                       "Help screen");
+    desc.add_options()("rate", boost::program_options::value<double>(&args.rate),
+                       "The number of messages to log per second. If 0, messages are "
+                       "logged as fast as possible.");
+    desc.add_options()("duration", boost::program_options::value<double>(&args.duration),
+                       "How many seconds to log messages for.");
+    desc.add_options()(
+        "distinct_messages",
+        boost::program_options::value<unsigned int>(&args.distinct_messages),
+        "The number of distinct messages to cycle through.");
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (args.help)
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+    if (args.distinct_messages == 0 || args.duration <= 0)
+    {
+        std::cerr << "--distinct_messages and --duration must be positive" << std::endl;
+        return 1;
+    }
+
+    std::vector<g3::LogMessage> messages;
+    for (unsigned int i = 0; i < args.distinct_messages; i++)
+    {
+        g3::LogMessage message("thunderloop.cpp", 100 + static_cast<int>(i), "runLoop",
+                               WARNING);
+        message.write() = "Motor " + std::to_string(i) + " is not responding\n";
+        messages.push_back(message);
+    }
+
+    LogMerger log_merger;
+    unsigned int num_logged          = 0;
+    unsigned int num_messages_output = 0;
+    Clock::duration total_log_time   = Clock::duration::zero();
+    Clock::duration max_log_time     = Clock::duration::zero();
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto end =
+        start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(args.duration));
+    while (std::chrono::steady_clock::now() < end)
+    {
+        if (args.rate > 0)
+        {
+            std::chrono::duration<double> log_time(num_logged / args.rate);
+            std::this_thread::sleep_until(
+                start + std::chrono::duration_cast<std::chrono::nanoseconds>(log_time));
+        }
+
+        // Messages are copied before they're logged, like the sinks do
+        g3::LogMessage message = messages[num_logged % messages.size()];
+
+        const auto log_start = Clock::now();
+        num_messages_output += static_cast<unsigned int>(log_merger.log(message).size());
+        const Clock::duration log_time = Clock::now() - log_start;
+
+        total_log_time += log_time;
+        max_log_time = std::max(max_log_time, log_time);
+        num_logged++;
+    }
+
+    const double elapsed_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Messages logged: " << num_logged << " (" << num_logged / elapsed_sec
+              << " messages/s)" << std::endl
+              << "Messages output after merging: " << num_messages_output << std::endl
+              << "Mean time per log: "
+              << std::chrono::duration<double, std::nano>(total_log_time).count() /
+                     num_logged
+              << " ns" << std::endl
+              << "Max time per log: "
+              << std::chrono::duration<double, std::nano>(max_log_time).count() << " ns"
+              << std::endl;
+
+    return 0;
+}
@@ -135,3 +135,35 @@ TEST(LogMergerTests, log_one_in_middle)
     g3::LogMessage repeats = createLog("First message (9 repeats)");
     checkLogsEqual(repeats, log2.front());
 }
+
+TEST(LogMergerTests, log_again_after_expiry)
+{
+    LogMerger merger = LogMerger();
+
+    g3::LogMessage msg1            = createLog("Again");
+    std::list<g3::LogMessage> log1 = merger.log(msg1);
+    EXPECT_EQ(1, log1.size());
+
+    merger.pastime();
+
+    // The first message expired without repeats, so this is logged as a new message
+    g3::LogMessage msg2            = createLog("Again");
+    std::list<g3::LogMessage> log2 = merger.log(msg2);
+    EXPECT_EQ(1, log2.size());
+    checkLogsEqual(msg2, log2.front());
+
+    g3::LogMessage msg3            = createLog("Again");
+    std::list<g3::LogMessage> log3 = merger.log(msg3);
+    EXPECT_EQ(0, log3.size());
+
+    merger.pastime();
+
+    g3::LogMessage msg4            = createLog("Different message");
+    std::list<g3::LogMessage> log4 = merger.log(msg4);
+    EXPECT_EQ(2, log4.size());
+    checkLogsEqual(msg4, log4.front());
+    log4.pop_front();
+
+    g3::LogMessage repeat = createLog("Again (1 repeat)");
+    checkLogsEqual(repeat, log4.front());
+}
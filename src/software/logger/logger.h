@@ -13,6 +13,7 @@
 #include "software/logger/custom_logging_levels.h"
 #include "software/logger/plotjuggler_sink.h"
 #include "software/logger/protobuf_sink.h"
+#include "software/logger/visualizer.h"
 
 // This undefines LOG macro defined by g3log
 #undef LOG
@@ -56,7 +57,7 @@ class LoggerSingleton
      * called once at the start of a program.
      *
      * @param runtime_dir The directory where the log files will be stored.
-     * @param proto_logger The proto logger to log VISUALIZE protos
+     * @param proto_logger The proto logger to save visualized protos to
      * @param reduce_repetition Whether logs should be merged whenever possible to reduce
      * spam
      */
@@ -114,10 +115,12 @@ class LoggerSingleton
                 std::make_unique<LogRotate>(log_name, runtime_dir), default_level_filter),
             &LogRotateWithFilter::save);
 
-        // Sink for visualization
-        auto visualization_handle =
-            logWorker->addSink(std::make_unique<ProtobufSink>(runtime_dir, proto_logger),
-                               &ProtobufSink::sendProtobuf);
+        // Visualized protobufs are published directly rather than through a sink
+        Visualizer::initialize(runtime_dir, proto_logger);
+
+        // Sink for logs sent to Thunderscope, and for LOG(VISUALIZE)
+        auto visualization_handle = logWorker->addSink(
+            std::make_unique<ProtobufSink>(runtime_dir), &ProtobufSink::sendProtobuf);
 
         // Sink for PlotJuggler plotting
         auto plotjuggler_handle = logWorker->addSink(std::make_unique<PlotJugglerSink>(),
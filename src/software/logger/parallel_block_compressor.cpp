@@ -0,0 +1,179 @@
+#include "software/logger/parallel_block_compressor.h"
+
+#include <algorithm>
+#include <iostream>
+
+ParallelBlockCompressor::ParallelBlockCompressor(ReplayCompression compression,
+                                                 unsigned int num_compression_threads,
+                                                 size_t max_pending_blocks)
+    : compression(compression),
+      max_pending_blocks(std::max<size_t>(max_pending_blocks, 1)),
+      uncompressed_blocks(),
+      compressed_blocks(),
+      next_sequence_number(0),
+      next_sequence_number_to_write(0),
+      num_bytes_written(0),
+      stopping(false),
+      open_file(),
+      open_file_path(),
+      compression_threads(),
+      appender_thread()
+{
+    for (unsigned int i = 0; i < std::max(num_compression_threads, 1u); i++)
+    {
+        compression_threads.emplace_back(&ParallelBlockCompressor::compressBlocks, this);
+    }
+    appender_thread = std::thread(&ParallelBlockCompressor::writeBlocks, this);
+}
+
+ParallelBlockCompressor::~ParallelBlockCompressor()
+{
+    flush();
+
+    {
+        std::scoped_lock lock(blocks_mutex);
+        stopping = true;
+    }
+    block_appended.notify_all();
+    block_compressed.notify_all();
+
+    for (std::thread& compression_thread : compression_threads)
+    {
+        compression_thread.join();
+    }
+    appender_thread.join();
+}
+
+void ParallelBlockCompressor::appendBlock(const std::string& file_path,
+                                          std::string block)
+{
+    {
+        std::unique_lock lock(blocks_mutex);
+        block_written.wait(
+            lock,
+            [&]()
+            {
+                return next_sequence_number - next_sequence_number_to_write <
+                       max_pending_blocks;
+            });
+        uncompressed_blocks.push_back(Block{
+            .sequence_number = next_sequence_number++,
+            .file_path       = file_path,
+            .data            = std::move(block),
+        });
+    }
+    block_appended.notify_one();
+}
+
+void ParallelBlockCompressor::flush()
+{
+    std::unique_lock lock(blocks_mutex);
+    block_written.wait(
+        lock, [&]() { return next_sequence_number_to_write == next_sequence_number; });
+}
+
+uint64_t ParallelBlockCompressor::numBytesWritten()
+{
+    std::scoped_lock lock(blocks_mutex);
+    return num_bytes_written;
+}
+
+void ParallelBlockCompressor::compressBlocks()
+{
+    while (true)
+    {
+        std::unique_lock lock(blocks_mutex);
+        block_appended.wait(lock,
+                            [&]() { return !uncompressed_blocks.empty() || stopping; });
+        if (uncompressed_blocks.empty())
+        {
+            return;
+        }
+        Block block = std::move(uncompressed_blocks.front());
+        uncompressed_blocks.pop_front();
+        lock.unlock();
+
+        block.data = compressReplayBlock(block.data, compression);
+
+        lock.lock();
+        compressed_blocks.emplace(block.sequence_number, std::move(block));
+        lock.unlock();
+        // The appender is waiting for one block in particular, which may not be this
+        // one, so it checks every block that is compressed
+        block_compressed.notify_one();
+    }
+}
+
+void ParallelBlockCompressor::writeBlocks()
+{
+    while (true)
+    {
+        std::unique_lock lock(blocks_mutex);
+        block_compressed.wait(
+            lock,
+            [&]()
+            {
+                return (!compressed_blocks.empty() &&
+                        compressed_blocks.begin()->first ==
+                            next_sequence_number_to_write) ||
+                       stopping;
+            });
+        if (stopping && compressed_blocks.empty())
+        {
+            return;
+        }
+        if (compressed_blocks.begin()->first != next_sequence_number_to_write)
+        {
+            continue;
+        }
+        Block block = std::move(compressed_blocks.begin()->second);
+        compressed_blocks.erase(compressed_blocks.begin());
+        lock.unlock();
+
+        writeBlock(block);
+
+        lock.lock();
+        next_sequence_number_to_write++;
+        num_bytes_written += block.data.size();
+        lock.unlock();
+        block_written.notify_all();
+    }
+}
+
+void ParallelBlockCompressor::writeBlock(const Block& block)
+{
+    if (block.file_path != open_file_path)
+    {
+        open_file.close();
+        open_file.clear();
+        open_file_path = block.file_path;
+        open_file.open(open_file_path, std::ios::binary | std::ios::app);
+        if (!open_file)
+        {
+            std::cerr << "ParallelBlockCompressor: Failed to open log file: "
+                      << open_file_path << std::endl;
+        }
+    }
+
+    if (block.data.empty())
+    {
+        std::cerr << "ParallelBlockCompressor: Failed to compress a block of log file: "
+                  << open_file_path << std::endl;
+        return;
+    }
+    // Failures to open the file were already reported
+    if (!open_file.is_open())
+    {
+        return;
+    }
+
+    // Flush every block so the file can be read back while it is still being written
+    open_file.write(block.data.data(), static_cast<std::streamsize>(block.data.size()));
+    open_file.flush();
+    if (!open_file)
+    {
+        std::cerr << "ParallelBlockCompressor: Failed to write to log file: "
+                  << open_file_path << std::endl;
+        open_file.clear();
+    }
+}
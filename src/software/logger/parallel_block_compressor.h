@@ -0,0 +1,125 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "software/logger/replay_compression.h"
+
+/**
+ * Compresses blocks of replay chunks on a pool of threads, and appends them to their
+ * files in the order they were given.
+ *
+ * Blocks are compressed independently of each other, so they may finish compressing
+ * in any order. A single appender thread waits for the next block in order to finish
+ * before writing it, so each file ends up as the concatenation of its compressed
+ * blocks. Only a limited number of blocks may be waiting to be written at once, after
+ * which appending a block waits for one to be written.
+ */
+class ParallelBlockCompressor
+{
+   public:
+    /**
+     * Creates a ParallelBlockCompressor and starts its threads
+     *
+     * @param compression How to compress the blocks
+     * @param num_compression_threads The number of threads that compress blocks
+     * @param max_pending_blocks The maximum number of blocks that may be waiting to be
+     * compressed or written at once
+     */
+    explicit ParallelBlockCompressor(ReplayCompression compression,
+                                     unsigned int num_compression_threads,
+                                     size_t max_pending_blocks);
+
+    ParallelBlockCompressor()                                          = delete;
+    ParallelBlockCompressor(const ParallelBlockCompressor&)            = delete;
+    ParallelBlockCompressor& operator=(const ParallelBlockCompressor&) = delete;
+
+    /**
+     * Writes every block that was appended, then stops the threads
+     */
+    ~ParallelBlockCompressor();
+
+    /**
+     * Queues a block to be compressed and appended to a file. Blocks are appended in
+     * the order this is called in, even when they are appended to different files.
+     *
+     * @param file_path The path of the file to append to
+     * @param block The block to compress
+     */
+    void appendBlock(const std::string& file_path, std::string block);
+
+    /**
+     * Waits until every block that was appended has been written to its file
+     */
+    void flush();
+
+    /**
+     * Returns the number of compressed bytes written so far
+     *
+     * @return the number of compressed bytes written to all files
+     */
+    uint64_t numBytesWritten();
+
+   private:
+    /**
+     * A block of a replay chunk and the file it is appended to
+     */
+    struct Block
+    {
+        uint64_t sequence_number;
+        std::string file_path;
+        std::string data;
+    };
+
+    /**
+     * The loop of each compression thread, which compresses blocks in the order they
+     * were appended
+     */
+    void compressBlocks();
+
+    /**
+     * The loop of the appender thread, which writes compressed blocks in the order they
+     * were appended
+     */
+    void writeBlocks();
+
+    /**
+     * Appends a compressed block to its file
+     *
+     * @param block The compressed block
+     */
+    void writeBlock(const Block& block);
+
+    const ReplayCompression compression;
+    const size_t max_pending_blocks;
+
+    std::mutex blocks_mutex;
+    // Notified when a block is appended, or the threads are stopping
+    std::condition_variable block_appended;
+    // Notified when a block is compressed, or the threads are stopping
+    std::condition_variable block_compressed;
+    // Notified when a block is written
+    std::condition_variable block_written;
+    std::deque<Block> uncompressed_blocks;
+    // The compressed blocks waiting for the blocks before them to be written, by
+    // sequence number
+    std::map<uint64_t, Block> compressed_blocks;
+    uint64_t next_sequence_number;
+    uint64_t next_sequence_number_to_write;
+    uint64_t num_bytes_written;
+    bool stopping;
+
+    // Only used by the appender thread
+    std::ofstream open_file;
+    std::string open_file_path;
+
+    std::vector<std::thread> compression_threads;
+    std::thread appender_thread;
+};
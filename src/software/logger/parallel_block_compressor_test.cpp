@@ -0,0 +1,67 @@
+#include "software/logger/parallel_block_compressor.h"
+
+#include <gtest/gtest.h>
+
+#include "software/logger/compat_flags.h"
+
+class ParallelBlockCompressorTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        fs::remove_all(folder);
+        fs::create_directories(folder);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(folder);
+    }
+
+    const std::string folder =
+        (fs::temp_directory_path() / "parallel_block_compressor_test").string();
+};
+
+TEST_F(ParallelBlockCompressorTest, blocks_are_appended_in_order)
+{
+    const std::string first_path  = folder + "/0.replay";
+    const std::string second_path = folder + "/1.replay";
+
+    std::string first_contents;
+    std::string second_contents;
+    {
+        // Fewer pending blocks than threads, so appending has to wait for writes
+        ParallelBlockCompressor compressor(ReplayCompression::ZSTD, 4, 3);
+        for (int i = 0; i < 200; i++)
+        {
+            // Blocks of different sizes take different times to compress
+            std::string block(static_cast<size_t>((i * 7919) % 20000), 'a' + i % 26);
+            if (i < 150)
+            {
+                first_contents += block;
+                compressor.appendBlock(first_path, block);
+            }
+            else
+            {
+                second_contents += block;
+                compressor.appendBlock(second_path, block);
+            }
+        }
+    }
+
+    EXPECT_EQ(first_contents, readReplayChunk(first_path));
+    EXPECT_EQ(second_contents, readReplayChunk(second_path));
+}
+
+TEST_F(ParallelBlockCompressorTest, flush_waits_for_blocks_to_be_written)
+{
+    const std::string path = folder + "/0.replay";
+    ParallelBlockCompressor compressor(ReplayCompression::GZIP, 2, 8);
+
+    compressor.appendBlock(path, "first");
+    compressor.appendBlock(path, "second");
+    compressor.flush();
+
+    EXPECT_EQ("firstsecond", readReplayChunk(path));
+    EXPECT_EQ(fs::file_size(path), compressor.numBytesWritten());
+}
@@ -3,18 +3,202 @@
 #include <google/protobuf/util/json_util.h>
 
 #include "shared/constants.h"
+#include "software/tracing/tracer.h"
 
-PlotJugglerSink::PlotJugglerSink(const std::string& interface)
+namespace
+{
+    /**
+     * Returns the options to convert PlotJugglerValues to JSON with
+     *
+     * @return the JSON print options
+     */
+    google::protobuf::util::JsonPrintOptions plotJugglerJsonPrintOptions()
+    {
+        google::protobuf::util::JsonPrintOptions options;
+        options.add_whitespace                       = false;
+        options.always_print_fields_with_no_presence = true;
+        options.preserve_proto_field_names           = true;
+        return options;
+    }
+}  // namespace
+
+void PlotJugglerValueBatch::add(const TbotsProto::PlotJugglerValue& plotjuggler_value)
+{
+    if (plotjuggler_value.data().empty())
+    {
+        return;
+    }
+
+    TbotsProto::PlotJugglerValue& batched_value =
+        values_by_timestamp[plotjuggler_value.timestamp()];
+    batched_value.set_timestamp(plotjuggler_value.timestamp());
+    auto& data = *batched_value.mutable_data();
+    for (const auto& [name, value] : plotjuggler_value.data())
+    {
+        if (data.count(name) > 0)
+        {
+            num_merged_values++;
+        }
+        data[name] = value;
+    }
+}
+
+bool PlotJugglerValueBatch::empty() const
+{
+    return values_by_timestamp.empty();
+}
+
+void PlotJugglerValueBatch::take(
+    std::vector<TbotsProto::PlotJugglerValue>& plotjuggler_values)
+{
+    plotjuggler_values.clear();
+    for (auto& [timestamp, batched_value] : values_by_timestamp)
+    {
+        plotjuggler_values.push_back(std::move(batched_value));
+    }
+    values_by_timestamp.clear();
+}
+
+uint64_t PlotJugglerValueBatch::numMergedValues() const
+{
+    return num_merged_values;
+}
+
+PlotJugglerSink::PlotJugglerSink(const std::string& interface,
+                                 std::chrono::steady_clock::duration send_period)
     : udp_sender(PLOTJUGGLER_GUI_DEFAULT_HOST, PLOTJUGGLER_GUI_DEFAULT_PORT, interface,
-                 false)
+                 false),
+      send_period(send_period),
+      num_dropped_values(0),
+      stop_sender_thread(false),
+      num_merged_values_reported(0),
+      num_dropped_values_reported(0),
+      sender_thread(&PlotJugglerSink::sendBatches, this)
 {
 }
 
+PlotJugglerSink::~PlotJugglerSink()
+{
+    {
+        std::scoped_lock batch_lock(batch_mutex);
+        stop_sender_thread = true;
+    }
+    sender_thread_cv.notify_one();
+    sender_thread.join();
+    sendBatch();
+    reportCounters();
+}
+
 void PlotJugglerSink::sendToPlotJuggler(g3::LogMessageMover log_entry)
 {
-    if (log_entry.get()._level.value == PLOTJUGGLER.value)
+    if (log_entry.get()._level.value != PLOTJUGGLER.value)
+    {
+        return;
+    }
+
+    TbotsProto::PlotJugglerValue plotjuggler_value;
+    if (!google::protobuf::util::JsonStringToMessage(log_entry.get().message(),
+                                                     &plotjuggler_value)
+             .ok())
     {
-        udp_sender.sendString(log_entry.get().message());
+        std::scoped_lock batch_lock(batch_mutex);
+        num_dropped_values++;
+        return;
+    }
+    sendPlotJugglerValue(plotjuggler_value);
+}
+
+void PlotJugglerSink::sendPlotJugglerValue(
+    const TbotsProto::PlotJugglerValue& plotjuggler_value)
+{
+    std::scoped_lock batch_lock(batch_mutex);
+    batch.add(plotjuggler_value);
+}
+
+uint64_t PlotJugglerSink::numMergedValues()
+{
+    std::scoped_lock batch_lock(batch_mutex);
+    return batch.numMergedValues();
+}
+
+uint64_t PlotJugglerSink::numDroppedValues()
+{
+    std::scoped_lock batch_lock(batch_mutex);
+    return num_dropped_values;
+}
+
+void PlotJugglerSink::sendBatches()
+{
+    std::unique_lock batch_lock(batch_mutex);
+    while (!stop_sender_thread)
+    {
+        sender_thread_cv.wait_for(batch_lock, send_period,
+                                  [this]() { return stop_sender_thread; });
+        batch_lock.unlock();
+        sendBatch();
+        reportCounters();
+        batch_lock.lock();
+    }
+}
+
+void PlotJugglerSink::sendBatch()
+{
+    {
+        std::scoped_lock batch_lock(batch_mutex);
+        if (batch.empty())
+        {
+            return;
+        }
+        batch.take(batched_values);
+    }
+
+    uint64_t num_unsent_values = 0;
+    for (const TbotsProto::PlotJugglerValue& batched_value : batched_values)
+    {
+        json_string.clear();
+        std::ignore = MessageToJsonString(batched_value, &json_string,
+                                          plotJugglerJsonPrintOptions());
+
+        try
+        {
+            udp_sender.sendString(json_string);
+        }
+        catch (const boost::system::system_error&)
+        {
+            num_unsent_values += static_cast<uint64_t>(batched_value.data_size());
+        }
+    }
+
+    if (num_unsent_values > 0)
+    {
+        std::scoped_lock batch_lock(batch_mutex);
+        num_dropped_values += num_unsent_values;
+    }
+}
+
+void PlotJugglerSink::reportCounters()
+{
+    uint64_t total_merged_values  = 0;
+    uint64_t total_dropped_values = 0;
+    {
+        std::scoped_lock batch_lock(batch_mutex);
+        total_merged_values  = batch.numMergedValues();
+        total_dropped_values = num_dropped_values;
+    }
+
+    if (total_merged_values > num_merged_values_reported)
+    {
+        TRACE_COUNTER(
+            "PlotJuggler Values Merged",
+            static_cast<double>(total_merged_values - num_merged_values_reported));
+        num_merged_values_reported = total_merged_values;
+    }
+    if (total_dropped_values > num_dropped_values_reported)
+    {
+        TRACE_COUNTER(
+            "PlotJuggler Values Dropped",
+            static_cast<double>(total_dropped_values - num_dropped_values_reported));
+        num_dropped_values_reported = total_dropped_values;
     }
 }
 
@@ -22,13 +206,8 @@ std::ostream& operator<<(std::ostream& os,
                          const TbotsProto::PlotJugglerValue& plotjuggler_value)
 {
     std::string json_string;
-
-    google::protobuf::util::JsonPrintOptions options;
-    options.add_whitespace                       = false;
-    options.always_print_fields_with_no_presence = true;
-    options.preserve_proto_field_names           = true;
-
-    std::ignore = MessageToJsonString(plotjuggler_value, &json_string, options);
+    std::ignore = MessageToJsonString(plotjuggler_value, &json_string,
+                                      plotJugglerJsonPrintOptions());
 
     os << json_string;
     return os;
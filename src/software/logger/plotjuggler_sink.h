@@ -1,17 +1,70 @@
 #pragma once
+#include <chrono>
+#include <condition_variable>
 #include <g3log/logmessage.hpp>
+#include <map>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "proto/visualization.pb.h"
 #include "shared/constants.h"
 #include "software/logger/custom_logging_levels.h"
 #include "software/networking/udp/threaded_udp_sender.h"
 
+/**
+ * The PlotJuggler values waiting to be sent together. Every value keeps its own
+ * timestamp, so values are grouped by timestamp, and only values with the same name
+ * and timestamp are merged, keeping the one that was added last.
+ */
+class PlotJugglerValueBatch
+{
+   public:
+    /**
+     * Adds values to the batch
+     *
+     * @param plotjuggler_value The values to add
+     */
+    void add(const TbotsProto::PlotJugglerValue& plotjuggler_value);
+
+    /**
+     * Returns whether there are no values in the batch
+     *
+     * @return whether the batch is empty
+     */
+    bool empty() const;
+
+    /**
+     * Takes all the values out of the batch, leaving it empty
+     *
+     * @param plotjuggler_values Replaced with the values of the batch, with one
+     * PlotJugglerValue for each timestamp, in order of timestamp
+     */
+    void take(std::vector<TbotsProto::PlotJugglerValue>& plotjuggler_values);
+
+    /**
+     * Returns how many values were replaced by a newer value with the same name and
+     * timestamp before they were taken out of the batch
+     *
+     * @return the number of merged values
+     */
+    uint64_t numMergedValues() const;
+
+   private:
+    std::map<double, TbotsProto::PlotJugglerValue> values_by_timestamp;
+    uint64_t num_merged_values = 0;
+};
 
 /**
  * This class acts as a custom sink for g3log. In particular, it allows us to send
  * values to be plotted in PlotJuggler over UDP.
+ *
+ * Values are batched, and a sender thread sends the values of a batch every send
+ * period, so the threads logging values don't send packets themselves. PlotJuggler
+ * reads one JSON object with one timestamp from each packet, so the values of a batch
+ * are sent in one packet per timestamp.
  */
 class PlotJugglerSink
 {
@@ -20,24 +73,89 @@ class PlotJugglerSink
      * Creates a PlotJugglerSink that sends udp packets to the PlotJuggler server
      *
      * @param interface The interface to send Plotjuggler UDP packets on
+     * @param send_period How often to send the batched values
      */
-    PlotJugglerSink(const std::string& interface = LOOPBACK_INTERFACE);
+    PlotJugglerSink(const std::string& interface = LOOPBACK_INTERFACE,
+                    std::chrono::steady_clock::duration send_period =
+                        DEFAULT_SEND_PERIOD);
 
-    ~PlotJugglerSink() = default;
+    /**
+     * Stops the sender thread and sends the values that are still batched
+     */
+    ~PlotJugglerSink();
 
     /**
-     * This function is called on every call to LOG(). It sends a JSON string to
-     * PlotJuggler over the network.
+     * This function is called on every call to LOG(). It adds the values in the JSON
+     * string of the message to the batch sent to PlotJuggler.
      *
      * @param log_entry the message received on a LOG() call
      */
     void sendToPlotJuggler(g3::LogMessageMover log_entry);
 
+    /**
+     * Adds a value to the batch sent to PlotJuggler directly, without going through
+     * LOG()
+     *
+     * @param plotjuggler_value The value to send
+     */
+    void sendPlotJugglerValue(const TbotsProto::PlotJugglerValue& plotjuggler_value);
+
+    /**
+     * Returns how many values were not sent because they were replaced by a newer
+     * value with the same name and timestamp in the same batch
+     *
+     * @return the number of merged values
+     */
+    uint64_t numMergedValues();
+
+    /**
+     * Returns how many values were dropped because their message couldn't be parsed,
+     * or their packet couldn't be sent
+     *
+     * @return the number of dropped values
+     */
+    uint64_t numDroppedValues();
+
+    static constexpr std::chrono::milliseconds DEFAULT_SEND_PERIOD{10};
+
    private:
+    /**
+     * Sends the batched values every send period until the sink is destroyed
+     */
+    void sendBatches();
+
+    /**
+     * Sends the batched values in one packet per timestamp, if there are any
+     */
+    void sendBatch();
+
+    /**
+     * Records how many values were merged and dropped since the last report as trace
+     * counters. This is only done on the sender thread, since the thread that drains
+     * the trace rings sends values to the sink and can't record trace events itself.
+     */
+    void reportCounters();
+
     // Any error that occurs during the creation of the UDP sender will be stored here
     std::optional<std::string> error;
 
     ThreadedUdpSender udp_sender;
+
+    const std::chrono::steady_clock::duration send_period;
+
+    std::mutex batch_mutex;
+    PlotJugglerValueBatch batch;
+    uint64_t num_dropped_values;
+    bool stop_sender_thread;
+    std::condition_variable sender_thread_cv;
+
+    // Only used by the sender thread
+    std::vector<TbotsProto::PlotJugglerValue> batched_values;
+    std::string json_string;
+    uint64_t num_merged_values_reported;
+    uint64_t num_dropped_values_reported;
+
+    std::thread sender_thread;
 };
 
 /*
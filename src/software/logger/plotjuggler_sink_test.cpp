@@ -0,0 +1,119 @@
+#include "software/logger/plotjuggler_sink.h"
+
+#include <gtest/gtest.h>
+
+/**
+ * Creates a PlotJugglerValue
+ *
+ * @param timestamp The timestamp of the value
+ * @param data The named values
+ *
+ * @return the PlotJugglerValue
+ */
+TbotsProto::PlotJugglerValue createValue(double timestamp,
+                                         const std::map<std::string, double>& data)
+{
+    TbotsProto::PlotJugglerValue plotjuggler_value;
+    plotjuggler_value.set_timestamp(timestamp);
+    for (const auto& [name, value] : data)
+    {
+        (*plotjuggler_value.mutable_data())[name] = value;
+    }
+    return plotjuggler_value;
+}
+
+TEST(PlotJugglerValueBatchTest, test_new_batch_is_empty)
+{
+    PlotJugglerValueBatch batch;
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.numMergedValues(), 0);
+}
+
+TEST(PlotJugglerValueBatchTest, test_values_with_same_timestamp_are_grouped)
+{
+    PlotJugglerValueBatch batch;
+    batch.add(createValue(1.0, {{"x", 1.0}}));
+    batch.add(createValue(1.0, {{"y", 2.0}, {"z", 3.0}}));
+
+    std::vector<TbotsProto::PlotJugglerValue> plotjuggler_values;
+    batch.take(plotjuggler_values);
+
+    ASSERT_EQ(plotjuggler_values.size(), 1);
+    EXPECT_EQ(plotjuggler_values[0].timestamp(), 1.0);
+    EXPECT_EQ(plotjuggler_values[0].data_size(), 3);
+    EXPECT_EQ(plotjuggler_values[0].data().at("x"), 1.0);
+    EXPECT_EQ(plotjuggler_values[0].data().at("y"), 2.0);
+    EXPECT_EQ(plotjuggler_values[0].data().at("z"), 3.0);
+    EXPECT_EQ(batch.numMergedValues(), 0);
+}
+
+TEST(PlotJugglerValueBatchTest, test_values_keep_their_own_timestamps)
+{
+    PlotJugglerValueBatch batch;
+    batch.add(createValue(2.0, {{"y", 2.0}}));
+    batch.add(createValue(1.0, {{"x", 1.0}}));
+
+    std::vector<TbotsProto::PlotJugglerValue> plotjuggler_values;
+    batch.take(plotjuggler_values);
+
+    ASSERT_EQ(plotjuggler_values.size(), 2);
+    EXPECT_EQ(plotjuggler_values[0].timestamp(), 1.0);
+    ASSERT_EQ(plotjuggler_values[0].data_size(), 1);
+    EXPECT_EQ(plotjuggler_values[0].data().at("x"), 1.0);
+    EXPECT_EQ(plotjuggler_values[1].timestamp(), 2.0);
+    ASSERT_EQ(plotjuggler_values[1].data_size(), 1);
+    EXPECT_EQ(plotjuggler_values[1].data().at("y"), 2.0);
+    EXPECT_EQ(batch.numMergedValues(), 0);
+}
+
+TEST(PlotJugglerValueBatchTest, test_same_name_and_timestamp_keep_latest_value)
+{
+    PlotJugglerValueBatch batch;
+    batch.add(createValue(1.0, {{"x", 1.0}, {"y", 2.0}}));
+    batch.add(createValue(1.0, {{"x", 4.0}}));
+    batch.add(createValue(1.0, {{"x", 5.0}}));
+    batch.add(createValue(2.0, {{"x", 6.0}}));
+
+    std::vector<TbotsProto::PlotJugglerValue> plotjuggler_values;
+    batch.take(plotjuggler_values);
+
+    ASSERT_EQ(plotjuggler_values.size(), 2);
+    EXPECT_EQ(plotjuggler_values[0].data().at("x"), 5.0);
+    EXPECT_EQ(plotjuggler_values[0].data().at("y"), 2.0);
+    EXPECT_EQ(plotjuggler_values[1].data().at("x"), 6.0);
+    EXPECT_EQ(batch.numMergedValues(), 2);
+}
+
+TEST(PlotJugglerValueBatchTest, test_take_empties_batch)
+{
+    PlotJugglerValueBatch batch;
+    batch.add(createValue(1.0, {{"x", 1.0}}));
+
+    std::vector<TbotsProto::PlotJugglerValue> plotjuggler_values;
+    batch.take(plotjuggler_values);
+    EXPECT_TRUE(batch.empty());
+
+    // Values added after the batch was taken don't merge with the taken values
+    batch.add(createValue(1.0, {{"x", 2.0}}));
+    batch.take(plotjuggler_values);
+    ASSERT_EQ(plotjuggler_values.size(), 1);
+    EXPECT_EQ(plotjuggler_values[0].timestamp(), 1.0);
+    EXPECT_EQ(plotjuggler_values[0].data().at("x"), 2.0);
+    EXPECT_EQ(batch.numMergedValues(), 0);
+}
+
+TEST(PlotJugglerSinkTest, test_values_sent_at_same_time_in_same_period_are_merged)
+{
+    PlotJugglerSink plotjuggler_sink(LOOPBACK_INTERFACE, std::chrono::seconds(10));
+
+    // 10 timestamps with 10 values of x and y each
+    for (int i = 0; i < 100; i++)
+    {
+        plotjuggler_sink.sendPlotJugglerValue(
+            createValue(i % 10, {{"x", static_cast<double>(i)},
+                                 {"y", static_cast<double>(-i)}}));
+    }
+
+    EXPECT_EQ(plotjuggler_sink.numMergedValues(), 180);
+    EXPECT_EQ(plotjuggler_sink.numDroppedValues(), 0);
+}
@@ -1,8 +1,8 @@
 #include "proto_logger.h"
 
 #include <google/protobuf/message.h>
-#include <zlib.h>
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <fstream>
@@ -13,15 +13,21 @@
 #include "base64.h"
 #include "compat_flags.h"
 #include "shared/constants.h"
+#include "software/logger/replay_format.h"
 
 ProtoLogger::ProtoLogger(const std::string& log_path,
                          std::function<double()> time_provider,
-                         const bool friendly_colour_yellow)
+                         const bool friendly_colour_yellow,
+                         ReplayCompression compression,
+                         unsigned int num_compression_threads)
     : log_path_(log_path),
       time_provider_(time_provider),
       friendly_colour_yellow_(friendly_colour_yellow),
       stop_logging_(false),
-      buffer_(PROTOBUF_BUFFER_SIZE, true)
+      buffer_(PROTOBUF_BUFFER_SIZE, true),
+      block_compressor_(compression, num_compression_threads,
+                        MAX_PENDING_BLOCKS_PER_COMPRESSION_THREAD *
+                            std::max(num_compression_threads, 1u))
 {
     start_time_ = time_provider_();
 
@@ -61,78 +67,44 @@ void ProtoLogger::logProtobufs()
         std::string log_file_path =
             log_folder_ + std::to_string(replay_index) + "." + REPLAY_FILE_EXTENSION;
 
-        gzFile gz_file = gzopen(log_file_path.c_str(), "wb");
-        if (!gz_file)
-        {
-            std::cerr << "ProtoLogger: Failed to open gzip log file: " << log_file_path
-                      << " Error: " + std::string(strerror(errno))
-                      << "\nStopping ProtoLogger logger thread!" << std::endl;
-            return;
-        }
-
         // Start every replay file with the metadata, which includes the file format
         // version. This allows us to keep backwards compatibility as the replay file
         // format evolves.
-        std::string file_metadata =
-            REPLAY_FILE_VERSION_PREFIX + std::to_string(REPLAY_FILE_VERSION) + "\n";
-        int num_bytes_written = gzwrite(gz_file, file_metadata.c_str(),
-                                        static_cast<unsigned>(file_metadata.size()));
-        if (num_bytes_written != static_cast<int>(file_metadata.size()))
-        {
-            std::cerr << "ProtoLogger: Failed to write metadata to log file: "
-                      << log_file_path << std::endl;
-        }
+        ReplayChunkEncoder encoder;
+        std::string block;
+        encoder.encodeHeader(block);
 
-        while (!shouldStopLogging())
+        // Limit the size of each replay chunk
+        while (!shouldStopLogging() && encoder.size() < REPLAY_MAX_CHUNK_SIZE_BYTES)
         {
             auto serialized_proto_opt =
                 buffer_.popLeastRecentlyAddedValue(BUFFER_BLOCK_TIMEOUT);
-            if (!serialized_proto_opt.has_value())
+            if (serialized_proto_opt.has_value())
             {
-                // Timed out without getting a new value
-                continue;
+                const auto& [proto_full_name, serialized_proto, receive_time_sec] =
+                    serialized_proto_opt.value();
+                encoder.encodeEntry(proto_full_name, serialized_proto, receive_time_sec,
+                                    block);
             }
 
-            const auto& [proto_full_name, serialized_proto, receive_time_sec] =
-                serialized_proto_opt.value();
-
-            // Write the log entry to the file with the format:
-            std::string log_entry =
-                createLogEntry(proto_full_name, serialized_proto, receive_time_sec);
-            num_bytes_written = gzwrite(gz_file, log_entry.c_str(),
-                                        static_cast<unsigned>(log_entry.size()));
-
-            // Check if write was successful
-            if (num_bytes_written != static_cast<int>(log_entry.size()))
+            // Hand off full blocks to be compressed. Partial blocks are handed off
+            // whenever we time out without getting a new value, so the log file keeps
+            // up with the protobufs when only a few are being logged.
+            if (block.size() >= REPLAY_BLOCK_SIZE_BYTES ||
+                (!serialized_proto_opt.has_value() && !block.empty()))
             {
-                // Only log every FAILED_LOG_PRINT_FREQUENCY times to avoid
-                // spamming the console if the error persists.
-                if (failed_logs_frequency_counter_ == 0)
-                {
-                    std::cerr << "ProtoLogger: Failed to write " << proto_full_name
-                              << " to log file: " << log_file_path << " "
-                              << std::to_string(failed_logs_frequency_counter_)
-                              << " times" << std::endl;
-                }
-                failed_logs_frequency_counter_ =
-                    (failed_logs_frequency_counter_ + 1) % FAILED_LOG_PRINT_FREQUENCY;
-            }
-
-            // Limit the size of each replay chunk
-            if (gzoffset(gz_file) > REPLAY_MAX_CHUNK_SIZE_BYTES)
-            {
-                break;
+                block_compressor_.appendBlock(log_file_path, std::move(block));
+                block.clear();
             }
         }
 
-        int result = gzclose(gz_file);
-        if (result != Z_OK)
-        {
-            std::cerr << "ProtoLogger: Failed to close log file: " << log_file_path
-                      << " with error " << result << std::endl;
-        }
+        // End the chunk with the index of its entries
+        encoder.encodeFooter(block);
+        block_compressor_.appendBlock(log_file_path, std::move(block));
         replay_index++;
     }
+
+    block_compressor_.flush();
 }
 
 std::string ProtoLogger::createLogEntry(const std::string& proto_full_name,
@@ -6,6 +6,7 @@
 #include <string>
 #include <thread>
 
+#include "software/logger/parallel_block_compressor.h"
 #include "software/multithreading/thread_safe_buffer.hpp"
 
 /**
@@ -14,12 +15,17 @@
  * Each entry will contain:
  *  - The timestamp
  *  - The protobuf type
- *  - The protobuf serialized as base64 (to remove newline characters)
+ *  - The serialized protobuf
  *
  * Stored in log_path/proto_YYYY_MM_DD_HH_MM_SS/
- * With each entry in the file formatted as timestamp,protobuf_type,protobuf_base64
+ * With the entries encoded in the binary replay format, see ReplayChunkEncoder.
  * Note that in order to reduce the size of the log files, the files are compressed
- * using gzip.
+ * using zstd (or gzip, see ReplayCompression).
+ *
+ * The logging thread only encodes the entries into blocks of
+ * REPLAY_BLOCK_SIZE_BYTES. The blocks are compressed on a pool of threads and
+ * appended to the files in order by a ParallelBlockCompressor, so compressing doesn't
+ * hold up emptying the buffer of protobufs to log.
  *
  * We need to store the data in a way that we can:
  *  1. Replay the data chronologically
@@ -27,9 +33,10 @@
  *
  * To seek to a specific time, we need to load the entire log file into memory.
  * To make this feasible, we store the data in chunks. Each chunk contains
- * REPLAY_MAX_CHUNK_SIZE_BYTES of serialized protos.
- * We can load each chunk into memory and perform search operations to find the
- * appropriate entry. Or we can just play the chunks in order.
+ * REPLAY_MAX_CHUNK_SIZE_BYTES of serialized protos, and ends with an index of where
+ * each entry starts by its timestamp.
+ * We can load each chunk into memory and seek to the appropriate entry with the
+ * index. Or we can just play the chunks in order.
  */
 class ProtoLogger
 {
@@ -44,15 +51,24 @@ class ProtoLogger
     };
 
    public:
+    // zstd compresses a block much faster than it takes to fill one at full system
+    // rates, so a couple of threads leave plenty of headroom
+    static constexpr unsigned int DEFAULT_NUM_COMPRESSION_THREADS = 2;
+
     /**
      * Constructor
      * @param log_path The path to the directory where the logs will be saved
      * @param time_provider A function that returns the current time in seconds
      * @param friendly_colour_yellow Whether the friendly team is yellow or not
+     * @param compression How to compress the log files
+     * @param num_compression_threads The number of threads that compress the log
+     * files
      */
-    explicit ProtoLogger(const std::string& log_path,
-                         std::function<double()> time_provider,
-                         bool friendly_colour_yellow);
+    explicit ProtoLogger(
+        const std::string& log_path, std::function<double()> time_provider,
+        bool friendly_colour_yellow,
+        ReplayCompression compression        = ReplayCompression::ZSTD,
+        unsigned int num_compression_threads = DEFAULT_NUM_COMPRESSION_THREADS);
 
     ProtoLogger() = delete;
 
@@ -107,7 +123,8 @@ class ProtoLogger
     void flushAndStopLogging();
 
     /**
-     * Helper function for creating a log entry
+     * Helper function for creating a log entry in the text format of replay file
+     * version 2, which is still supported by the replay readers
      * @param protobuf_type_full_name The full name of the protobuf message type
      * (e.g. TbotsProto.ThunderbotsConfig)
      * @param serialized_proto The serialized protobuf message to store
@@ -135,18 +152,21 @@ class ProtoLogger
     std::function<double()> time_provider_;
     double start_time_;
     bool friendly_colour_yellow_;
-    unsigned int failed_logs_frequency_counter_ = 0;
 
     std::thread log_thread_;
     std::atomic<bool> stop_logging_;
     double destructor_called_time_sec_;
 
     ThreadSafeBuffer<SerializedProtoLog> buffer_;
+    ParallelBlockCompressor block_compressor_;
 
     const Duration BUFFER_BLOCK_TIMEOUT                = Duration::fromSeconds(0.1);
     const std::string REPLAY_FILE_PREFIX               = "proto_";
     const std::string REPLAY_FILE_TIME_FORMAT          = "%Y_%m_%d_%H_%M_%S";
     static constexpr unsigned int PROTOBUF_BUFFER_SIZE = 1000;
     static constexpr unsigned int REPLAY_MAX_CHUNK_SIZE_BYTES = 1024 * 1024;  // 1 MB
-    static constexpr unsigned int FAILED_LOG_PRINT_FREQUENCY  = 100;
+    static constexpr unsigned int REPLAY_BLOCK_SIZE_BYTES     = 128 * 1024;   // 128 KB
+    // Enough blocks for every compression thread to have one to work on, and one
+    // more waiting for it
+    static constexpr size_t MAX_PENDING_BLOCKS_PER_COMPRESSION_THREAD = 2;
 };
@@ -0,0 +1,195 @@
+#include <sys/resource.h>
+
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <thread>
+
+#include "software/logger/compat_flags.h"
+#include "software/logger/proto_logger.h"
+#include "software/logger/replay_reader.h"
+
+/**
+ * Measures how many messages per second the ProtoLogger can log, and how much CPU it
+ * uses to do so, at the default chunk size.
+ *
+ * Messages are saved as fast as possible, or at the given rate, and the log is read
+ * back afterwards to count how many of them made it into the log. Messages that are
+ * saved while the buffer of the ProtoLogger is full are dropped.
+ */
+
+namespace
+{
+    /**
+     * Returns the CPU time used by this process so far, in all threads
+     *
+     * @return the user and system CPU time in seconds
+     */
+    double processCpuTimeSec()
+    {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+               static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) /
+                   1e6;
+    }
+
+    /**
+     * Creates messages that compress about as well as serialized protobufs of robot
+     * and ball states do: doubles of which only some change between messages, with
+     * some structure in between
+     *
+     * @param num_messages The number of messages to create
+     * @param message_size The size of each message in bytes
+     *
+     * @return the messages
+     */
+    std::vector<std::string> createMessages(unsigned int num_messages,
+                                            unsigned int message_size)
+    {
+        std::mt19937 random_engine(0);
+        std::normal_distribution<double> noise(0, 0.01);
+
+        std::vector<double> values(message_size / (sizeof(double) + 1), 0);
+        std::vector<std::string> messages;
+        for (unsigned int i = 0; i < num_messages; i++)
+        {
+            std::string message;
+            for (size_t field = 0; field < values.size(); field++)
+            {
+                if (field % 4 == 0)
+                {
+                    values[field] += noise(random_engine);
+                }
+                // Each double is preceded by its field tag, like in a protobuf
+                message.push_back(static_cast<char>((field % 15 + 1) << 3 | 1));
+                message.append(reinterpret_cast<const char*>(&values[field]),
+                               sizeof(double));
+            }
+            message.resize(message_size, '\0');
+            messages.push_back(std::move(message));
+        }
+        return messages;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    struct CommandLineArgs
+    {
+        bool help                        = false;
+        unsigned int num_messages        = 200000;
+        unsigned int message_size        = 2000;
+        double rate                      = 0;
+        std::string compression          = "zstd";
+        unsigned int compression_threads = ProtoLogger::DEFAULT_NUM_COMPRESSION_THREADS;
+    };
+
+    CommandLineArgs args;
+    boost::program_options::options_description desc{"Options"};
+    desc.add_options()("help,h", boost::program_options::bool_switch(&args.help),
+                       "Help screen");
+    desc.add_options()("messages",
+                       boost::program_options::value<unsigned int>(&args.num_messages),
+                       "The number of messages to log.");
+    desc.add_options()("message_size",
+                       boost::program_options::value<unsigned int>(&args.message_size),
+                       "The size of each message in bytes.");
+    desc.add_options()("rate", boost::program_options::value<double>(&args.rate),
+                       "The number of messages to save per second. If not given, "
+                       "messages are saved as fast as possible.");
+    desc.add_options()("compression",
+                       boost::program_options::value<std::string>(&args.compression),
+                       "How to compress the log, either zstd or gzip.");
+    desc.add_options()(
+        "compression_threads",
+        boost::program_options::value<unsigned int>(&args.compression_threads),
+        "The number of threads that compress the log.");
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (args.help)
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+    if (args.compression != "zstd" && args.compression != "gzip")
+    {
+        std::cerr << "Unknown compression " << args.compression << std::endl;
+        return 1;
+    }
+
+    // Messages are reused so creating them isn't part of the measurement
+    const std::vector<std::string> messages = createMessages(256, args.message_size);
+    const std::string log_path =
+        (fs::temp_directory_path() / "proto_logger_benchmark").string();
+    fs::remove_all(log_path);
+
+    auto start                 = std::chrono::steady_clock::now();
+    const double cpu_start_sec = processCpuTimeSec();
+    {
+        ProtoLogger proto_logger(
+            log_path,
+            [&]()
+            {
+                return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                     start)
+                    .count();
+            },
+            false,
+            args.compression == "zstd" ? ReplayCompression::ZSTD
+                                       : ReplayCompression::GZIP,
+            args.compression_threads);
+
+        for (unsigned int i = 0; i < args.num_messages; i++)
+        {
+            if (args.rate > 0)
+            {
+                std::chrono::duration<double> save_time(i / args.rate);
+                std::this_thread::sleep_until(
+                    start +
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(save_time));
+            }
+            proto_logger.saveSerializedProto("TbotsProto.World",
+                                             messages[i % messages.size()]);
+        }
+    }
+    const double elapsed_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double cpu_sec = processCpuTimeSec() - cpu_start_sec;
+
+    // The ProtoLogger writes its chunks to a new folder in the given one
+    const fs::path log_folder = fs::directory_iterator(log_path)->path();
+    unsigned int num_chunks   = 0;
+    uintmax_t num_bytes       = 0;
+    for (const auto& file : fs::directory_iterator(log_folder))
+    {
+        num_chunks++;
+        num_bytes += fs::file_size(file.path());
+    }
+    unsigned int num_logged = 0;
+    ReplayReader reader(log_folder.string());
+    while (reader.nextEntry())
+    {
+        num_logged++;
+    }
+    fs::remove_all(log_path);
+
+    std::cout << "Compression: " << args.compression << " with "
+              << args.compression_threads << " threads" << std::endl
+              << "Messages saved: " << args.num_messages << std::endl
+              << "Messages logged: " << num_logged << std::endl
+              << "Messages dropped: " << args.num_messages - num_logged << std::endl
+              << "Logged: " << num_logged / elapsed_sec << " messages/s" << std::endl
+              << "CPU usage: " << 100 * cpu_sec / elapsed_sec << "% of a core"
+              << std::endl
+              << "Compression ratio: "
+              << static_cast<double>(num_logged) * args.message_size /
+                     static_cast<double>(num_bytes)
+              << " over " << num_chunks << " chunks" << std::endl;
+
+    return 0;
+}
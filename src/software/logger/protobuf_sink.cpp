@@ -6,14 +6,11 @@
 #include "google/protobuf/text_format.h"
 #include "proto/robot_log_msg.pb.h"
 #include "shared/constants.h"
+#include "software/logger/visualizer.h"
 
-ProtobufSink::ProtobufSink(std::string runtime_dir,
-                           const std::shared_ptr<ProtoLogger>& proto_logger)
-    : proto_logger(proto_logger)
+ProtobufSink::ProtobufSink(std::string runtime_dir)
+    : log_sender_(std::make_unique<ThreadedUnixSender>(runtime_dir + "/log"))
 {
-    // Setup the logs
-    unix_senders_["log"] = std::make_unique<ThreadedUnixSender>(runtime_dir + "/log");
-    runtime_dir_         = runtime_dir;
 }
 
 void ProtobufSink::sendProtobuf(g3::LogMessageMover log_entry)
@@ -33,27 +30,9 @@ void ProtobufSink::sendProtobuf(g3::LogMessageMover log_entry)
         std::string serialized_proto =
             base64_decode(msg.substr(proto_type_name_pos + TYPE_DELIMITER.length()));
 
-        if (proto_logger)
-        {
-            proto_logger->saveSerializedProto(proto_type_name, serialized_proto);
-        }
-
-        // Use the protobuf type as the file name, if no file name was specified in the
-        // message
-        if (file_name.length() == 0)
-        {
-            file_name = "/" + proto_type_name;
-        }
-
-        // If we don't already have a unix sender for this type, let's create it
-        if (unix_senders_.count(file_name) == 0)
-        {
-            unix_senders_[file_name] =
-                std::make_unique<ThreadedUnixSender>(runtime_dir_ + file_name);
-        }
-
-        // Send the protobuf
-        unix_senders_[file_name]->sendString(serialized_proto);
+        // LOG(VISUALIZE) is kept for compatibility, and publishes the protobuf the same
+        // way the Visualizer does
+        Visualizer::publishSerialized(proto_type_name, serialized_proto, file_name);
     }
     else
     {
@@ -76,7 +55,7 @@ void ProtobufSink::sendProtobuf(g3::LogMessageMover log_entry)
 
             std::string log_msg;
             log_msg_proto.SerializeToString(&log_msg);
-            unix_senders_["log"]->sendString(log_msg);
+            log_sender_->sendString(log_msg);
         }
     }
 }
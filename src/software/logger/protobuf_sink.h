@@ -5,16 +5,11 @@
 
 #include "google/protobuf/any.pb.h"
 #include "software/logger/custom_logging_levels.h"
-#include "software/logger/proto_logger.h"
 #include "software/networking/unix/threaded_unix_sender.h"
 
 static const std::string TYPE_DELIMITER = "!!!";
 
 
-using UnixSenderMap =
-    std::unordered_map<std::string, std::unique_ptr<ThreadedUnixSender>>;
-
-
 class ProtobufSink
 {
    public:
@@ -23,20 +18,18 @@ class ProtobufSink
      *
      * @param runtime_dir The runtime directory
      */
-    ProtobufSink(std::string runtime_dir,
-                 const std::shared_ptr<ProtoLogger>& proto_logger);
+    explicit ProtobufSink(std::string runtime_dir);
 
     /*
-     * Send the protobuf to /tmp/tbots/(protobuf typename)
+     * Send logs to /tmp/tbots/log, and forward protobufs logged with LOG(VISUALIZE) to
+     * the Visualizer
      *
      * @param log_entry The entry to log
      */
     void sendProtobuf(g3::LogMessageMover log_entry);
 
    private:
-    UnixSenderMap unix_senders_;
-    std::string runtime_dir_;
-    std::shared_ptr<ProtoLogger> proto_logger;
+    std::unique_ptr<ThreadedUnixSender> log_sender_;
 };
 
 /*
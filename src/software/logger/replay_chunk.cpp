@@ -0,0 +1,187 @@
+#include "software/logger/replay_chunk.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "base64.h"
+#include "shared/constants.h"
+#include "software/logger/replay_compression.h"
+
+ReplayChunk::ReplayChunk(const std::string& chunk_path)
+    : mapped_chunk(nullptr), mapped_chunk_size(0), loaded_chunk(), chunk(), entries()
+{
+    if (mapUncompressedChunk(chunk_path))
+    {
+        chunk = std::string_view(static_cast<const char*>(mapped_chunk),
+                                 mapped_chunk_size);
+    }
+    else
+    {
+        loaded_chunk = readReplayChunk(chunk_path);
+        chunk        = loaded_chunk;
+    }
+
+    // Every chunk starts with the version of the replay file format
+    const std::string text_metadata = REPLAY_FILE_VERSION_PREFIX +
+                                      std::to_string(LAST_TEXT_REPLAY_FILE_VERSION) +
+                                      "\n";
+    if (chunk.starts_with(text_metadata))
+    {
+        std::string binary_chunk = encodeTextChunk(chunk.substr(text_metadata.size()));
+        if (mapped_chunk)
+        {
+            munmap(mapped_chunk, mapped_chunk_size);
+            mapped_chunk = nullptr;
+        }
+        loaded_chunk = std::move(binary_chunk);
+        chunk        = loaded_chunk;
+    }
+
+    try
+    {
+        ReplayChunkDecoder decoder(chunk);
+        // The footer tells us how many entries there are, if the chunk has one
+        entries.reserve(decoder.index().size());
+        while (std::optional<ReplayEntryView> entry = decoder.nextEntry())
+        {
+            entries.push_back(*entry);
+        }
+    }
+    catch (const std::invalid_argument&)
+    {
+        throw std::invalid_argument("Unsupported replay file version in " +
+                                    chunk_path);
+    }
+}
+
+ReplayChunk::~ReplayChunk()
+{
+    if (mapped_chunk)
+    {
+        munmap(mapped_chunk, mapped_chunk_size);
+    }
+}
+
+size_t ReplayChunk::size() const
+{
+    return entries.size();
+}
+
+const ReplayEntryView& ReplayChunk::entry(size_t index) const
+{
+    return entries.at(index);
+}
+
+size_t ReplayChunk::findEntry(double receive_time_sec) const
+{
+    auto entry = std::lower_bound(entries.begin(), entries.end(), receive_time_sec,
+                                  [](const ReplayEntryView& entry, double time)
+                                  { return entry.receive_time_sec < time; });
+    return static_cast<size_t>(entry - entries.begin());
+}
+
+std::vector<double> ReplayChunk::receiveTimesOfType(
+    std::string_view protobuf_type_full_name) const
+{
+    std::vector<double> receive_times;
+    for (const ReplayEntryView& entry : entries)
+    {
+        if (entry.protobuf_type_full_name == protobuf_type_full_name)
+        {
+            receive_times.push_back(entry.receive_time_sec);
+        }
+    }
+    return receive_times;
+}
+
+std::string_view ReplayChunk::data() const
+{
+    return chunk;
+}
+
+bool ReplayChunk::mapUncompressedChunk(const std::string& chunk_path)
+{
+    int file_descriptor = open(chunk_path.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+    {
+        throw std::invalid_argument("Failed to open replay file " + chunk_path);
+    }
+
+    struct stat file_status;
+    char chunk_start[4];
+    ssize_t chunk_start_size =
+        pread(file_descriptor, chunk_start, sizeof(chunk_start), 0);
+    if (fstat(file_descriptor, &file_status) != 0 || file_status.st_size == 0 ||
+        chunk_start_size <= 0 ||
+        isCompressedReplayChunk(
+            std::string_view(chunk_start, static_cast<size_t>(chunk_start_size))))
+    {
+        close(file_descriptor);
+        return false;
+    }
+
+    mapped_chunk_size = static_cast<size_t>(file_status.st_size);
+    mapped_chunk =
+        mmap(nullptr, mapped_chunk_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    // The mapping stays valid after the file is closed
+    close(file_descriptor);
+    if (mapped_chunk == MAP_FAILED)
+    {
+        mapped_chunk      = nullptr;
+        mapped_chunk_size = 0;
+        return false;
+    }
+    return true;
+}
+
+std::string ReplayChunk::encodeTextChunk(std::string_view text_chunk)
+{
+    ReplayChunkEncoder encoder;
+    std::string binary_chunk;
+    encoder.encodeHeader(binary_chunk);
+
+    size_t line_start = 0;
+    while (line_start < text_chunk.size())
+    {
+        size_t line_end = text_chunk.find('\n', line_start);
+        if (line_end == std::string_view::npos)
+        {
+            line_end = text_chunk.size();
+        }
+        std::string_view line = text_chunk.substr(line_start, line_end - line_start);
+        line_start            = line_end + 1;
+
+        // <time>,<protobuf_type_full_name>,<base64_encoded_serialized_proto>
+        const size_t type_start = line.find(REPLAY_METADATA_DELIMITER);
+        if (type_start == std::string_view::npos)
+        {
+            continue;
+        }
+        const size_t data_start = line.find(REPLAY_METADATA_DELIMITER, type_start + 1);
+        if (data_start == std::string_view::npos)
+        {
+            continue;
+        }
+
+        try
+        {
+            double receive_time_sec = std::stod(std::string(line.substr(0, type_start)));
+            std::string serialized_proto =
+                base64_decode(std::string(line.substr(data_start + 1)));
+            encoder.encodeEntry(line.substr(type_start + 1, data_start - type_start - 1),
+                                serialized_proto, receive_time_sec, binary_chunk);
+        }
+        catch (const std::exception&)
+        {
+            continue;
+        }
+    }
+
+    encoder.encodeFooter(binary_chunk);
+    return binary_chunk;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "software/logger/replay_format.h"
+
+/**
+ * A replay chunk loaded into memory, with its entries indexed for random access.
+ *
+ * Chunks that aren't compressed (e.g. ones that were decompressed with the zstd or
+ * gzip command line tools) are memory mapped, so entries are read straight from the
+ * page cache. Compressed chunks are decompressed in one go, which only takes a few
+ * milliseconds for a chunk of the size the ProtoLogger writes. Chunks in the text
+ * format of replay file version 2 are decoded and re-encoded in the binary format
+ * when they are loaded, so all chunks are read the same way.
+ *
+ * The entries point into the chunk, so nothing is copied to read them.
+ */
+class ReplayChunk
+{
+   public:
+    /**
+     * Loads and indexes a replay chunk
+     *
+     * @throws std::invalid_argument if the chunk can't be read, or was written in a
+     * replay file version that isn't supported
+     *
+     * @param chunk_path The path to the replay chunk
+     */
+    explicit ReplayChunk(const std::string& chunk_path);
+
+    ReplayChunk()                              = delete;
+    ReplayChunk(const ReplayChunk&)            = delete;
+    ReplayChunk& operator=(const ReplayChunk&) = delete;
+
+    ~ReplayChunk();
+
+    /**
+     * Returns the number of entries in the chunk
+     *
+     * @return the number of entries
+     */
+    size_t size() const;
+
+    /**
+     * Returns an entry of the chunk
+     *
+     * @throws std::out_of_range if there is no entry at the index
+     *
+     * @param index The index of the entry, in the order the entries were logged
+     *
+     * @return the entry, which points into the chunk
+     */
+    const ReplayEntryView& entry(size_t index) const;
+
+    /**
+     * Finds the first entry received at or after the given time. Entries are assumed
+     * to be logged in the order they were received.
+     *
+     * @param receive_time_sec The time to find
+     *
+     * @return the index of the entry, or the number of entries if every entry was
+     * received before the given time
+     */
+    size_t findEntry(double receive_time_sec) const;
+
+    /**
+     * Returns when each entry of a protobuf type was received
+     *
+     * @param protobuf_type_full_name The full name of the protobuf message type
+     *
+     * @return the receive times of the entries of that type, in order
+     */
+    std::vector<double> receiveTimesOfType(
+        std::string_view protobuf_type_full_name) const;
+
+    /**
+     * Returns the decompressed chunk that the entries point into
+     *
+     * @return the decompressed chunk, in the binary replay format
+     */
+    std::string_view data() const;
+
+   private:
+    /**
+     * Memory maps the chunk file if it isn't compressed
+     *
+     * @param chunk_path The path to the replay chunk
+     *
+     * @return whether the chunk was mapped
+     */
+    bool mapUncompressedChunk(const std::string& chunk_path);
+
+    /**
+     * Re-encodes a text chunk in the binary format, skipping corrupt lines
+     *
+     * @param text_chunk The text chunk, after the metadata line
+     *
+     * @return the chunk in the binary format
+     */
+    static std::string encodeTextChunk(std::string_view text_chunk);
+
+    // The last replay file version that stores each entry as a line of text
+    static constexpr unsigned int LAST_TEXT_REPLAY_FILE_VERSION = 2;
+
+    // The chunk file mapped into memory, if it isn't compressed
+    void* mapped_chunk;
+    size_t mapped_chunk_size;
+    // The decompressed or re-encoded chunk otherwise
+    std::string loaded_chunk;
+    std::string_view chunk;
+    std::vector<ReplayEntryView> entries;
+};
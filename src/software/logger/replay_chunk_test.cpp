@@ -0,0 +1,164 @@
+#include "software/logger/replay_chunk.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "shared/constants.h"
+#include "software/logger/compat_flags.h"
+#include "software/logger/proto_logger.h"
+#include "software/logger/replay_compression.h"
+
+class ReplayChunkTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        fs::remove_all(replay_folder);
+        fs::create_directories(replay_folder);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(replay_folder);
+    }
+
+    /**
+     * Encodes a binary chunk with an entry every 0.5 seconds, alternating between
+     * two types
+     *
+     * @param with_footer Whether to end the chunk with the footer
+     *
+     * @return the chunk
+     */
+    std::string encodeChunk(bool with_footer)
+    {
+        ReplayChunkEncoder encoder;
+        std::string chunk;
+        encoder.encodeHeader(chunk);
+        for (size_t i = 0; i < serialized_protos.size(); i++)
+        {
+            encoder.encodeEntry(i % 2 == 0 ? "TbotsProto.World" : "TbotsProto.Primitive",
+                                serialized_protos[i], 0.5 * static_cast<double>(i),
+                                chunk);
+        }
+        if (with_footer)
+        {
+            encoder.encodeFooter(chunk);
+        }
+        return chunk;
+    }
+
+    /**
+     * Writes a chunk to the replay folder as it is
+     *
+     * @param contents The contents of the chunk file
+     *
+     * @return the path to the chunk
+     */
+    std::string writeChunk(const std::string& contents)
+    {
+        std::string path = replay_folder + "/0." + REPLAY_FILE_EXTENSION;
+        std::ofstream(path, std::ios::binary) << contents;
+        return path;
+    }
+
+    /**
+     * Checks that a chunk has the entries of encodeChunk
+     *
+     * @param chunk The chunk to check
+     */
+    void expectEncodedEntries(const ReplayChunk& chunk)
+    {
+        ASSERT_EQ(serialized_protos.size(), chunk.size());
+        for (size_t i = 0; i < chunk.size(); i++)
+        {
+            const ReplayEntryView& entry = chunk.entry(i);
+            EXPECT_EQ(0.5 * static_cast<double>(i), entry.receive_time_sec);
+            EXPECT_EQ(i % 2 == 0 ? "TbotsProto.World" : "TbotsProto.Primitive",
+                      entry.protobuf_type_full_name);
+            EXPECT_EQ(serialized_protos[i], entry.serialized_proto);
+
+            // Entries point into the chunk instead of being copied
+            EXPECT_GE(entry.serialized_proto.data(), chunk.data().data());
+            EXPECT_LE(entry.serialized_proto.data() + entry.serialized_proto.size(),
+                      chunk.data().data() + chunk.data().size());
+        }
+        EXPECT_THROW(chunk.entry(chunk.size()), std::out_of_range);
+    }
+
+    const std::vector<std::string> serialized_protos = {
+        "first", std::string("a,b\n\0c", 6), "", std::string(300, 'x'), "last"};
+    const std::string replay_folder =
+        (fs::temp_directory_path() / "replay_chunk_test").string();
+};
+
+TEST_F(ReplayChunkTest, reads_compressed_chunk)
+{
+    std::string chunk = encodeChunk(true);
+    ReplayChunk replay_chunk(
+        writeChunk(compressReplayBlock(chunk.substr(0, 20), ReplayCompression::ZSTD) +
+                   compressReplayBlock(chunk.substr(20), ReplayCompression::GZIP)));
+
+    expectEncodedEntries(replay_chunk);
+}
+
+TEST_F(ReplayChunkTest, reads_uncompressed_chunk)
+{
+    ReplayChunk replay_chunk(writeChunk(encodeChunk(true)));
+
+    expectEncodedEntries(replay_chunk);
+}
+
+TEST_F(ReplayChunkTest, indexes_chunk_without_footer)
+{
+    std::string chunk = encodeChunk(false);
+    // Cut the last entry off, like a crash while logging would
+    ReplayChunk replay_chunk(writeChunk(chunk.substr(0, chunk.size() - 2)));
+
+    EXPECT_EQ(serialized_protos.size() - 1, replay_chunk.size());
+    EXPECT_EQ("first", replay_chunk.entry(0).serialized_proto);
+}
+
+TEST_F(ReplayChunkTest, finds_entries_by_receive_time)
+{
+    ReplayChunk replay_chunk(writeChunk(encodeChunk(true)));
+
+    EXPECT_EQ(0, replay_chunk.findEntry(-1));
+    EXPECT_EQ(0, replay_chunk.findEntry(0));
+    EXPECT_EQ(2, replay_chunk.findEntry(0.75));
+    EXPECT_EQ(2, replay_chunk.findEntry(1));
+    EXPECT_EQ(serialized_protos.size(), replay_chunk.findEntry(100));
+
+    EXPECT_EQ(std::vector<double>({0, 1, 2}),
+              replay_chunk.receiveTimesOfType("TbotsProto.World"));
+    EXPECT_EQ(std::vector<double>({0.5, 1.5}),
+              replay_chunk.receiveTimesOfType("TbotsProto.Primitive"));
+    EXPECT_TRUE(replay_chunk.receiveTimesOfType("TbotsProto.Missing").empty());
+}
+
+TEST_F(ReplayChunkTest, reads_text_chunk_and_skips_corrupt_lines)
+{
+    std::string chunk =
+        REPLAY_FILE_VERSION_PREFIX + "2\n" +
+        ProtoLogger::createLogEntry("TbotsProto.World", serialized_protos[1], 1) +
+        "not an entry\n" + "1.5,TbotsProto.World,!!!\n" +
+        ProtoLogger::createLogEntry("TbotsProto.Primitive", "valid", 2) +
+        "2.5,TbotsProto.Wor";
+    ReplayChunk replay_chunk(
+        writeChunk(compressReplayBlock(chunk, ReplayCompression::GZIP)));
+
+    ASSERT_EQ(2, replay_chunk.size());
+    EXPECT_EQ(1, replay_chunk.entry(0).receive_time_sec);
+    EXPECT_EQ(serialized_protos[1], replay_chunk.entry(0).serialized_proto);
+    EXPECT_EQ("TbotsProto.Primitive", replay_chunk.entry(1).protobuf_type_full_name);
+    EXPECT_EQ("valid", replay_chunk.entry(1).serialized_proto);
+}
+
+TEST_F(ReplayChunkTest, unreadable_chunks_throw)
+{
+    EXPECT_THROW(ReplayChunk(replay_folder + "/missing.replay"), std::invalid_argument);
+    EXPECT_THROW(ReplayChunk(writeChunk("1.0,TbotsProto.World,b'AAAA'\n")),
+                 std::invalid_argument);
+    EXPECT_THROW(ReplayChunk(writeChunk("")), std::invalid_argument);
+}
@@ -0,0 +1,207 @@
+#include "software/logger/replay_compression.h"
+
+#include <zlib.h>
+#include <zstd.h>
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    // The default level of zstd, which compresses about as well as gzip does at its
+    // default level while being several times faster
+    constexpr int ZSTD_COMPRESSION_LEVEL = 3;
+    // Passing 16 more than the maximum window size makes zlib write and read gzip
+    // members instead of raw zlib streams
+    constexpr int GZIP_WINDOW_BITS = 15 + 16;
+
+    constexpr std::string_view ZSTD_FRAME_MAGIC{"\x28\xB5\x2F\xFD"};
+    constexpr std::string_view GZIP_MEMBER_MAGIC{"\x1F\x8B"};
+
+    /**
+     * Compresses data into a single zstd frame
+     *
+     * @param data The data to compress
+     *
+     * @return the frame, or an empty string if zstd failed to compress the data
+     */
+    std::string compressZstd(std::string_view data)
+    {
+        std::string compressed(ZSTD_compressBound(data.size()), '\0');
+        size_t compressed_size =
+            ZSTD_compress(compressed.data(), compressed.size(), data.data(),
+                          data.size(), ZSTD_COMPRESSION_LEVEL);
+        if (ZSTD_isError(compressed_size))
+        {
+            return "";
+        }
+        compressed.resize(compressed_size);
+        return compressed;
+    }
+
+    /**
+     * Compresses data into a single gzip member
+     *
+     * @param data The data to compress
+     *
+     * @return the member, or an empty string if zlib failed to compress the data
+     */
+    std::string compressGzip(std::string_view data)
+    {
+        z_stream stream{};
+        if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, GZIP_WINDOW_BITS, 8,
+                         Z_DEFAULT_STRATEGY) != Z_OK)
+        {
+            return "";
+        }
+
+        std::string compressed(deflateBound(&stream, data.size()), '\0');
+        stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+        stream.avail_in  = static_cast<uInt>(data.size());
+        stream.next_out  = reinterpret_cast<Bytef*>(compressed.data());
+        stream.avail_out = static_cast<uInt>(compressed.size());
+        int result       = deflate(&stream, Z_FINISH);
+        compressed.resize(stream.total_out);
+        deflateEnd(&stream);
+
+        return result == Z_STREAM_END ? compressed : "";
+    }
+
+    /**
+     * Decompresses the zstd frame at the start of the given data
+     *
+     * @param compressed The data, which may continue past the end of the frame
+     * @param output The string to append the decompressed frame to
+     *
+     * @return the size of the frame, or 0 if it is corrupt or cut off
+     */
+    size_t decompressZstdFrame(std::string_view compressed, std::string& output)
+    {
+        ZSTD_DCtx* context = ZSTD_createDCtx();
+        ZSTD_inBuffer input{compressed.data(), compressed.size(), 0};
+        std::string buffer(ZSTD_DStreamOutSize(), '\0');
+
+        bool frame_complete = false;
+        while (true)
+        {
+            ZSTD_outBuffer buffer_output{buffer.data(), buffer.size(), 0};
+            size_t result = ZSTD_decompressStream(context, &buffer_output, &input);
+            if (ZSTD_isError(result))
+            {
+                break;
+            }
+            output.append(buffer.data(), buffer_output.pos);
+
+            // The frame is only done once all of it has been flushed to the output
+            if (result == 0)
+            {
+                frame_complete = true;
+                break;
+            }
+            if (input.pos == input.size && buffer_output.pos < buffer_output.size)
+            {
+                break;
+            }
+        }
+
+        ZSTD_freeDCtx(context);
+        return frame_complete ? input.pos : 0;
+    }
+
+    /**
+     * Decompresses the gzip member at the start of the given data
+     *
+     * @param compressed The data, which may continue past the end of the member
+     * @param output The string to append the decompressed member to
+     *
+     * @return the size of the member, or 0 if it is corrupt or cut off
+     */
+    size_t decompressGzipMember(std::string_view compressed, std::string& output)
+    {
+        z_stream stream{};
+        if (inflateInit2(&stream, GZIP_WINDOW_BITS) != Z_OK)
+        {
+            return 0;
+        }
+
+        stream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+        stream.avail_in = static_cast<uInt>(compressed.size());
+        char buffer[1 << 16];
+        int result;
+        do
+        {
+            stream.next_out  = reinterpret_cast<Bytef*>(buffer);
+            stream.avail_out = sizeof(buffer);
+            result           = inflate(&stream, Z_NO_FLUSH);
+            output.append(buffer, sizeof(buffer) - stream.avail_out);
+        } while (result == Z_OK);
+
+        size_t member_size = stream.total_in;
+        inflateEnd(&stream);
+        return result == Z_STREAM_END ? member_size : 0;
+    }
+}  // namespace
+
+std::string compressReplayBlock(std::string_view block, ReplayCompression compression)
+{
+    if (compression == ReplayCompression::ZSTD)
+    {
+        std::string compressed = compressZstd(block);
+        if (!compressed.empty())
+        {
+            return compressed;
+        }
+    }
+    return compressGzip(block);
+}
+
+bool isCompressedReplayChunk(std::string_view chunk_start)
+{
+    return chunk_start.starts_with(ZSTD_FRAME_MAGIC) ||
+           chunk_start.starts_with(GZIP_MEMBER_MAGIC);
+}
+
+std::string decompressReplayChunk(std::string_view compressed_chunk)
+{
+    if (!isCompressedReplayChunk(compressed_chunk))
+    {
+        return std::string(compressed_chunk);
+    }
+
+    std::string chunk;
+    size_t offset = 0;
+    while (offset < compressed_chunk.size())
+    {
+        std::string_view remaining = compressed_chunk.substr(offset);
+        size_t block_size          = 0;
+        if (remaining.starts_with(ZSTD_FRAME_MAGIC))
+        {
+            block_size = decompressZstdFrame(remaining, chunk);
+        }
+        else if (remaining.starts_with(GZIP_MEMBER_MAGIC))
+        {
+            block_size = decompressGzipMember(remaining, chunk);
+        }
+
+        if (block_size == 0)
+        {
+            break;
+        }
+        offset += block_size;
+    }
+    return chunk;
+}
+
+std::string readReplayChunk(const std::string& chunk_path)
+{
+    std::ifstream chunk_file(chunk_path, std::ios::binary);
+    if (!chunk_file)
+    {
+        throw std::invalid_argument("Failed to open replay file " + chunk_path);
+    }
+
+    std::ostringstream compressed_chunk;
+    compressed_chunk << chunk_file.rdbuf();
+    return decompressReplayChunk(compressed_chunk.str());
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+/**
+ * How the blocks of a replay chunk are compressed.
+ *
+ * Each block is compressed on its own into a zstd frame or a gzip member. A chunk is
+ * the concatenation of its compressed blocks, which is still a valid zstd or gzip
+ * stream, so blocks can be compressed in parallel and the codecs can even be mixed
+ * within a chunk.
+ */
+enum class ReplayCompression
+{
+    // Fast to compress, and the default for new logs
+    ZSTD,
+    // Slower, but readable by any gzip tool
+    GZIP
+};
+
+/**
+ * Compresses a block of a replay chunk. Blocks that zstd fails to compress are
+ * compressed with gzip instead.
+ *
+ * @param block The block to compress
+ * @param compression How to compress the block
+ *
+ * @return the compressed block, or an empty string if it could not be compressed
+ */
+std::string compressReplayBlock(std::string_view block, ReplayCompression compression);
+
+/**
+ * Returns whether a replay chunk is compressed, from the magic number it starts with
+ *
+ * @param chunk_start The start of the chunk, at least 4 bytes of it if it has them
+ *
+ * @return whether the chunk starts with a zstd frame or a gzip member
+ */
+bool isCompressedReplayChunk(std::string_view chunk_start);
+
+/**
+ * Decompresses a replay chunk made of zstd frames and gzip members, detected by their
+ * magic numbers. Chunks that are not compressed at all are returned as they are.
+ *
+ * Decompression stops at the first frame or member that is corrupt or cut off (e.g.
+ * because the logger crashed), after keeping whatever could be decompressed of it.
+ *
+ * @param compressed_chunk The compressed chunk
+ *
+ * @return the decompressed chunk
+ */
+std::string decompressReplayChunk(std::string_view compressed_chunk);
+
+/**
+ * Reads and decompresses a replay chunk file
+ *
+ * @throws std::invalid_argument if the file can't be read
+ *
+ * @param chunk_path The path to the replay chunk
+ *
+ * @return the decompressed chunk
+ */
+std::string readReplayChunk(const std::string& chunk_path);
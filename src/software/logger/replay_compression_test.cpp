@@ -0,0 +1,81 @@
+#include "software/logger/replay_compression.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+class ReplayCompressionTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Creates a block of somewhat compressible binary data
+     *
+     * @param seed The seed of the data
+     *
+     * @return the block
+     */
+    static std::string createBlock(unsigned int seed)
+    {
+        std::mt19937 random_engine(seed);
+        std::uniform_int_distribution<int> byte(0, 15);
+        std::string block;
+        for (int i = 0; i < 100000; i++)
+        {
+            block.push_back(static_cast<char>(byte(random_engine)));
+        }
+        return block;
+    }
+
+    const std::string first_block  = createBlock(0);
+    const std::string second_block = createBlock(1);
+};
+
+TEST_F(ReplayCompressionTest, blocks_round_trip_with_either_compression)
+{
+    for (ReplayCompression compression :
+         {ReplayCompression::ZSTD, ReplayCompression::GZIP})
+    {
+        std::string compressed = compressReplayBlock(first_block, compression);
+        EXPECT_LT(compressed.size(), first_block.size());
+        EXPECT_EQ(first_block, decompressReplayChunk(compressed));
+    }
+}
+
+TEST_F(ReplayCompressionTest, concatenated_blocks_decompress_in_order)
+{
+    std::string chunk = compressReplayBlock(first_block, ReplayCompression::ZSTD) +
+                        compressReplayBlock(second_block, ReplayCompression::GZIP) +
+                        compressReplayBlock(first_block, ReplayCompression::ZSTD);
+
+    EXPECT_EQ(first_block + second_block + first_block, decompressReplayChunk(chunk));
+}
+
+TEST_F(ReplayCompressionTest, decompression_stops_at_cut_off_block)
+{
+    for (ReplayCompression compression :
+         {ReplayCompression::ZSTD, ReplayCompression::GZIP})
+    {
+        std::string first_compressed  = compressReplayBlock(first_block, compression);
+        std::string second_compressed = compressReplayBlock(second_block, compression);
+        std::string chunk =
+            first_compressed + second_compressed.substr(0, second_compressed.size() / 2);
+
+        // Whatever could be decompressed of the cut off block is kept
+        std::string decompressed = decompressReplayChunk(chunk);
+        EXPECT_EQ(first_block, decompressed.substr(0, first_block.size()));
+        EXPECT_LT(decompressed.size(), first_block.size() + second_block.size());
+        EXPECT_EQ(second_block.substr(0, decompressed.size() - first_block.size()),
+                  decompressed.substr(first_block.size()));
+    }
+}
+
+TEST_F(ReplayCompressionTest, uncompressed_chunks_are_returned_as_they_are)
+{
+    EXPECT_EQ("version:3\nentries", decompressReplayChunk("version:3\nentries"));
+    EXPECT_EQ("", decompressReplayChunk(""));
+}
+
+TEST_F(ReplayCompressionTest, reading_missing_chunk_throws)
+{
+    EXPECT_THROW(readReplayChunk("/missing/0.replay"), std::invalid_argument);
+}
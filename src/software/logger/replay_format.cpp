@@ -0,0 +1,232 @@
+#include "software/logger/replay_format.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "shared/constants.h"
+#include "software/util/binary_encoding/binary_encoding.h"
+
+namespace
+{
+    /**
+     * Returns the metadata that every binary replay chunk starts with
+     *
+     * @return the metadata
+     */
+    std::string binaryChunkMetadata()
+    {
+        return REPLAY_FILE_VERSION_PREFIX + std::to_string(REPLAY_FILE_VERSION) + "\n";
+    }
+}  // namespace
+
+ReplayChunkEncoder::ReplayChunkEncoder()
+    : type_ids(), type_names(), index(), num_bytes_encoded(0)
+{
+}
+
+void ReplayChunkEncoder::encodeHeader(std::string& output)
+{
+    std::string metadata = binaryChunkMetadata();
+    num_bytes_encoded += metadata.size();
+    output.append(metadata);
+}
+
+void ReplayChunkEncoder::encodeEntry(std::string_view protobuf_type_full_name,
+                                     std::string_view serialized_proto,
+                                     double receive_time_sec, std::string& output)
+{
+    const size_t initial_size = output.size();
+
+    auto [type_id_iter, new_type] = type_ids.try_emplace(
+        std::string(protobuf_type_full_name),
+        ReplayChunkDecoder::FIRST_TYPE_ID + type_names.size());
+    if (new_type)
+    {
+        type_names.emplace_back(protobuf_type_full_name);
+        appendVarint(ReplayChunkDecoder::TYPE_DEFINITION_TAG, output);
+        appendString(protobuf_type_full_name, output);
+    }
+
+    index.push_back(ReplayIndexEntry{
+        .receive_time_sec = receive_time_sec,
+        .offset           = num_bytes_encoded + (output.size() - initial_size),
+    });
+    appendVarint(type_id_iter->second, output);
+    appendDouble(receive_time_sec, output);
+    appendString(serialized_proto, output);
+
+    num_bytes_encoded += output.size() - initial_size;
+}
+
+void ReplayChunkEncoder::encodeFooter(std::string& output)
+{
+    const size_t initial_size    = output.size();
+    const uint64_t footer_offset = num_bytes_encoded;
+
+    appendVarint(ReplayChunkDecoder::FOOTER_TAG, output);
+    appendVarint(type_names.size(), output);
+    for (const std::string& type_name : type_names)
+    {
+        appendString(type_name, output);
+    }
+    appendVarint(index.size(), output);
+    for (const ReplayIndexEntry& index_entry : index)
+    {
+        appendDouble(index_entry.receive_time_sec, output);
+        appendVarint(index_entry.offset, output);
+    }
+    appendUint64(footer_offset, output);
+    output.append(ReplayChunkDecoder::FOOTER_MAGIC);
+
+    num_bytes_encoded += output.size() - initial_size;
+}
+
+uint64_t ReplayChunkEncoder::size() const
+{
+    return num_bytes_encoded;
+}
+
+ReplayChunkDecoder::ReplayChunkDecoder(std::string_view chunk)
+    : chunk(chunk),
+      offset(0),
+      records_start(0),
+      type_names(),
+      num_type_definitions_read(0),
+      index_()
+{
+    const std::string metadata = binaryChunkMetadata();
+    if (chunk.substr(0, metadata.size()) != metadata)
+    {
+        throw std::invalid_argument("Replay chunk is not in the binary format");
+    }
+    records_start = metadata.size();
+    offset        = records_start;
+    readFooter();
+}
+
+std::optional<ReplayEntryView> ReplayChunkDecoder::nextEntry()
+{
+    while (offset < chunk.size())
+    {
+        std::optional<uint64_t> tag = readVarint(chunk, offset);
+        if (!tag || *tag == FOOTER_TAG)
+        {
+            break;
+        }
+
+        if (*tag == TYPE_DEFINITION_TAG)
+        {
+            std::optional<std::string_view> type_name = readString(chunk, offset);
+            if (!type_name)
+            {
+                break;
+            }
+            // Types read from the footer are already known
+            if (num_type_definitions_read == type_names.size())
+            {
+                type_names.push_back(*type_name);
+            }
+            num_type_definitions_read++;
+            continue;
+        }
+
+        std::optional<double> receive_time_sec           = readDouble(chunk, offset);
+        std::optional<std::string_view> serialized_proto = readString(chunk, offset);
+        if (!receive_time_sec || !serialized_proto ||
+            *tag - FIRST_TYPE_ID >= type_names.size())
+        {
+            break;
+        }
+        return ReplayEntryView{
+            .receive_time_sec        = *receive_time_sec,
+            .protobuf_type_full_name = type_names[*tag - FIRST_TYPE_ID],
+            .serialized_proto        = *serialized_proto,
+        };
+    }
+
+    // Stop at the footer, the end of the chunk, or the first corrupt record
+    offset = chunk.size();
+    return std::nullopt;
+}
+
+bool ReplayChunkDecoder::seek(double receive_time_sec)
+{
+    if (index_.empty())
+    {
+        return false;
+    }
+
+    auto index_entry = std::lower_bound(
+        index_.begin(), index_.end(), receive_time_sec,
+        [](const ReplayIndexEntry& entry, double time)
+        { return entry.receive_time_sec < time; });
+    offset = index_entry == index_.end() ? chunk.size() : index_entry->offset;
+    return true;
+}
+
+const std::vector<ReplayIndexEntry>& ReplayChunkDecoder::index() const
+{
+    return index_;
+}
+
+void ReplayChunkDecoder::readFooter()
+{
+    const size_t trailer_size = sizeof(uint64_t) + FOOTER_MAGIC.size();
+    if (chunk.size() < records_start + trailer_size ||
+        chunk.substr(chunk.size() - FOOTER_MAGIC.size()) != FOOTER_MAGIC)
+    {
+        return;
+    }
+
+    size_t footer_offset_position         = chunk.size() - trailer_size;
+    std::optional<uint64_t> footer_offset = readUint64(chunk, footer_offset_position);
+    if (!footer_offset || *footer_offset < records_start ||
+        *footer_offset >= chunk.size() - trailer_size)
+    {
+        return;
+    }
+
+    // The footer is only used if all of it can be read
+    std::string_view footer           = chunk.substr(0, chunk.size() - trailer_size);
+    size_t footer_position            = *footer_offset;
+    std::optional<uint64_t> tag       = readVarint(footer, footer_position);
+    std::optional<uint64_t> num_types = readVarint(footer, footer_position);
+    if (!tag || *tag != FOOTER_TAG || !num_types)
+    {
+        return;
+    }
+
+    std::vector<std::string_view> footer_type_names;
+    for (uint64_t i = 0; i < *num_types; i++)
+    {
+        std::optional<std::string_view> type_name = readString(footer, footer_position);
+        if (!type_name)
+        {
+            return;
+        }
+        footer_type_names.push_back(*type_name);
+    }
+
+    std::optional<uint64_t> num_entries = readVarint(footer, footer_position);
+    if (!num_entries)
+    {
+        return;
+    }
+    std::vector<ReplayIndexEntry> footer_index;
+    for (uint64_t i = 0; i < *num_entries; i++)
+    {
+        std::optional<double> receive_time_sec = readDouble(footer, footer_position);
+        std::optional<uint64_t> entry_offset   = readVarint(footer, footer_position);
+        if (!receive_time_sec || !entry_offset || *entry_offset >= *footer_offset)
+        {
+            return;
+        }
+        footer_index.push_back(ReplayIndexEntry{
+            .receive_time_sec = *receive_time_sec,
+            .offset           = *entry_offset,
+        });
+    }
+
+    type_names = std::move(footer_type_names);
+    index_     = std::move(footer_index);
+}
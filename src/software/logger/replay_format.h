@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * The binary replay chunk format, written by the ProtoLogger since replay file
+ * version 3. A decompressed chunk is laid out as
+ *
+ *   version:3\n
+ *   record*
+ *   footer
+ *
+ * where every record starts with a varint tag:
+ *  - TYPE_DEFINITION_TAG, followed by the varint length and the full name of a
+ *    protobuf type. The first definition in a chunk is given the type id
+ *    FIRST_TYPE_ID, the next one FIRST_TYPE_ID + 1, and so on.
+ *  - FOOTER_TAG, which starts the footer
+ *  - A type id, followed by the receive time as a little endian double, the varint
+ *    length of the serialized protobuf and the serialized protobuf itself.
+ *
+ * Types are defined before the first entry that uses them, so a chunk that was cut
+ * off (e.g. because the logger crashed) can still be read up to the cut. The footer
+ * repeats the type names and indexes the offset of every entry by its receive time,
+ * so readers that have the whole chunk can seek without decoding it:
+ *
+ *   FOOTER_TAG varint(num_types) (varint(length) name)*
+ *   varint(num_entries) (double(receive_time_sec) varint(offset))*
+ *   uint64(footer_offset) FOOTER_MAGIC
+ *
+ * All offsets are from the start of the decompressed chunk.
+ */
+
+/**
+ * A single protobuf in a binary replay chunk. The views point into the chunk.
+ */
+struct ReplayEntryView
+{
+    double receive_time_sec;
+    std::string_view protobuf_type_full_name;
+    std::string_view serialized_proto;
+};
+
+/**
+ * Where an entry starts in a binary replay chunk
+ */
+struct ReplayIndexEntry
+{
+    double receive_time_sec;
+    uint64_t offset;
+};
+
+/**
+ * Encodes protobufs into a binary replay chunk. Every chunk needs its own encoder.
+ */
+class ReplayChunkEncoder
+{
+   public:
+    ReplayChunkEncoder();
+
+    /**
+     * Appends the metadata that every chunk starts with. Must be encoded before
+     * anything else.
+     *
+     * @param output The string to append to
+     */
+    void encodeHeader(std::string& output);
+
+    /**
+     * Appends an entry, preceded by the definition of its type if this is the first
+     * entry of that type in the chunk
+     *
+     * @param protobuf_type_full_name The full name of the protobuf message type
+     * @param serialized_proto The serialized protobuf
+     * @param receive_time_sec The time the protobuf was received
+     * @param output The string to append to
+     */
+    void encodeEntry(std::string_view protobuf_type_full_name,
+                     std::string_view serialized_proto, double receive_time_sec,
+                     std::string& output);
+
+    /**
+     * Appends the footer, which ends the chunk
+     *
+     * @param output The string to append to
+     */
+    void encodeFooter(std::string& output);
+
+    /**
+     * Returns the number of bytes encoded so far
+     *
+     * @return the size of the decompressed chunk so far
+     */
+    uint64_t size() const;
+
+   private:
+    std::unordered_map<std::string, uint64_t> type_ids;
+    std::vector<std::string> type_names;
+    std::vector<ReplayIndexEntry> index;
+    uint64_t num_bytes_encoded;
+};
+
+/**
+ * Decodes the entries of a binary replay chunk, in order
+ */
+class ReplayChunkDecoder
+{
+   public:
+    /**
+     * Creates a decoder for a decompressed chunk
+     *
+     * @throws std::invalid_argument if the chunk does not start with the metadata of
+     * the binary format
+     *
+     * @param chunk The decompressed chunk, which must outlive the decoder and the
+     * entries it returns
+     */
+    explicit ReplayChunkDecoder(std::string_view chunk);
+
+    /**
+     * Returns the next entry in the chunk
+     *
+     * @return the next entry, or std::nullopt once the footer, the end of the chunk or
+     * a corrupt record is reached
+     */
+    std::optional<ReplayEntryView> nextEntry();
+
+    /**
+     * Moves to the first entry received at or after the given time. Entries are
+     * assumed to be encoded in the order they were received.
+     *
+     * @param receive_time_sec The time to seek to
+     *
+     * @return whether the chunk has an index to seek with. Chunks without a footer
+     * can only be read from the start.
+     */
+    bool seek(double receive_time_sec);
+
+    /**
+     * Returns the offset of every entry by receive time, from the footer
+     *
+     * @return the index, which is empty if the chunk has no footer
+     */
+    const std::vector<ReplayIndexEntry>& index() const;
+
+    static constexpr uint64_t TYPE_DEFINITION_TAG = 0;
+    static constexpr uint64_t FOOTER_TAG          = 1;
+    static constexpr uint64_t FIRST_TYPE_ID       = 2;
+    static constexpr std::string_view FOOTER_MAGIC{"TBOTSIDX"};
+
+   private:
+    /**
+     * Reads the type names and index from the footer, if the chunk has one
+     */
+    void readFooter();
+
+    std::string_view chunk;
+    size_t offset;
+    // The offset the metadata ends at, where the first record starts
+    size_t records_start;
+    std::vector<std::string_view> type_names;
+    // The number of type definitions read in order, which may be fewer than the type
+    // names if they were read from the footer
+    size_t num_type_definitions_read;
+    std::vector<ReplayIndexEntry> index_;
+};
@@ -0,0 +1,99 @@
+#include "software/logger/replay_format.h"
+
+#include <gtest/gtest.h>
+
+class ReplayFormatTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Encodes a chunk with entries of two types, received every 0.5 seconds
+     *
+     * @param with_footer Whether to end the chunk with the footer
+     *
+     * @return the chunk
+     */
+    std::string encodeChunk(bool with_footer)
+    {
+        ReplayChunkEncoder encoder;
+        std::string chunk;
+        encoder.encodeHeader(chunk);
+        for (size_t i = 0; i < serialized_protos.size(); i++)
+        {
+            encoder.encodeEntry(i % 2 == 0 ? "TbotsProto.World" : "TbotsProto.Primitive",
+                                serialized_protos[i], 0.5 * static_cast<double>(i),
+                                chunk);
+        }
+        if (with_footer)
+        {
+            encoder.encodeFooter(chunk);
+        }
+        EXPECT_EQ(chunk.size(), encoder.size());
+        return chunk;
+    }
+
+    // The serialized protos are binary and may contain anything, including the
+    // footer magic
+    const std::vector<std::string> serialized_protos = {
+        "first", std::string("a,b\n\0c", 6), "", std::string(300, 'x'), "TBOTSIDX"};
+};
+
+TEST_F(ReplayFormatTest, decodes_entries_in_order)
+{
+    std::string chunk = encodeChunk(true);
+    ReplayChunkDecoder decoder(chunk);
+
+    for (size_t i = 0; i < serialized_protos.size(); i++)
+    {
+        std::optional<ReplayEntryView> entry = decoder.nextEntry();
+        ASSERT_TRUE(entry);
+        EXPECT_EQ(0.5 * static_cast<double>(i), entry->receive_time_sec);
+        EXPECT_EQ(i % 2 == 0 ? "TbotsProto.World" : "TbotsProto.Primitive",
+                  entry->protobuf_type_full_name);
+        EXPECT_EQ(serialized_protos[i], entry->serialized_proto);
+    }
+    EXPECT_FALSE(decoder.nextEntry());
+}
+
+TEST_F(ReplayFormatTest, footer_indexes_every_entry)
+{
+    std::string chunk = encodeChunk(true);
+    ReplayChunkDecoder decoder(chunk);
+
+    ASSERT_EQ(serialized_protos.size(), decoder.index().size());
+    EXPECT_EQ(1.5, decoder.index()[3].receive_time_sec);
+
+    ASSERT_TRUE(decoder.seek(1.2));
+    std::optional<ReplayEntryView> entry = decoder.nextEntry();
+    ASSERT_TRUE(entry);
+    EXPECT_EQ(1.5, entry->receive_time_sec);
+    EXPECT_EQ("TbotsProto.Primitive", entry->protobuf_type_full_name);
+    EXPECT_EQ(serialized_protos[3], entry->serialized_proto);
+
+    ASSERT_TRUE(decoder.seek(100));
+    EXPECT_FALSE(decoder.nextEntry());
+}
+
+TEST_F(ReplayFormatTest, chunk_cut_off_mid_entry_is_read_up_to_the_cut)
+{
+    std::string chunk = encodeChunk(false);
+    chunk.resize(chunk.size() - 100);
+    ReplayChunkDecoder decoder(chunk);
+
+    EXPECT_TRUE(decoder.index().empty());
+    EXPECT_FALSE(decoder.seek(1));
+
+    std::vector<std::string_view> decoded_protos;
+    while (std::optional<ReplayEntryView> entry = decoder.nextEntry())
+    {
+        decoded_protos.push_back(entry->serialized_proto);
+    }
+    EXPECT_EQ(std::vector<std::string_view>(serialized_protos.begin(),
+                                            serialized_protos.begin() + 3),
+              decoded_protos);
+}
+
+TEST_F(ReplayFormatTest, chunk_in_another_format_throws)
+{
+    EXPECT_THROW(ReplayChunkDecoder("version:2\n1.0,TbotsProto.World,AAAA\n"),
+                 std::invalid_argument);
+}
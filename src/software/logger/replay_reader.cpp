@@ -0,0 +1,77 @@
+#include "software/logger/replay_reader.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "compat_flags.h"
+#include "shared/constants.h"
+
+ReplayReader::ReplayReader(const std::string& replay_folder)
+    : chunk_paths(), next_chunk_index(0), chunk(std::nullopt), next_entry_index(0)
+{
+    std::vector<std::pair<unsigned long, std::string>> indexed_chunk_paths;
+    if (fs::is_directory(replay_folder))
+    {
+        for (const auto& file : fs::directory_iterator(replay_folder))
+        {
+            const fs::path& path = file.path();
+            if (path.extension() != "." + REPLAY_FILE_EXTENSION)
+            {
+                continue;
+            }
+
+            // Chunks are named by their index, so they sort numerically
+            try
+            {
+                indexed_chunk_paths.emplace_back(std::stoul(path.stem().string()),
+                                                 path.string());
+            }
+            catch (const std::logic_error&)
+            {
+                continue;
+            }
+        }
+    }
+
+    if (indexed_chunk_paths.empty())
+    {
+        throw std::invalid_argument("No replay files found in " + replay_folder);
+    }
+
+    std::sort(indexed_chunk_paths.begin(), indexed_chunk_paths.end());
+    for (const auto& [index, path] : indexed_chunk_paths)
+    {
+        chunk_paths.push_back(path);
+    }
+}
+
+std::optional<ReplayEntry> ReplayReader::nextEntry()
+{
+    std::optional<ReplayEntryView> entry = nextEntryView();
+    if (!entry)
+    {
+        return std::nullopt;
+    }
+    return ReplayEntry{
+        .receive_time_sec        = entry->receive_time_sec,
+        .protobuf_type_full_name = std::string(entry->protobuf_type_full_name),
+        .serialized_proto        = std::string(entry->serialized_proto),
+    };
+}
+
+std::optional<ReplayEntryView> ReplayReader::nextEntryView()
+{
+    while (!chunk || next_entry_index >= chunk->size())
+    {
+        if (next_chunk_index >= chunk_paths.size())
+        {
+            return std::nullopt;
+        }
+
+        // Unload the current chunk before loading the next one
+        chunk.reset();
+        next_entry_index = 0;
+        chunk.emplace(chunk_paths[next_chunk_index++]);
+    }
+    return chunk->entry(next_entry_index++);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "software/logger/replay_chunk.h"
+
+/**
+ * A single protobuf logged by the ProtoLogger
+ */
+struct ReplayEntry
+{
+    // The time the protobuf was received, relative to when logging started
+    double receive_time_sec;
+    // The full name of the protobuf message type (e.g. SSLProto.SSL_WrapperPacket)
+    std::string protobuf_type_full_name;
+    std::string serialized_proto;
+};
+
+/**
+ * Reads back the protobufs logged by the ProtoLogger, in the order they were logged.
+ *
+ * The replay chunks in the log folder are loaded one at a time as ReplayChunks, so
+ * only one chunk is held in memory at once. Both the text format of replay file
+ * version 2 and the binary format of version 3 can be read. Corrupt lines of text
+ * chunks are skipped, like the replay player in Thunderscope does. Binary chunks
+ * can't be resynchronized after a corrupt record, so the rest of the chunk is skipped
+ * instead.
+ */
+class ReplayReader
+{
+   public:
+    /**
+     * Creates a ReplayReader that reads the replay chunks in the given folder
+     *
+     * @throws std::invalid_argument if the folder has no replay chunks
+     *
+     * @param replay_folder The folder the ProtoLogger wrote the replay chunks to
+     */
+    explicit ReplayReader(const std::string& replay_folder);
+
+    /**
+     * Returns the next entry in the replay
+     *
+     * @throws std::invalid_argument if the next chunk was written in a replay file
+     * version that isn't supported
+     *
+     * @return the next entry, or std::nullopt if every entry has been read
+     */
+    std::optional<ReplayEntry> nextEntry();
+
+    /**
+     * Returns the next entry in the replay without copying it
+     *
+     * @throws std::invalid_argument if the next chunk was written in a replay file
+     * version that isn't supported
+     *
+     * @return the next entry, which points into the current chunk and is only valid
+     * until the next call, or std::nullopt if every entry has been read
+     */
+    std::optional<ReplayEntryView> nextEntryView();
+
+   private:
+    std::vector<std::string> chunk_paths;
+    size_t next_chunk_index;
+    std::optional<ReplayChunk> chunk;
+    size_t next_entry_index;
+};
@@ -0,0 +1,179 @@
+#include "software/logger/replay_reader.h"
+
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+#include "shared/constants.h"
+#include "software/logger/compat_flags.h"
+#include "software/logger/proto_logger.h"
+
+class ReplayReaderTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        fs::remove_all(replay_folder);
+        fs::create_directories(replay_folder);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(replay_folder);
+    }
+
+    /**
+     * Writes a replay chunk in the text format of replay file version 2
+     */
+    void writeChunk(unsigned int index, const std::vector<std::string>& log_entries)
+    {
+        std::string contents = REPLAY_FILE_VERSION_PREFIX + "2\n";
+        for (const std::string& log_entry : log_entries)
+        {
+            contents += log_entry;
+        }
+        writeCompressedChunk(index, contents);
+    }
+
+    /**
+     * Writes a replay chunk in the binary format the ProtoLogger writes
+     */
+    void writeBinaryChunk(unsigned int index, const std::vector<ReplayEntry>& entries)
+    {
+        ReplayChunkEncoder encoder;
+        std::string contents;
+        encoder.encodeHeader(contents);
+        for (const ReplayEntry& entry : entries)
+        {
+            encoder.encodeEntry(entry.protobuf_type_full_name, entry.serialized_proto,
+                                entry.receive_time_sec, contents);
+        }
+        encoder.encodeFooter(contents);
+        writeCompressedChunk(index, contents);
+    }
+
+    /**
+     * Compresses a replay chunk with gzip and writes it to the replay folder
+     */
+    void writeCompressedChunk(unsigned int index, const std::string& contents)
+    {
+        std::string path = replay_folder + "/" + std::to_string(index) + "." +
+                           REPLAY_FILE_EXTENSION;
+        gzFile gz_file = gzopen(path.c_str(), "wb");
+        ASSERT_TRUE(gz_file);
+        gzwrite(gz_file, contents.c_str(), static_cast<unsigned>(contents.size()));
+        gzclose(gz_file);
+    }
+
+    const std::string replay_folder =
+        (fs::temp_directory_path() / "replay_reader_test").string();
+};
+
+TEST_F(ReplayReaderTest, folder_without_replay_files_throws)
+{
+    EXPECT_THROW(ReplayReader(replay_folder + "/missing"), std::invalid_argument);
+    EXPECT_THROW(ReplayReader reader(replay_folder), std::invalid_argument);
+}
+
+TEST_F(ReplayReaderTest, reads_entries_in_order_across_chunks)
+{
+    // The serialized protos are binary and may contain newlines and delimiters
+    const std::string binary_proto("a,b\n\0c", 6);
+    writeChunk(0, {ProtoLogger::createLogEntry("TbotsProto.World", "first", 0.5),
+                   ProtoLogger::createLogEntry("TbotsProto.World", binary_proto, 1)});
+    writeChunk(10, {ProtoLogger::createLogEntry("TbotsProto.Primitive", "fourth", 3)});
+    writeChunk(2, {ProtoLogger::createLogEntry("TbotsProto.World", "third", 2)});
+
+    ReplayReader reader(replay_folder);
+
+    std::vector<std::string> serialized_protos;
+    std::vector<double> receive_times;
+    while (std::optional<ReplayEntry> entry = reader.nextEntry())
+    {
+        serialized_protos.push_back(entry->serialized_proto);
+        receive_times.push_back(entry->receive_time_sec);
+    }
+
+    EXPECT_EQ(std::vector<std::string>({"first", binary_proto, "third", "fourth"}),
+              serialized_protos);
+    EXPECT_EQ(std::vector<double>({0.5, 1, 2, 3}), receive_times);
+    EXPECT_FALSE(reader.nextEntry());
+}
+
+TEST_F(ReplayReaderTest, corrupt_entries_are_skipped)
+{
+    writeChunk(0, {"not an entry\n", "1.5,TbotsProto.World,!!!\n",
+                   ProtoLogger::createLogEntry("TbotsProto.World", "valid", 2),
+                   "2.5,TbotsProto.Wor"});
+
+    ReplayReader reader(replay_folder);
+
+    std::optional<ReplayEntry> entry = reader.nextEntry();
+    ASSERT_TRUE(entry);
+    EXPECT_EQ(2, entry->receive_time_sec);
+    EXPECT_EQ("TbotsProto.World", entry->protobuf_type_full_name);
+    EXPECT_EQ("valid", entry->serialized_proto);
+    EXPECT_FALSE(reader.nextEntry());
+}
+
+TEST_F(ReplayReaderTest, reads_binary_and_text_chunks)
+{
+    const std::string binary_proto("a,b\n\0c", 6);
+    writeChunk(0, {ProtoLogger::createLogEntry("TbotsProto.World", "first", 0.5)});
+    writeBinaryChunk(1, {{1, "TbotsProto.World", binary_proto},
+                         {2, "TbotsProto.Primitive", "third"}});
+
+    ReplayReader reader(replay_folder);
+
+    std::vector<std::string> serialized_protos;
+    std::vector<std::string> protobuf_types;
+    while (std::optional<ReplayEntry> entry = reader.nextEntry())
+    {
+        serialized_protos.push_back(entry->serialized_proto);
+        protobuf_types.push_back(entry->protobuf_type_full_name);
+    }
+
+    EXPECT_EQ(std::vector<std::string>({"first", binary_proto, "third"}),
+              serialized_protos);
+    EXPECT_EQ(std::vector<std::string>(
+                  {"TbotsProto.World", "TbotsProto.World", "TbotsProto.Primitive"}),
+              protobuf_types);
+}
+
+TEST_F(ReplayReaderTest, reads_log_written_by_proto_logger)
+{
+    {
+        double time = 10;
+        ProtoLogger proto_logger(replay_folder, [&]() { return time; }, false);
+        for (int i = 0; i < 100; i++)
+        {
+            time += 0.01;
+            proto_logger.saveSerializedProto("TbotsProto.World", std::to_string(i));
+        }
+    }
+
+    // The ProtoLogger writes its chunks to a new folder in the given one
+    std::string log_folder = fs::directory_iterator(replay_folder)->path().string();
+    ReplayReader reader(log_folder);
+
+    std::vector<std::string> serialized_protos;
+    while (std::optional<ReplayEntry> entry = reader.nextEntry())
+    {
+        EXPECT_EQ("TbotsProto.World", entry->protobuf_type_full_name);
+        serialized_protos.push_back(entry->serialized_proto);
+    }
+    ASSERT_EQ(100, serialized_protos.size());
+    EXPECT_EQ("99", serialized_protos.back());
+}
+
+TEST_F(ReplayReaderTest, unsupported_version_throws)
+{
+    std::string path = replay_folder + "/0." + REPLAY_FILE_EXTENSION;
+    gzFile gz_file   = gzopen(path.c_str(), "wb");
+    ASSERT_TRUE(gz_file);
+    std::string contents = "1.0,TbotsProto.World,b'AAAA'\n";
+    gzwrite(gz_file, contents.c_str(), static_cast<unsigned>(contents.size()));
+    gzclose(gz_file);
+
+    ReplayReader reader(replay_folder);
+    EXPECT_THROW(reader.nextEntry(), std::invalid_argument);
+}
@@ -0,0 +1,167 @@
+#include "software/logger/visualization_stream.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+#include "proto/visualization.pb.h"
+
+using google::protobuf::internal::WireFormatLite;
+
+VisualizationStream::VisualizationStream(std::string protobuf_type_full_name,
+                                         const VisualizationStreamConfig& config)
+    : protobuf_type_full_name(std::move(protobuf_type_full_name)),
+      config(config),
+      latest_proto(),
+      latest_proto_hash(0),
+      has_unpublished_proto(false),
+      last_publication_time(std::nullopt),
+      previous_elements(),
+      previous_element_indices(),
+      delta_sequence_number(0),
+      last_keyframe_time(std::nullopt)
+{
+}
+
+void VisualizationStream::offer(std::string& serialized_proto)
+{
+    std::size_t proto_hash = std::hash<std::string_view>()(serialized_proto);
+    bool has_proto         = has_unpublished_proto || last_publication_time;
+    if (has_proto && proto_hash == latest_proto_hash && serialized_proto == latest_proto)
+    {
+        return;
+    }
+
+    latest_proto.swap(serialized_proto);
+    latest_proto_hash     = proto_hash;
+    has_unpublished_proto = true;
+}
+
+bool VisualizationStream::nextPublication(std::chrono::steady_clock::time_point now,
+                                          VisualizationStreamPublication& publication)
+{
+    std::optional<std::chrono::steady_clock::time_point> publication_time =
+        nextPublicationTime();
+    if (has_unpublished_proto)
+    {
+        if (publication_time && now < *publication_time)
+        {
+            return false;
+        }
+    }
+    else if (!publication_time || now < *publication_time)
+    {
+        return false;
+    }
+
+    if (config.delta_encoded_field_number == 0 || !encodeDelta(now, publication))
+    {
+        publication.protobuf_type_full_name.assign(protobuf_type_full_name);
+        publication.serialized_proto.assign(latest_proto);
+    }
+    last_publication_time = now;
+    has_unpublished_proto = false;
+    return true;
+}
+
+std::optional<std::chrono::steady_clock::time_point>
+VisualizationStream::nextPublicationTime() const
+{
+    if (!last_publication_time)
+    {
+        return std::nullopt;
+    }
+    return *last_publication_time + (has_unpublished_proto ? config.min_publish_period
+                                                           : config.max_unchanged_period);
+}
+
+bool VisualizationStream::encodeDelta(std::chrono::steady_clock::time_point now,
+                                      VisualizationStreamPublication& publication)
+{
+    // Split the protobuf into the elements of the delta encoded field and the rest of
+    // its fields by walking the wire format, so it doesn't need to be parsed
+    TbotsProto::VisualizationDelta delta;
+    std::vector<std::string_view> elements;
+    google::protobuf::io::CodedInputStream input(
+        reinterpret_cast<const uint8_t*>(latest_proto.data()),
+        static_cast<int>(latest_proto.size()));
+    while (uint32_t tag = input.ReadTag())
+    {
+        const int field_start = input.CurrentPosition();
+        if (WireFormatLite::GetTagFieldNumber(tag) ==
+                static_cast<int>(config.delta_encoded_field_number) &&
+            WireFormatLite::GetTagWireType(tag) ==
+                WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+        {
+            uint32_t element_size;
+            if (!input.ReadVarint32(&element_size))
+            {
+                return false;
+            }
+            const int element_start = input.CurrentPosition();
+            if (!input.Skip(static_cast<int>(element_size)))
+            {
+                return false;
+            }
+            elements.emplace_back(latest_proto.data() + element_start, element_size);
+        }
+        else
+        {
+            if (!WireFormatLite::SkipField(&input, tag))
+            {
+                return false;
+            }
+            // Keep the tag along with the field
+            const int tag_size = static_cast<int>(
+                google::protobuf::io::CodedOutputStream::VarintSize32(tag));
+            delta.mutable_other_fields()->append(
+                latest_proto.data() + field_start - tag_size,
+                static_cast<size_t>(input.CurrentPosition() - field_start + tag_size));
+        }
+    }
+    if (!input.ConsumedEntireMessage())
+    {
+        return false;
+    }
+
+    const bool keyframe =
+        !last_keyframe_time || now >= *last_keyframe_time + config.keyframe_period;
+    if (keyframe)
+    {
+        last_keyframe_time = now;
+    }
+
+    delta.set_protobuf_type_full_name(protobuf_type_full_name);
+    delta.set_sequence_number(++delta_sequence_number);
+    delta.set_keyframe(keyframe);
+    delta.set_field_number(config.delta_encoded_field_number);
+    for (std::string_view element : elements)
+    {
+        auto previous_element = previous_element_indices.find(element);
+        if (!keyframe && previous_element != previous_element_indices.end())
+        {
+            delta.add_previous_indices(previous_element->second);
+        }
+        else
+        {
+            delta.add_previous_indices(-1);
+            delta.add_new_elements(std::string(element));
+        }
+    }
+
+    // The strings keep their buffers, so this stops allocating once the number of
+    // elements settles
+    previous_element_indices.clear();
+    previous_elements.resize(elements.size());
+    for (size_t i = 0; i < elements.size(); i++)
+    {
+        previous_elements[i].assign(elements[i]);
+    }
+    for (size_t i = 0; i < previous_elements.size(); i++)
+    {
+        previous_element_indices.emplace(previous_elements[i], static_cast<int32_t>(i));
+    }
+
+    publication.protobuf_type_full_name.assign(delta.GetDescriptor()->full_name());
+    delta.SerializeToString(&publication.serialized_proto);
+    return true;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * How the Visualizer publishes the protobufs of a type
+ */
+struct VisualizationStreamConfig
+{
+    // The least time between publications. Protobufs published sooner replace the
+    // one waiting to be published, so the latest protobuf is always published.
+    std::chrono::steady_clock::duration min_publish_period;
+    // The most time between publications. An unchanged protobuf is published again
+    // after this long, so Thunderscope doesn't expire it and replays that are seeked
+    // into show it.
+    std::chrono::steady_clock::duration max_unchanged_period;
+    // The field number of a repeated message field to delta encode, or 0 to publish
+    // whole protobufs
+    uint32_t delta_encoded_field_number;
+    // The most time between keyframes of a delta encoded stream
+    std::chrono::steady_clock::duration keyframe_period;
+};
+
+/**
+ * A protobuf ready to be sent and saved to the replay log
+ */
+struct VisualizationStreamPublication
+{
+    // The full name of the protobuf type, which is TbotsProto.VisualizationDelta
+    // for delta encoded protobufs
+    std::string protobuf_type_full_name;
+    std::string serialized_proto;
+};
+
+/**
+ * The protobufs of one type that are published by the Visualizer.
+ *
+ * Protobufs that are byte for byte the same as the last one published are skipped
+ * until the max unchanged period passes, and publications are rate limited to the
+ * min publish period. Large repeated fields (e.g. the obstacles of an ObstacleList)
+ * can be delta encoded into VisualizationDelta protobufs, which only carry the
+ * elements that weren't in the last publication.
+ */
+class VisualizationStream
+{
+   public:
+    /**
+     * Creates a VisualizationStream
+     *
+     * @param protobuf_type_full_name The full name of the protobuf type of the stream
+     * @param config How to publish the protobufs
+     */
+    VisualizationStream(std::string protobuf_type_full_name,
+                        const VisualizationStreamConfig& config);
+
+    /**
+     * Offers the latest protobuf of the stream to be published
+     *
+     * @param serialized_proto The serialized protobuf. It is swapped with a string
+     * that is no longer needed, so its buffer can be reused.
+     */
+    void offer(std::string& serialized_proto);
+
+    /**
+     * Returns the next publication of the stream, if it is due
+     *
+     * @param now The current time
+     * @param publication Filled in with the publication, reusing its buffers
+     *
+     * @return whether there is a publication
+     */
+    bool nextPublication(std::chrono::steady_clock::time_point now,
+                         VisualizationStreamPublication& publication);
+
+    /**
+     * Returns when the next publication will be due, if nothing else is offered
+     *
+     * @return the time, or std::nullopt if nothing has been published yet
+     */
+    std::optional<std::chrono::steady_clock::time_point> nextPublicationTime() const;
+
+   private:
+    /**
+     * Encodes the latest protobuf as a VisualizationDelta
+     *
+     * @param now The current time
+     * @param publication Filled in with the delta
+     *
+     * @return whether the protobuf could be split into its delta encoded field and
+     * other fields
+     */
+    bool encodeDelta(std::chrono::steady_clock::time_point now,
+                     VisualizationStreamPublication& publication);
+
+    const std::string protobuf_type_full_name;
+    const VisualizationStreamConfig config;
+
+    std::string latest_proto;
+    std::size_t latest_proto_hash;
+    bool has_unpublished_proto;
+    std::optional<std::chrono::steady_clock::time_point> last_publication_time;
+
+    // The elements of the delta encoded field in the last publication, and the index
+    // of the first element with each serialized value
+    std::vector<std::string> previous_elements;
+    std::unordered_map<std::string_view, int32_t> previous_element_indices;
+    uint64_t delta_sequence_number;
+    std::optional<std::chrono::steady_clock::time_point> last_keyframe_time;
+};
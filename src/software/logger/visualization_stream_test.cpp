@@ -0,0 +1,193 @@
+#include "software/logger/visualization_stream.h"
+
+#include <gtest/gtest.h>
+
+#include "proto/visualization.pb.h"
+
+class VisualizationStreamTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Creates an ObstacleList of circles with the given radii
+     *
+     * @param radii The radius of each obstacle
+     *
+     * @return the serialized ObstacleList
+     */
+    static std::string createObstacleList(const std::vector<double>& radii)
+    {
+        TbotsProto::ObstacleList obstacle_list;
+        for (double radius : radii)
+        {
+            TbotsProto::Circle* circle = obstacle_list.add_obstacles()->mutable_circle();
+            circle->mutable_origin()->set_x_meters(0);
+            circle->mutable_origin()->set_y_meters(0);
+            circle->set_radius(radius);
+        }
+        return obstacle_list.SerializeAsString();
+    }
+
+    /**
+     * Offers a protobuf to a stream, and returns the publication if one is due
+     *
+     * @param stream The stream
+     * @param serialized_proto The protobuf to offer, or std::nullopt to not offer one
+     * @param now The current time
+     *
+     * @return the publication, or std::nullopt if none is due
+     */
+    static std::optional<VisualizationStreamPublication> offerAndPublish(
+        VisualizationStream& stream, std::optional<std::string> serialized_proto,
+        std::chrono::steady_clock::time_point now)
+    {
+        if (serialized_proto)
+        {
+            stream.offer(*serialized_proto);
+        }
+        VisualizationStreamPublication publication;
+        if (!stream.nextPublication(now, publication))
+        {
+            return std::nullopt;
+        }
+        return publication;
+    }
+
+    /**
+     * Rebuilds an ObstacleList from a delta, the way Thunderscope does
+     *
+     * @param delta The delta
+     * @param elements The obstacles rebuilt from the previous delta, which are
+     * replaced with the obstacles rebuilt from this one
+     *
+     * @return the ObstacleList
+     */
+    static TbotsProto::ObstacleList applyDelta(
+        const TbotsProto::VisualizationDelta& delta, std::vector<std::string>& elements)
+    {
+        std::vector<std::string> new_elements;
+        int next_new_element = 0;
+        for (int previous_index : delta.previous_indices())
+        {
+            new_elements.push_back(previous_index >= 0
+                                       ? elements.at(previous_index)
+                                       : delta.new_elements(next_new_element++));
+        }
+        elements = new_elements;
+
+        TbotsProto::ObstacleList obstacle_list;
+        EXPECT_TRUE(obstacle_list.ParseFromString(delta.other_fields()));
+        for (const std::string& element : elements)
+        {
+            EXPECT_TRUE(obstacle_list.add_obstacles()->ParseFromString(element));
+        }
+        return obstacle_list;
+    }
+
+    const std::chrono::steady_clock::time_point start_time =
+        std::chrono::steady_clock::now();
+    const VisualizationStreamConfig config = {
+        .min_publish_period         = std::chrono::milliseconds(100),
+        .max_unchanged_period       = std::chrono::milliseconds(200),
+        .delta_encoded_field_number = 0,
+        .keyframe_period            = std::chrono::seconds(1),
+    };
+};
+
+TEST_F(VisualizationStreamTest, unchanged_protobufs_are_only_published_again_later)
+{
+    VisualizationStream stream("TbotsProto.ObstacleList", config);
+    std::string obstacle_list = createObstacleList({1, 2});
+
+    EXPECT_FALSE(offerAndPublish(stream, std::nullopt, start_time));
+
+    auto publication = offerAndPublish(stream, obstacle_list, start_time);
+    ASSERT_TRUE(publication);
+    EXPECT_EQ("TbotsProto.ObstacleList", publication->protobuf_type_full_name);
+    EXPECT_EQ(obstacle_list, publication->serialized_proto);
+
+    EXPECT_FALSE(offerAndPublish(stream, obstacle_list,
+                                 start_time + std::chrono::milliseconds(150)));
+    EXPECT_EQ(start_time + std::chrono::milliseconds(200), stream.nextPublicationTime());
+
+    publication = offerAndPublish(stream, obstacle_list,
+                                  start_time + std::chrono::milliseconds(200));
+    ASSERT_TRUE(publication);
+    EXPECT_EQ(obstacle_list, publication->serialized_proto);
+}
+
+TEST_F(VisualizationStreamTest, rate_limited_stream_publishes_latest_protobuf)
+{
+    VisualizationStream stream("TbotsProto.ObstacleList", config);
+
+    EXPECT_TRUE(offerAndPublish(stream, createObstacleList({1}), start_time));
+    EXPECT_FALSE(offerAndPublish(stream, createObstacleList({2}),
+                                 start_time + std::chrono::milliseconds(10)));
+    EXPECT_FALSE(offerAndPublish(stream, createObstacleList({3}),
+                                 start_time + std::chrono::milliseconds(20)));
+    EXPECT_EQ(start_time + std::chrono::milliseconds(100), stream.nextPublicationTime());
+
+    auto publication = offerAndPublish(stream, std::nullopt,
+                                       start_time + std::chrono::milliseconds(100));
+    ASSERT_TRUE(publication);
+    EXPECT_EQ(createObstacleList({3}), publication->serialized_proto);
+}
+
+TEST_F(VisualizationStreamTest, delta_encodes_repeated_field)
+{
+    VisualizationStreamConfig delta_config = config;
+    delta_config.min_publish_period        = std::chrono::steady_clock::duration::zero();
+    delta_config.delta_encoded_field_number =
+        TbotsProto::ObstacleList::kObstaclesFieldNumber;
+    VisualizationStream stream("TbotsProto.ObstacleList", delta_config);
+
+    std::vector<std::string> elements;
+    const std::vector<std::vector<double>> radii = {
+        {1, 2, 3}, {1, 4, 3, 5}, {5, 5, 1}, {}, {1, 2}};
+    for (size_t i = 0; i < radii.size(); i++)
+    {
+        auto publication = offerAndPublish(stream, createObstacleList(radii[i]),
+                                           start_time + i * std::chrono::milliseconds(1));
+        ASSERT_TRUE(publication);
+        ASSERT_EQ("TbotsProto.VisualizationDelta", publication->protobuf_type_full_name);
+
+        TbotsProto::VisualizationDelta delta;
+        ASSERT_TRUE(delta.ParseFromString(publication->serialized_proto));
+        EXPECT_EQ("TbotsProto.ObstacleList", delta.protobuf_type_full_name());
+        EXPECT_EQ(i + 1, delta.sequence_number());
+        EXPECT_EQ(i == 0, delta.keyframe());
+        EXPECT_EQ(createObstacleList(radii[i]),
+                  applyDelta(delta, elements).SerializeAsString());
+    }
+
+    // Only the obstacle that wasn't in the previous delta is sent
+    auto publication = offerAndPublish(stream, createObstacleList({1, 2, 6}),
+                                       start_time + std::chrono::milliseconds(10));
+    TbotsProto::VisualizationDelta delta;
+    ASSERT_TRUE(delta.ParseFromString(publication->serialized_proto));
+    EXPECT_EQ(std::vector<int>({0, 1, -1}),
+              std::vector<int>(delta.previous_indices().begin(),
+                               delta.previous_indices().end()));
+    EXPECT_EQ(1, delta.new_elements_size());
+
+    // Keyframes are sent periodically so the list can be rebuilt after a missed delta
+    publication = offerAndPublish(stream, createObstacleList({1, 2}),
+                                  start_time + std::chrono::seconds(1));
+    ASSERT_TRUE(delta.ParseFromString(publication->serialized_proto));
+    EXPECT_TRUE(delta.keyframe());
+    EXPECT_EQ(2, delta.new_elements_size());
+}
+
+TEST_F(VisualizationStreamTest, malformed_protobuf_is_published_whole)
+{
+    VisualizationStreamConfig delta_config = config;
+    delta_config.delta_encoded_field_number =
+        TbotsProto::ObstacleList::kObstaclesFieldNumber;
+    VisualizationStream stream("TbotsProto.ObstacleList", delta_config);
+
+    // A length delimited field that is longer than the protobuf
+    std::string malformed_proto = "\x0a\x10\x01";
+    auto publication            = offerAndPublish(stream, malformed_proto, start_time);
+    ASSERT_TRUE(publication);
+    EXPECT_EQ("TbotsProto.ObstacleList", publication->protobuf_type_full_name);
+    EXPECT_EQ(malformed_proto, publication->serialized_proto);
+}
@@ -0,0 +1,233 @@
+#include "software/logger/visualizer.h"
+
+#include <algorithm>
+
+#include "proto/visualization.pb.h"
+
+std::unique_ptr<Visualizer> Visualizer::instance;
+std::atomic<Visualizer*> Visualizer::initialized_instance(nullptr);
+std::once_flag Visualizer::initialize_flag;
+
+void Visualizer::initialize(const std::string& runtime_dir,
+                            const std::shared_ptr<ProtoLogger>& proto_logger)
+{
+    std::call_once(initialize_flag,
+                   [&]()
+                   {
+                       instance.reset(new Visualizer(runtime_dir, proto_logger));
+                       initialized_instance = instance.get();
+                   });
+}
+
+void Visualizer::publish(const google::protobuf::Message& message,
+                         std::string_view unix_socket_name)
+{
+    Visualizer* visualizer = initialized_instance;
+    if (!visualizer)
+    {
+        return;
+    }
+
+    Publication publication = visualizer->acquirePublication();
+    publication.protobuf_type_full_name.assign(message.GetDescriptor()->full_name());
+    message.SerializeToString(&publication.serialized_proto);
+    visualizer->submit(std::move(publication), unix_socket_name);
+}
+
+void Visualizer::publishSerialized(std::string_view protobuf_type_full_name,
+                                   std::string_view serialized_proto,
+                                   std::string_view unix_socket_name)
+{
+    Visualizer* visualizer = initialized_instance;
+    if (!visualizer)
+    {
+        return;
+    }
+
+    Publication publication = visualizer->acquirePublication();
+    publication.protobuf_type_full_name.assign(protobuf_type_full_name);
+    publication.serialized_proto.assign(serialized_proto);
+    visualizer->submit(std::move(publication), unix_socket_name);
+}
+
+bool Visualizer::isInitialized()
+{
+    return initialized_instance != nullptr;
+}
+
+Visualizer::Visualizer(const std::string& runtime_dir,
+                       const std::shared_ptr<ProtoLogger>& proto_logger)
+    : runtime_dir(runtime_dir),
+      proto_logger(proto_logger),
+      publication_pool_mutex(),
+      publication_pool(),
+      publication_buffer(PUBLICATION_BUFFER_SIZE, false),
+      streams(),
+      unix_senders(),
+      stream_publication(),
+      in_destructor(false)
+{
+    publication_pool.reserve(MAX_POOLED_PUBLICATIONS);
+    publisher_thread = std::thread(&Visualizer::publishQueuedProtobufs, this);
+}
+
+Visualizer::~Visualizer()
+{
+    initialized_instance = nullptr;
+    in_destructor        = true;
+    publisher_thread.join();
+}
+
+Visualizer::Publication Visualizer::acquirePublication()
+{
+    std::scoped_lock lock(publication_pool_mutex);
+    if (publication_pool.empty())
+    {
+        return Publication();
+    }
+    Publication publication = std::move(publication_pool.back());
+    publication_pool.pop_back();
+    return publication;
+}
+
+void Visualizer::releasePublication(Publication publication)
+{
+    std::scoped_lock lock(publication_pool_mutex);
+    if (publication_pool.size() < MAX_POOLED_PUBLICATIONS)
+    {
+        publication_pool.push_back(std::move(publication));
+    }
+}
+
+void Visualizer::submit(Publication publication, std::string_view unix_socket_name)
+{
+    if (unix_socket_name.empty())
+    {
+        publication.unix_socket_name.assign("/");
+        publication.unix_socket_name.append(publication.protobuf_type_full_name);
+    }
+    else
+    {
+        publication.unix_socket_name.assign(unix_socket_name);
+    }
+    publication_buffer.push(std::move(publication));
+}
+
+void Visualizer::publishQueuedProtobufs()
+{
+    while (!in_destructor)
+    {
+        // Wake up in time to publish the next stream that is due
+        auto now                                      = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::duration wait_time = MAX_PUBLISHER_WAIT_TIME;
+        for (const auto& [unix_socket_name, stream] : streams)
+        {
+            if (std::optional<std::chrono::steady_clock::time_point> publication_time =
+                    stream.nextPublicationTime())
+            {
+                wait_time = std::clamp(*publication_time - now,
+                                       std::chrono::steady_clock::duration::zero(),
+                                       wait_time);
+            }
+        }
+
+        std::optional<Publication> publication =
+            publication_buffer.popLeastRecentlyAddedValue(Duration::fromSeconds(
+                std::chrono::duration<double>(wait_time).count()));
+        if (publication)
+        {
+            auto stream = streams.find(publication->unix_socket_name);
+            if (stream == streams.end())
+            {
+                VisualizationStreamConfig config = streamConfig(
+                    publication->protobuf_type_full_name, publication->unix_socket_name);
+                stream = streams
+                             .try_emplace(publication->unix_socket_name,
+                                          publication->protobuf_type_full_name, config)
+                             .first;
+            }
+            stream->second.offer(publication->serialized_proto);
+            releasePublication(std::move(*publication));
+        }
+
+        publishDueStreams(std::chrono::steady_clock::now());
+    }
+}
+
+void Visualizer::publishDueStreams(std::chrono::steady_clock::time_point now)
+{
+    static const std::string delta_type_full_name(
+        TbotsProto::VisualizationDelta::descriptor()->full_name());
+    static const std::string delta_unix_socket_name = "/" + delta_type_full_name;
+
+    for (auto& [unix_socket_name, stream] : streams)
+    {
+        if (!stream.nextPublication(now, stream_publication))
+        {
+            continue;
+        }
+
+        const std::string& publication_unix_socket_name =
+            stream_publication.protobuf_type_full_name == delta_type_full_name
+                ? delta_unix_socket_name
+                : unix_socket_name;
+        auto [unix_sender, inserted] =
+            unix_senders.try_emplace(publication_unix_socket_name);
+        if (inserted)
+        {
+            unix_sender->second = std::make_unique<ThreadedUnixSender>(
+                runtime_dir + publication_unix_socket_name);
+        }
+        unix_sender->second->sendString(stream_publication.serialized_proto);
+
+        if (proto_logger)
+        {
+            proto_logger->saveSerializedProto(stream_publication.protobuf_type_full_name,
+                                              stream_publication.serialized_proto);
+        }
+    }
+}
+
+VisualizationStreamConfig Visualizer::streamConfig(
+    const std::string& protobuf_type_full_name, const std::string& unix_socket_name)
+{
+    static const std::string cost_visualization_type_full_name(
+        TbotsProto::CostVisualization::descriptor()->full_name());
+    // The large repeated fields that are delta encoded, by protobuf type
+    static const std::unordered_map<std::string, uint32_t> delta_encoded_field_numbers = {
+        {std::string(TbotsProto::ObstacleList::descriptor()->full_name()),
+         TbotsProto::ObstacleList::kObstaclesFieldNumber},
+        {std::string(TbotsProto::PathVisualization::descriptor()->full_name()),
+         TbotsProto::PathVisualization::kPathsFieldNumber},
+        {std::string(TbotsProto::DebugShapes::descriptor()->full_name()),
+         TbotsProto::DebugShapes::kDebugShapesFieldNumber},
+    };
+
+    // Thunderscope stops showing debug shapes, passes and cost visualizations that
+    // haven't been received for 0.5 seconds, so unchanged protobufs are published
+    // again well before then
+    VisualizationStreamConfig config = {
+        .min_publish_period         = std::chrono::steady_clock::duration::zero(),
+        .max_unchanged_period       = std::chrono::milliseconds(200),
+        .delta_encoded_field_number = 0,
+        .keyframe_period            = std::chrono::seconds(1),
+    };
+
+    // The cost visualization is a large grid that only needs to be refreshed a few
+    // times a second to be readable
+    if (protobuf_type_full_name == cost_visualization_type_full_name)
+    {
+        config.min_publish_period = std::chrono::milliseconds(100);
+    }
+
+    // Thunderscope only decodes deltas of protobufs that would have been sent through
+    // the socket named after their type
+    auto delta_encoded_field_number =
+        delta_encoded_field_numbers.find(protobuf_type_full_name);
+    if (delta_encoded_field_number != delta_encoded_field_numbers.end() &&
+        unix_socket_name == "/" + protobuf_type_full_name)
+    {
+        config.delta_encoded_field_number = delta_encoded_field_number->second;
+    }
+    return config;
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <google/protobuf/message.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "software/logger/proto_logger.h"
+#include "software/logger/visualization_stream.h"
+#include "software/multithreading/thread_safe_buffer.hpp"
+#include "software/networking/unix/threaded_unix_sender.h"
+
+/**
+ * Publishes protobufs to Thunderscope over unix sockets, and saves them to the replay
+ * log of the ProtoLogger.
+ *
+ * Each protobuf is serialized once, into a buffer reused from a pool, and that buffer
+ * is handed straight to a publisher thread that sends it through a unix socket named
+ * after the protobuf type and saves it to the ProtoLogger. Unlike LOG(VISUALIZE), the
+ * protobuf isn't base64 encoded into a log message, formatted by g3log and decoded
+ * again by the ProtobufSink. Sending happens on the publisher thread so a slow
+ * reader of a socket doesn't block the thread that published the protobuf.
+ *
+ * Each unix socket is fed by a VisualizationStream, which skips protobufs that haven't
+ * changed, rate limits the protobufs of some types and delta encodes large lists of
+ * obstacles, paths and debug shapes. This makes both what is sent to Thunderscope and
+ * the replay log smaller without changing what Thunderscope shows.
+ *
+ * LOG(VISUALIZE) still works, and forwards the protobufs it logs to the Visualizer.
+ */
+class Visualizer
+{
+   public:
+    /**
+     * Sets up the Visualizer for the calling program. This is called by the
+     * LoggerSingleton, and protobufs published before it is called are dropped.
+     * Only the first call has any effect.
+     *
+     * @param runtime_dir The directory the unix sockets are created in
+     * @param proto_logger The proto logger to save published protobufs to, or nullptr
+     * to not save them
+     */
+    static void initialize(const std::string& runtime_dir,
+                           const std::shared_ptr<ProtoLogger>& proto_logger);
+
+    /**
+     * Publishes a protobuf to Thunderscope and saves it to the replay log
+     *
+     * @param message The protobuf to publish
+     * @param unix_socket_name The name of the unix socket in the runtime directory to
+     * send the protobuf through, starting with a "/". Defaults to "/" followed by the
+     * full name of the protobuf type.
+     */
+    static void publish(const google::protobuf::Message& message,
+                        std::string_view unix_socket_name = "");
+
+    /**
+     * Publishes a protobuf that has already been serialized
+     *
+     * @param protobuf_type_full_name The full name of the protobuf type
+     * @param serialized_proto The serialized protobuf
+     * @param unix_socket_name The name of the unix socket to send the protobuf
+     * through, as for publish
+     */
+    static void publishSerialized(std::string_view protobuf_type_full_name,
+                                  std::string_view serialized_proto,
+                                  std::string_view unix_socket_name = "");
+
+    /**
+     * Returns whether the Visualizer has been initialized
+     *
+     * @return whether published protobufs are sent anywhere
+     */
+    static bool isInitialized();
+
+    ~Visualizer();
+
+   private:
+    /**
+     * A protobuf waiting to be sent by the publisher thread
+     */
+    struct Publication
+    {
+        // The name of the unix socket, relative to the runtime directory
+        std::string unix_socket_name;
+        std::string protobuf_type_full_name;
+        std::string serialized_proto;
+    };
+
+    /**
+     * Creates a Visualizer and starts its publisher thread
+     *
+     * @param runtime_dir The directory the unix sockets are created in
+     * @param proto_logger The proto logger to save published protobufs to
+     */
+    Visualizer(const std::string& runtime_dir,
+               const std::shared_ptr<ProtoLogger>& proto_logger);
+
+    /**
+     * Takes a publication from the pool, or creates one if the pool is empty. The
+     * strings of a pooled publication keep their capacity, so filling them in doesn't
+     * allocate once the pool has warmed up.
+     *
+     * @return the publication
+     */
+    Publication acquirePublication();
+
+    /**
+     * Returns a publication to the pool
+     *
+     * @param publication The publication, which has been sent
+     */
+    void releasePublication(Publication publication);
+
+    /**
+     * Queues a filled in publication to be published
+     *
+     * @param publication The publication
+     * @param unix_socket_name The name of the unix socket to send the publication
+     * through, or an empty string to use the default name
+     */
+    void submit(Publication publication, std::string_view unix_socket_name);
+
+    /**
+     * Offers queued publications to their streams and publishes the streams that are
+     * due, until the Visualizer is destroyed
+     */
+    void publishQueuedProtobufs();
+
+    /**
+     * Sends and saves the publications of the streams that are due
+     *
+     * @param now The current time
+     */
+    void publishDueStreams(std::chrono::steady_clock::time_point now);
+
+    /**
+     * Returns how the protobufs of a type are published
+     *
+     * @param protobuf_type_full_name The full name of the protobuf type
+     * @param unix_socket_name The name of the unix socket the protobufs are sent
+     * through
+     *
+     * @return the config of the stream
+     */
+    static VisualizationStreamConfig streamConfig(
+        const std::string& protobuf_type_full_name, const std::string& unix_socket_name);
+
+    // The number of publications that can wait to be sent. If the publisher thread
+    // falls behind, the oldest publications are dropped.
+    static constexpr size_t PUBLICATION_BUFFER_SIZE = 1000;
+    // The longest the publisher thread waits for a publication before checking if a
+    // stream is due
+    static constexpr std::chrono::milliseconds MAX_PUBLISHER_WAIT_TIME{100};
+    // The most publications kept in the pool. Protobufs are published in bursts once
+    // per tick, so this only needs to hold about one tick worth of publications.
+    static constexpr size_t MAX_POOLED_PUBLICATIONS = 64;
+
+    static std::unique_ptr<Visualizer> instance;
+    static std::atomic<Visualizer*> initialized_instance;
+    static std::once_flag initialize_flag;
+
+    const std::string runtime_dir;
+    std::shared_ptr<ProtoLogger> proto_logger;
+
+    std::mutex publication_pool_mutex;
+    std::vector<Publication> publication_pool;
+
+    ThreadSafeBuffer<Publication> publication_buffer;
+    // Only used by the publisher thread. Streams are keyed by the name of their unix
+    // socket.
+    std::unordered_map<std::string, VisualizationStream> streams;
+    std::unordered_map<std::string, std::unique_ptr<ThreadedUnixSender>> unix_senders;
+    VisualizationStreamPublication stream_publication;
+
+    std::atomic_bool in_destructor;
+    std::thread publisher_thread;
+};
@@ -0,0 +1,103 @@
+#include "software/logger/visualizer.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "proto/play_info_msg.pb.h"
+#include "software/logger/compat_flags.h"
+#include "software/logger/replay_reader.h"
+#include "software/networking/unix/threaded_proto_unix_listener.hpp"
+
+class VisualizerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        fs::remove_all(runtime_dir);
+        fs::create_directories(replay_folder);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(runtime_dir);
+    }
+
+    /**
+     * Creates a PlayInfo with the given play state
+     *
+     * @param play_state The play state
+     *
+     * @return the PlayInfo
+     */
+    static TbotsProto::PlayInfo createPlayInfo(const std::string& play_state)
+    {
+        TbotsProto::PlayInfo play_info;
+        play_info.mutable_play()->add_play_state(play_state);
+        return play_info;
+    }
+
+    const std::string runtime_dir =
+        (fs::temp_directory_path() / "visualizer_test").string();
+    const std::string replay_folder = runtime_dir + "/replays";
+};
+
+// The Visualizer can only be initialized once per process, so everything is tested in
+// a single test
+TEST_F(VisualizerTest, publishes_to_unix_sockets_and_replay_log)
+{
+    ThreadSafeBuffer<TbotsProto::PlayInfo> default_socket_play_infos(10);
+    ThreadSafeBuffer<TbotsProto::PlayInfo> named_socket_play_infos(10);
+    ThreadedProtoUnixListener<TbotsProto::PlayInfo> default_socket_listener(
+        runtime_dir + "/TbotsProto.PlayInfo",
+        [&](TbotsProto::PlayInfo& play_info)
+        { default_socket_play_infos.push(play_info); });
+    ThreadedProtoUnixListener<TbotsProto::PlayInfo> named_socket_listener(
+        runtime_dir + "/named_play_info",
+        [&](TbotsProto::PlayInfo& play_info)
+        { named_socket_play_infos.push(play_info); });
+
+    double time       = 1.0;
+    auto proto_logger = std::make_shared<ProtoLogger>(
+        replay_folder, [&]() { return time; }, false);
+
+    // Protobufs published before the Visualizer is initialized are dropped
+    EXPECT_FALSE(Visualizer::isInitialized());
+    Visualizer::publish(createPlayInfo("dropped"));
+
+    Visualizer::initialize(runtime_dir, proto_logger);
+    ASSERT_TRUE(Visualizer::isInitialized());
+
+    Visualizer::publish(createPlayInfo("default"));
+    std::optional<TbotsProto::PlayInfo> play_info =
+        default_socket_play_infos.popLeastRecentlyAddedValue(Duration::fromSeconds(5));
+    ASSERT_TRUE(play_info);
+    EXPECT_EQ("default", play_info->play().play_state(0));
+
+    time = 2.0;
+    Visualizer::publishSerialized("TbotsProto.PlayInfo",
+                                  createPlayInfo("named").SerializeAsString(),
+                                  "/named_play_info");
+    play_info =
+        named_socket_play_infos.popLeastRecentlyAddedValue(Duration::fromSeconds(5));
+    ASSERT_TRUE(play_info);
+    EXPECT_EQ("named", play_info->play().play_state(0));
+
+    proto_logger->flushAndStopLogging();
+    ReplayReader reader(fs::directory_iterator(replay_folder)->path().string());
+
+    std::vector<std::string> saved_protos;
+    while (std::optional<ReplayEntry> entry = reader.nextEntry())
+    {
+        EXPECT_EQ("TbotsProto.PlayInfo", entry->protobuf_type_full_name);
+        saved_protos.push_back(entry->serialized_proto);
+    }
+
+    // Unchanged protobufs are published again periodically, so there may be more
+    // entries if the test ran slowly
+    ASSERT_LE(2, saved_protos.size());
+    EXPECT_EQ(createPlayInfo("default").SerializeAsString(), saved_protos[0]);
+    EXPECT_NE(std::find(saved_protos.begin(), saved_protos.end(),
+                        createPlayInfo("named").SerializeAsString()),
+              saved_protos.end());
+}
@@ -14,8 +14,16 @@ class LastInFirstOutThreadedObserver : public ThreadedObserver<T>
 {
    public:
     LastInFirstOutThreadedObserver() : ThreadedObserver<T>(){};
-    explicit LastInFirstOutThreadedObserver<T>(size_t buffer_size)
-        : ThreadedObserver<T>(buffer_size){};
+
+    /**
+     * Creates a new LastInFirstOutThreadedObserver
+     *
+     * @param buffer_size size of the buffer
+     * @param log_buffer_full whether or not to log when the buffer is full
+     */
+    explicit LastInFirstOutThreadedObserver<T>(size_t buffer_size,
+                                               bool log_buffer_full = true)
+        : ThreadedObserver<T>(buffer_size, log_buffer_full){};
     std::optional<T> getNextValue(const Duration& max_wait_time) final;
 };
 
@@ -50,8 +50,15 @@ void Subject<T>::registerObserver(std::shared_ptr<Observer<T>> observer)
 template <typename T>
 void Subject<T>::sendValueToObservers(T val)
 {
-    for (std::shared_ptr<Observer<T>>& observer : observers)
+    if (observers.empty())
     {
-        observer->receiveValue(val);
+        return;
     }
+
+    // Every observer but the last gets a copy, and the last gets the value itself
+    for (size_t i = 0; i + 1 < observers.size(); i++)
+    {
+        observers[i]->receiveValue(val);
+    }
+    observers.back()->receiveValue(std::move(val));
 }
@@ -81,9 +81,10 @@ class ThreadSafeBuffer
      *
      * If the buffer is already full, this will overwrite the least recently added value
      *
-     * @param value The value to push onto the buffer
+     * @param value The value to push onto the buffer. It is moved into the buffer, so
+     * values that are passed in as rvalues are never copied.
      */
-    void push(const T& value);
+    void push(T value);
 
     /**
      * Returns whether or not the buffer is empty
@@ -130,7 +131,7 @@ std::optional<T> ThreadSafeBuffer<T>::popLeastRecentlyAddedValue(Duration max_wa
     std::optional<T> result = std::nullopt;
     if (!buffer.empty())
     {
-        result = buffer.front();
+        result = std::move(buffer.front());
         buffer.pop_front();
     }
     return result;
@@ -146,21 +147,21 @@ std::optional<T> ThreadSafeBuffer<T>::popMostRecentlyAddedValue(Duration max_wai
     std::optional<T> result = std::nullopt;
     if (!buffer.empty())
     {
-        result = buffer.back();
+        result = std::move(buffer.back());
         buffer.pop_back();
     }
     return result;
 }
 
 template <typename T>
-void ThreadSafeBuffer<T>::push(const T& value)
+void ThreadSafeBuffer<T>::push(T value)
 {
     std::scoped_lock<std::mutex> buffer_lock(buffer_mutex);
     if (log_buffer_full && buffer.full())
     {
         LOG(DEBUG) << "Pushing to a full ThreadSafeBuffer of type: " << TYPENAME(T);
     }
-    buffer.push_back(value);
+    buffer.push_back(std::move(value));
     received_new_value.notify_all();
 }
 
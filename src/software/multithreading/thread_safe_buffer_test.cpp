@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <thread>
 
 TEST(ThreadSafeBufferTest,
@@ -171,3 +172,23 @@ TEST(ThreadSafeBufferTest, push_more_values_then_buffer_can_hold)
     EXPECT_EQ(39, buffer.popLeastRecentlyAddedValue());
     EXPECT_EQ(40, buffer.popLeastRecentlyAddedValue());
 }
+
+TEST(ThreadSafeBufferTest, push_and_pop_values_without_copying_them)
+{
+    ThreadSafeBuffer<std::unique_ptr<int>> buffer(2);
+
+    auto first_value      = std::make_unique<int>(37);
+    auto second_value     = std::make_unique<int>(38);
+    int* first_value_ptr  = first_value.get();
+    int* second_value_ptr = second_value.get();
+    buffer.push(std::move(first_value));
+    buffer.push(std::move(second_value));
+
+    std::optional<std::unique_ptr<int>> result = buffer.popMostRecentlyAddedValue();
+    ASSERT_TRUE(result);
+    EXPECT_EQ(second_value_ptr, result->get());
+
+    result = buffer.popLeastRecentlyAddedValue();
+    ASSERT_TRUE(result);
+    EXPECT_EQ(first_value_ptr, result->get());
+}
@@ -110,7 +110,7 @@ void ThreadedObserver<T>::continuouslyPullValuesFromBuffer()
 
         if (new_val)
         {
-            onValueReceived(*new_val);
+            onValueReceived(std::move(*new_val));
         }
 
         in_destructor_mutex.lock();
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+/**
+ * Finds a root of the given function within the given bracket using Brent's method.
+ *
+ * Brent's method combines bisection, the secant method and inverse quadratic
+ * interpolation. It is guaranteed to converge as long as the function changes sign
+ * over the bracket (like bisection), but usually converges much faster (like the
+ * secant method). See https://en.wikipedia.org/wiki/Brent%27s_method
+ *
+ * @tparam Function A callable taking a double and returning a double
+ *
+ * @param function The function to find a root of
+ * @param lower The lower end of the bracket to search
+ * @param upper The upper end of the bracket to search
+ * @param tolerance The maximum distance between the returned value and the root
+ * @param max_iters The maximum number of iterations to run for
+ *
+ * @return A value within the bracket that is within tolerance of a root of the
+ * function, or std::nullopt if the function does not change sign over the bracket
+ */
+template <typename Function>
+std::optional<double> findRootWithBrentsMethod(const Function& function, double lower,
+                                               double upper, double tolerance,
+                                               unsigned int max_iters = 100)
+{
+    double a  = lower;
+    double b  = upper;
+    double fa = function(a);
+    double fb = function(b);
+
+    if (fa == 0)
+    {
+        return a;
+    }
+    if (fb == 0)
+    {
+        return b;
+    }
+    if ((fa > 0) == (fb > 0))
+    {
+        return std::nullopt;
+    }
+
+    // b is always the best estimate of the root so far, and c is the previous value
+    // of b (or the other end of the bracket if the bracket has moved)
+    double c  = a;
+    double fc = fa;
+    double d  = b - a;
+    double e  = d;
+
+    // The root is always between b and c, so once they are this close together the
+    // root is within tolerance of b
+    const double half_tolerance = tolerance / 2;
+
+    for (unsigned int i = 0; i < max_iters; i++)
+    {
+        if ((fb > 0) == (fc > 0))
+        {
+            c  = a;
+            fc = fa;
+            d  = b - a;
+            e  = d;
+        }
+        if (std::abs(fc) < std::abs(fb))
+        {
+            a  = b;
+            b  = c;
+            c  = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+
+        double bracket_midpoint_offset = (c - b) / 2;
+        if (std::abs(bracket_midpoint_offset) <= half_tolerance || fb == 0)
+        {
+            return b;
+        }
+
+        if (std::abs(e) >= half_tolerance && std::abs(fa) > std::abs(fb))
+        {
+            // Try to interpolate the root
+            double p;
+            double q;
+            double s = fb / fa;
+            if (a == c)
+            {
+                // Secant method
+                p = 2 * bracket_midpoint_offset * s;
+                q = 1 - s;
+            }
+            else
+            {
+                // Inverse quadratic interpolation
+                double r = fb / fc;
+                q        = fa / fc;
+                p        = s * (2 * bracket_midpoint_offset * q * (q - r) -
+                         (b - a) * (r - 1));
+                q        = (q - 1) * (r - 1) * (s - 1);
+            }
+
+            if (p > 0)
+            {
+                q = -q;
+            }
+            else
+            {
+                p = -p;
+            }
+
+            // Only accept the interpolation if it falls within the bracket and is
+            // converging quickly enough, otherwise fall back to bisection
+            if (2 * p < std::min(3 * bracket_midpoint_offset * q -
+                                     std::abs(half_tolerance * q),
+                                 std::abs(e * q)))
+            {
+                e = d;
+                d = p / q;
+            }
+            else
+            {
+                d = bracket_midpoint_offset;
+                e = d;
+            }
+        }
+        else
+        {
+            d = bracket_midpoint_offset;
+            e = d;
+        }
+
+        a  = b;
+        fa = fb;
+        if (std::abs(d) > half_tolerance)
+        {
+            b += d;
+        }
+        else
+        {
+            b += bracket_midpoint_offset > 0 ? half_tolerance : -half_tolerance;
+        }
+        fb = function(b);
+    }
+
+    return b;
+}
@@ -0,0 +1,68 @@
+#include "software/optimization/brent_root_finder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+TEST(BrentRootFinderTest, find_root_of_linear_function)
+{
+    // f = 2x - 1
+    auto f = [](double x) { return 2 * x - 1; };
+
+    auto root = findRootWithBrentsMethod(f, -10, 10, 1e-9);
+
+    ASSERT_TRUE(root);
+    EXPECT_NEAR(0.5, *root, 1e-9);
+}
+
+TEST(BrentRootFinderTest, find_root_of_cubic_function)
+{
+    // f = x^3 - 2x - 5, which has a single real root near 2.0946
+    auto f = [](double x) { return std::pow(x, 3) - 2 * x - 5; };
+
+    auto root = findRootWithBrentsMethod(f, 2, 3, 1e-9);
+
+    ASSERT_TRUE(root);
+    EXPECT_NEAR(2.0945514815423265, *root, 1e-9);
+}
+
+TEST(BrentRootFinderTest, find_root_with_bracket_in_decreasing_order)
+{
+    // f = cos(x), which has a root at pi/2 between 0 and 3
+    auto f = [](double x) { return std::cos(x); };
+
+    auto root = findRootWithBrentsMethod(f, 3, 0, 1e-9);
+
+    ASSERT_TRUE(root);
+    EXPECT_NEAR(M_PI / 2, *root, 1e-9);
+}
+
+TEST(BrentRootFinderTest, find_root_of_step_function)
+{
+    // Interpolation is useless on a discontinuous function, so this relies on
+    // falling back to bisection
+    auto f = [](double x) { return x < 0.3 ? -1.0 : 1.0; };
+
+    auto root = findRootWithBrentsMethod(f, 0, 1, 1e-6);
+
+    ASSERT_TRUE(root);
+    EXPECT_NEAR(0.3, *root, 1e-6);
+}
+
+TEST(BrentRootFinderTest, root_at_end_of_bracket)
+{
+    auto f = [](double x) { return x - 1; };
+
+    auto root = findRootWithBrentsMethod(f, 0, 1, 1e-9);
+
+    ASSERT_TRUE(root);
+    EXPECT_DOUBLE_EQ(1, *root);
+}
+
+TEST(BrentRootFinderTest, no_sign_change_over_bracket)
+{
+    // f = x^2 + 1 has no real roots
+    auto f = [](double x) { return std::pow(x, 2) + 1; };
+
+    EXPECT_FALSE(findRootWithBrentsMethod(f, -1, 1, 1e-9));
+}
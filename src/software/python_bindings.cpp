@@ -38,6 +38,9 @@
 #include "software/geom/rectangle.h"
 #include "software/geom/segment.h"
 #include "software/geom/vector.h"
+#include "software/logger/replay_chunk.h"
+#include "software/logger/replay_compression.h"
+#include "software/logger/replay_format.h"
 #include "software/math/math_functions.h"
 #include "software/networking/tbots_network_exception.h"
 #include "software/networking/udp/threaded_proto_udp_listener.hpp"
@@ -448,6 +451,79 @@ PYBIND11_MODULE(python_bindings, m)
     py::class_<ProtoLogger>(m, "ProtoLogger")
         .def_static("createLogEntry", &ProtoLogger::createLogEntry);
 
+    // The encoded chunks are binary, so they are returned as bytes instead of str
+    py::class_<ReplayChunkEncoder>(m, "ReplayChunkEncoder")
+        .def(py::init<>())
+        .def("encodeHeader",
+             [](ReplayChunkEncoder& encoder)
+             {
+                 std::string output;
+                 encoder.encodeHeader(output);
+                 return py::bytes(output);
+             })
+        .def("encodeEntry",
+             [](ReplayChunkEncoder& encoder, const std::string& protobuf_type_full_name,
+                const std::string& serialized_proto, double receive_time_sec)
+             {
+                 std::string output;
+                 encoder.encodeEntry(protobuf_type_full_name, serialized_proto,
+                                     receive_time_sec, output);
+                 return py::bytes(output);
+             })
+        .def("encodeFooter",
+             [](ReplayChunkEncoder& encoder)
+             {
+                 std::string output;
+                 encoder.encodeFooter(output);
+                 return py::bytes(output);
+             });
+
+    // Replay chunks may be compressed with zstd, which Python can't decompress
+    m.def("readReplayChunk", [](const std::string& chunk_path)
+          { return py::bytes(readReplayChunk(chunk_path)); });
+
+    // A ReplayChunk is a sequence of (receive time, protobuf type, serialized proto)
+    // tuples. The serialized protos are memoryviews into the chunk, which keep the
+    // chunk alive for as long as they are used, so they are never copied.
+    py::class_<ReplayChunk>(m, "ReplayChunk", py::buffer_protocol())
+        .def(py::init<const std::string&>())
+        .def_buffer(
+            [](ReplayChunk& chunk)
+            {
+                return py::buffer_info(
+                    const_cast<char*>(chunk.data().data()), 1,
+                    py::format_descriptor<uint8_t>::format(), 1,
+                    {static_cast<py::ssize_t>(chunk.data().size())}, {1}, true);
+            })
+        .def("__len__", &ReplayChunk::size)
+        .def("__getitem__",
+             [](py::object self, py::ssize_t index)
+             {
+                 const ReplayChunk& chunk = self.cast<const ReplayChunk&>();
+                 const auto size          = static_cast<py::ssize_t>(chunk.size());
+                 if (index < 0)
+                 {
+                     index += size;
+                 }
+                 if (index < 0 || index >= size)
+                 {
+                     throw py::index_error();
+                 }
+
+                 const ReplayEntryView& entry = chunk.entry(static_cast<size_t>(index));
+                 const py::ssize_t start =
+                     entry.serialized_proto.data() - chunk.data().data();
+                 const py::ssize_t end =
+                     start + static_cast<py::ssize_t>(entry.serialized_proto.size());
+                 return py::make_tuple(
+                     entry.receive_time_sec,
+                     py::bytes(entry.protobuf_type_full_name.data(),
+                               entry.protobuf_type_full_name.size()),
+                     py::memoryview(self)[py::slice(start, end, 1)]);
+             })
+        .def("findEntry", &ReplayChunk::findEntry)
+        .def("receiveTimesOfType", &ReplayChunk::receiveTimesOfType);
+
     py::class_<EighteenZonePitchDivision, std::shared_ptr<EighteenZonePitchDivision>>(
         m, "EighteenZonePitchDivision")
         .def(py::init<Field>())
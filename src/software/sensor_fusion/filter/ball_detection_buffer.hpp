@@ -0,0 +1,345 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+#include "software/sensor_fusion/filter/vision_detection.h"
+
+/**
+ * A fixed capacity ring of ball detections, ordered from the most recent detection
+ * to the oldest.
+ *
+ * The detections are stored inline, so the buffer never allocates memory. Adding a
+ * detection that is newer than every detection in the buffer and removing the oldest
+ * detection are constant time, and the buffer keeps running sums of the detection
+ * positions up to date as it changes, so the least squares fit through the positions
+ * never has to revisit every detection. The running sums are recomputed exactly from
+ * the detections once for every Capacity detections added, so rounding errors can't
+ * build up in them while the buffer is never emptied.
+ *
+ * @tparam Capacity The maximum number of detections in the buffer
+ */
+template <size_t Capacity>
+class BallDetectionBuffer
+{
+   public:
+    static_assert(Capacity > 0, "The buffer must be able to hold a detection");
+
+    /**
+     * The sums needed to fit a line through a set of positions with least squares
+     */
+    struct PositionSums
+    {
+        size_t count = 0;
+        double x     = 0;
+        double y     = 0;
+        double xx    = 0;
+        double xy    = 0;
+        double yy    = 0;
+
+        /**
+         * Adds a position to the sums
+         *
+         * @param position The position to add
+         */
+        void add(const Point& position);
+
+        /**
+         * Removes a position that was previously added from the sums
+         *
+         * @param position The position to remove
+         */
+        void remove(const Point& position);
+
+        /**
+         * Returns the sums of the positions reflected about the line y = x
+         *
+         * @return the sums with x and y swapped
+         */
+        PositionSums swapXY() const;
+    };
+
+    /**
+     * Creates an empty buffer
+     */
+    BallDetectionBuffer();
+
+    /**
+     * Returns the detection at the given index, where index 0 is the most recent
+     * detection
+     *
+     * @throws std::out_of_range if index is not less than the size of the buffer
+     *
+     * @param index The index of the detection
+     *
+     * @return the detection at the given index
+     */
+    const BallDetection& at(size_t index) const;
+
+    /**
+     * Returns the most recent detection in the buffer. The buffer must not be empty.
+     *
+     * @return the most recent detection in the buffer
+     */
+    const BallDetection& newest() const;
+
+    /**
+     * Returns the oldest detection in the buffer. The buffer must not be empty.
+     *
+     * @return the oldest detection in the buffer
+     */
+    const BallDetection& oldest() const;
+
+    /**
+     * Adds a detection to the buffer, keeping the detections ordered by timestamp. If
+     * the buffer is full, the oldest detection is removed first.
+     *
+     * @param detection The detection to add
+     */
+    void insert(const BallDetection& detection);
+
+    /**
+     * Removes the oldest detection from the buffer, if there is one
+     */
+    void popOldest();
+
+    /**
+     * Removes every detection from the buffer
+     */
+    void clear();
+
+    /**
+     * Returns the sums of the positions of the most recent detections in the buffer
+     *
+     * @param num_detections The number of detections to sum, which is clamped to the
+     * size of the buffer
+     *
+     * @return the sums of the positions of the num_detections most recent detections
+     */
+    PositionSums positionSums(size_t num_detections) const;
+
+    /**
+     * Returns the number of detections in the buffer
+     *
+     * @return the number of detections in the buffer
+     */
+    size_t size() const;
+
+    /**
+     * Returns whether the buffer has no detections
+     *
+     * @return whether the buffer has no detections
+     */
+    bool empty() const;
+
+    /**
+     * Returns whether the buffer holds as many detections as it can
+     *
+     * @return whether the buffer is full
+     */
+    bool full() const;
+
+    /**
+     * Returns the maximum number of detections the buffer can hold
+     *
+     * @return the capacity of the buffer
+     */
+    static constexpr size_t capacity();
+
+   private:
+    /**
+     * Returns the slot in the ring that holds the detection at the given index
+     *
+     * @param index The index of the detection, where 0 is the most recent detection
+     *
+     * @return the slot in the ring holding the detection
+     */
+    size_t slot(size_t index) const;
+
+    /**
+     * Recomputes the sums of the positions of every detection in the buffer from
+     * scratch, discarding the rounding errors from adding and removing positions
+     */
+    void recomputeSums();
+
+    std::array<BallDetection, Capacity> detections;
+    // The slot holding the most recent detection
+    size_t head;
+    size_t count;
+    // The sums of the positions of every detection in the buffer
+    PositionSums sums;
+    // The number of detections added since the sums were last computed from scratch
+    size_t num_inserts_since_exact_sums;
+};
+
+template <size_t Capacity>
+void BallDetectionBuffer<Capacity>::PositionSums::add(const Point& position)
+{
+    count++;
+    x  += position.x();
+    y  += position.y();
+    xx += position.x() * position.x();
+    xy += position.x() * position.y();
+    yy += position.y() * position.y();
+}
+
+template <size_t Capacity>
+void BallDetectionBuffer<Capacity>::PositionSums::remove(const Point& position)
+{
+    count--;
+    x  -= position.x();
+    y  -= position.y();
+    xx -= position.x() * position.x();
+    xy -= position.x() * position.y();
+    yy -= position.y() * position.y();
+}
+
+template <size_t Capacity>
+typename BallDetectionBuffer<Capacity>::PositionSums
+BallDetectionBuffer<Capacity>::PositionSums::swapXY() const
+{
+    return PositionSums{.count = count, .x = y, .y = x, .xx = yy, .xy = xy, .yy = xx};
+}
+
+template <size_t Capacity>
+BallDetectionBuffer<Capacity>::BallDetectionBuffer()
+    : detections(), head(0), count(0), sums(), num_inserts_since_exact_sums(0)
+{
+}
+
+template <size_t Capacity>
+const BallDetection& BallDetectionBuffer<Capacity>::at(size_t index) const
+{
+    if (index >= count)
+    {
+        throw std::out_of_range("Ball detection buffer index out of range");
+    }
+    return detections[slot(index)];
+}
+
+template <size_t Capacity>
+const BallDetection& BallDetectionBuffer<Capacity>::newest() const
+{
+    return detections[slot(0)];
+}
+
+template <size_t Capacity>
+const BallDetection& BallDetectionBuffer<Capacity>::oldest() const
+{
+    return detections[slot(count - 1)];
+}
+
+template <size_t Capacity>
+void BallDetectionBuffer<Capacity>::insert(const BallDetection& detection)
+{
+    if (full())
+    {
+        popOldest();
+    }
+
+    // Detections almost always arrive in order, so the new detection usually goes at
+    // the front. Otherwise, we shift the newer detections forward to make room for it.
+    size_t index = 0;
+    while (index < count && detection < detections[slot(index)])
+    {
+        index++;
+    }
+    head = (head + Capacity - 1) % Capacity;
+    for (size_t i = 0; i < index; i++)
+    {
+        detections[slot(i)] = detections[slot(i + 1)];
+    }
+    detections[slot(index)] = detection;
+
+    count++;
+    sums.add(detection.position);
+
+    // Recomputing the sums once every time the ring wraps around keeps inserting
+    // constant time on average
+    num_inserts_since_exact_sums++;
+    if (num_inserts_since_exact_sums >= Capacity)
+    {
+        recomputeSums();
+    }
+}
+
+template <size_t Capacity>
+void BallDetectionBuffer<Capacity>::popOldest()
+{
+    if (empty())
+    {
+        return;
+    }
+
+    sums.remove(oldest().position);
+    count--;
+
+    // Start from exact sums whenever the buffer empties, so rounding errors from
+    // adding and removing positions can't build up over time
+    if (empty())
+    {
+        sums = PositionSums();
+    }
+}
+
+template <size_t Capacity>
+void BallDetectionBuffer<Capacity>::clear()
+{
+    count                        = 0;
+    sums                         = PositionSums();
+    num_inserts_since_exact_sums = 0;
+}
+
+template <size_t Capacity>
+typename BallDetectionBuffer<Capacity>::PositionSums
+BallDetectionBuffer<Capacity>::positionSums(size_t num_detections) const
+{
+    PositionSums recent_sums = sums;
+    for (size_t i = num_detections; i < count; i++)
+    {
+        recent_sums.remove(detections[slot(i)].position);
+    }
+    return recent_sums;
+}
+
+template <size_t Capacity>
+size_t BallDetectionBuffer<Capacity>::size() const
+{
+    return count;
+}
+
+template <size_t Capacity>
+bool BallDetectionBuffer<Capacity>::empty() const
+{
+    return count == 0;
+}
+
+template <size_t Capacity>
+bool BallDetectionBuffer<Capacity>::full() const
+{
+    return count == Capacity;
+}
+
+template <size_t Capacity>
+constexpr size_t BallDetectionBuffer<Capacity>::capacity()
+{
+    return Capacity;
+}
+
+template <size_t Capacity>
+size_t BallDetectionBuffer<Capacity>::slot(size_t index) const
+{
+    return (head + index) % Capacity;
+}
+
+template <size_t Capacity>
+void BallDetectionBuffer<Capacity>::recomputeSums()
+{
+    sums = PositionSums();
+    for (size_t i = 0; i < count; i++)
+    {
+        sums.add(detections[slot(i)].position);
+    }
+    num_inserts_since_exact_sums = 0;
+}
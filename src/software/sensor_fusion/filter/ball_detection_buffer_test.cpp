@@ -0,0 +1,162 @@
+#include "software/sensor_fusion/filter/ball_detection_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+class BallDetectionBufferTest : public ::testing::Test
+{
+   protected:
+    BallDetection createDetection(double x, double y, double t)
+    {
+        return BallDetection{Point(x, y), 0.0, Timestamp::fromSeconds(t), 0.9};
+    }
+
+    std::vector<double> getTimestamps()
+    {
+        std::vector<double> timestamps;
+        for (size_t i = 0; i < buffer.size(); i++)
+        {
+            timestamps.push_back(buffer.at(i).timestamp.toSeconds());
+        }
+        return timestamps;
+    }
+
+    BallDetectionBuffer<4> buffer;
+};
+
+TEST_F(BallDetectionBufferTest, empty_buffer)
+{
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_FALSE(buffer.full());
+    EXPECT_EQ(0, buffer.size());
+    EXPECT_EQ(4, buffer.capacity());
+    EXPECT_THROW(buffer.at(0), std::out_of_range);
+    EXPECT_EQ(0, buffer.positionSums(4).count);
+}
+
+TEST_F(BallDetectionBufferTest, detections_are_ordered_most_recent_first)
+{
+    buffer.insert(createDetection(0, 0, 1));
+    buffer.insert(createDetection(0, 0, 3));
+    buffer.insert(createDetection(0, 0, 2));
+
+    EXPECT_EQ(std::vector<double>({3, 2, 1}), getTimestamps());
+    EXPECT_EQ(3, buffer.newest().timestamp.toSeconds());
+    EXPECT_EQ(1, buffer.oldest().timestamp.toSeconds());
+}
+
+TEST_F(BallDetectionBufferTest, full_buffer_drops_oldest_detection)
+{
+    for (int t = 1; t <= 6; t++)
+    {
+        buffer.insert(createDetection(0, 0, t));
+    }
+    EXPECT_TRUE(buffer.full());
+    EXPECT_EQ(std::vector<double>({6, 5, 4, 3}), getTimestamps());
+
+    // A detection in the middle of the buffer still pushes out the oldest one
+    buffer.insert(createDetection(0, 0, 4.5));
+    EXPECT_EQ(std::vector<double>({6, 5, 4.5, 4}), getTimestamps());
+}
+
+TEST_F(BallDetectionBufferTest, pop_oldest)
+{
+    buffer.insert(createDetection(0, 0, 1));
+    buffer.insert(createDetection(0, 0, 2));
+
+    buffer.popOldest();
+    EXPECT_EQ(std::vector<double>({2}), getTimestamps());
+    buffer.popOldest();
+    EXPECT_TRUE(buffer.empty());
+
+    // Popping an empty buffer does nothing
+    buffer.popOldest();
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST_F(BallDetectionBufferTest, position_sums_of_most_recent_detections)
+{
+    for (int t = 1; t <= 6; t++)
+    {
+        buffer.insert(createDetection(t, 2 * t, t));
+    }
+    buffer.popOldest();
+
+    // The buffer holds the detections at t = 6, 5 and 4
+    auto sums = buffer.positionSums(2);
+    EXPECT_EQ(2, sums.count);
+    EXPECT_DOUBLE_EQ(6 + 5, sums.x);
+    EXPECT_DOUBLE_EQ(12 + 10, sums.y);
+    EXPECT_DOUBLE_EQ(36 + 25, sums.xx);
+    EXPECT_DOUBLE_EQ(72 + 50, sums.xy);
+    EXPECT_DOUBLE_EQ(144 + 100, sums.yy);
+
+    sums = buffer.positionSums(10);
+    EXPECT_EQ(3, sums.count);
+    EXPECT_DOUBLE_EQ(6 + 5 + 4, sums.x);
+    EXPECT_DOUBLE_EQ(144 + 100 + 64, sums.yy);
+
+    auto swapped_sums = sums.swapXY();
+    EXPECT_DOUBLE_EQ(sums.y, swapped_sums.x);
+    EXPECT_DOUBLE_EQ(sums.yy, swapped_sums.xx);
+    EXPECT_DOUBLE_EQ(sums.xy, swapped_sums.xy);
+}
+
+TEST_F(BallDetectionBufferTest, clear)
+{
+    buffer.insert(createDetection(1, 1, 1));
+    buffer.insert(createDetection(2, 2, 2));
+    buffer.clear();
+
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(0, buffer.positionSums(4).count);
+    EXPECT_DOUBLE_EQ(0, buffer.positionSums(4).x);
+
+    buffer.insert(createDetection(3, 3, 3));
+    EXPECT_EQ(std::vector<double>({3}), getTimestamps());
+    EXPECT_DOUBLE_EQ(3, buffer.positionSums(4).x);
+}
+
+TEST_F(BallDetectionBufferTest, position_sums_stay_exact_over_long_stream)
+{
+    BallDetectionBuffer<20> long_buffer;
+
+    // A few detections far off the field leave large rounding errors in running sums
+    // that are never recomputed, since the buffer never empties
+    double t = 0;
+    for (int i = 0; i < 5; i++, t += 0.01)
+    {
+        long_buffer.insert(createDetection(1e6, -1e6, t));
+    }
+    // Then the ball rolls back and forth along the line y = 0.5x + 1
+    for (int i = 0; i < 100000; i++, t += 0.01)
+    {
+        double x = 4 * std::sin(i * 0.001) + 0.001 * (i % 7);
+        long_buffer.insert(createDetection(x, 0.5 * x + 1, t));
+    }
+
+    BallDetectionBuffer<20>::PositionSums exact_sums;
+    for (size_t i = 0; i < long_buffer.size(); i++)
+    {
+        exact_sums.add(long_buffer.at(i).position);
+    }
+    auto sums = long_buffer.positionSums(long_buffer.size());
+
+    EXPECT_EQ(exact_sums.count, sums.count);
+    EXPECT_NEAR(exact_sums.x, sums.x, 1e-9);
+    EXPECT_NEAR(exact_sums.y, sums.y, 1e-9);
+    EXPECT_NEAR(exact_sums.xx, sums.xx, 1e-9);
+    EXPECT_NEAR(exact_sums.xy, sums.xy, 1e-9);
+    EXPECT_NEAR(exact_sums.yy, sums.yy, 1e-9);
+
+    // The slope of the least squares fit through the positions, computed from the sums
+    // about the mean as the ball filter does
+    auto slope = [](const BallDetectionBuffer<20>::PositionSums& position_sums) {
+        const double count = static_cast<double>(position_sums.count);
+        return (position_sums.xy - position_sums.x * position_sums.y / count) /
+               (position_sums.xx - position_sums.x * position_sums.x / count);
+    };
+    EXPECT_NEAR(0.5, slope(exact_sums), 1e-9);
+    EXPECT_NEAR(slope(exact_sums), slope(sums), 1e-9);
+}
@@ -1,8 +1,9 @@
 #include "software/sensor_fusion/filter/ball_filter.h"
 
-#include <Eigen/Dense>
 #include <algorithm>
-#include <vector>
+#include <array>
+#include <cmath>
+#include <limits>
 
 #include "shared/constants.h"
 #include "software/geom/algorithms/closest_point.h"
@@ -10,24 +11,25 @@
 #include "software/math/math_functions.h"
 
 
-BallFilter::BallFilter() : ball_detection_buffer(MAX_BUFFER_SIZE) {}
+BallFilter::BallFilter() : ball_detection_buffer(), sorted_new_ball_detections() {}
 
 std::optional<Ball> BallFilter::estimateBallState(
     const std::vector<BallDetection>& new_ball_detections, const Rectangle& filter_area)
 {
     addNewDetectionsToBuffer(new_ball_detections, filter_area);
-    return estimateBallStateFromBuffer(ball_detection_buffer);
+    return estimateBallStateFromBuffer();
 }
 
-void BallFilter::addNewDetectionsToBuffer(std::vector<BallDetection> new_ball_detections,
-                                          const Rectangle& filter_area)
+void BallFilter::addNewDetectionsToBuffer(
+    const std::vector<BallDetection>& new_ball_detections, const Rectangle& filter_area)
 {
-    // Sort the detections in increasing order before processing. This places the oldest
-    // detections (with the smallest timestamp) at the front of the buffer, and the most
-    // recent detections (largest timestamp) at the end of the buffer.
-    std::sort(new_ball_detections.begin(), new_ball_detections.end());
+    // Sort the detections in increasing order before processing, so the oldest
+    // detections (with the smallest timestamp) are processed first
+    sorted_new_ball_detections.assign(new_ball_detections.begin(),
+                                      new_ball_detections.end());
+    std::sort(sorted_new_ball_detections.begin(), sorted_new_ball_detections.end());
 
-    for (const auto& detection : new_ball_detections)
+    for (const auto& detection : sorted_new_ball_detections)
     {
         // Remove any detections outside the filter area
         if (!contains(filter_area, detection.position))
@@ -38,8 +40,8 @@ void BallFilter::addNewDetectionsToBuffer(std::vector<BallDetection> new_ball_de
         if (!ball_detection_buffer.empty())
         {
             // Use the smallest timestamp to minimize time_diffs of 0
-            auto detection_with_smallest_timestamp = *std::min_element(
-                ball_detection_buffer.begin(), ball_detection_buffer.end());
+            const BallDetection& detection_with_smallest_timestamp =
+                ball_detection_buffer.oldest();
             Duration time_diff =
                 detection.timestamp - detection_with_smallest_timestamp.timestamp;
 
@@ -75,69 +77,68 @@ void BallFilter::addNewDetectionsToBuffer(std::vector<BallDetection> new_ball_de
                 // This way if we have messed up and now the ball is too far away for the
                 // buffer to track, the buffer will rapidly shrink and start tracking the
                 // ball at its new location once the buffer is empty.
-                // We sort the vector in decreasing order first so that we can always
-                // ensure any elements that are ejected from the end of the buffer are the
-                // oldest data
-                std::sort(ball_detection_buffer.rbegin(), ball_detection_buffer.rend());
-                ball_detection_buffer.pop_back();
+                ball_detection_buffer.popOldest();
             }
             else
             {
-                // We sort the vector in decreasing order first so that we can always
-                // ensure any elements that are ejected from the end of the buffer are the
-                // oldest data
-                std::sort(ball_detection_buffer.rbegin(), ball_detection_buffer.rend());
-                ball_detection_buffer.push_front(detection);
+                // The buffer is kept ordered by timestamp, so if it is full the oldest
+                // data is the data that gets ejected
+                ball_detection_buffer.insert(detection);
             }
         }
         else
         {
             // If there is no data in the buffer, we always add the new data
-            ball_detection_buffer.push_front(detection);
+            ball_detection_buffer.insert(detection);
         }
     }
 }
 
-std::optional<Ball> BallFilter::estimateBallStateFromBuffer(
-    boost::circular_buffer<BallDetection> ball_detections)
+std::optional<Ball> BallFilter::estimateBallStateFromBuffer() const
 {
-    // Sort the detections in decreasing order before processing. This places the most
-    // recent detections (with the largest timestamp) at the front of the buffer, and the
-    // oldest detections (smallest timestamp) at the end of the buffer
-    std::sort(ball_detections.rbegin(), ball_detections.rend());
-
-    if (ball_detections.empty())
+    // The buffer is ordered from the most recent detection to the oldest
+    if (ball_detection_buffer.empty())
     {
         return std::nullopt;
     }
-    else if (ball_detections.size() == 1)
+    else if (ball_detection_buffer.size() == 1)
     {
         // If there is only 1 entry in the buffer, we can't fit a regression line
         // or calculate a velocity so we do our best with just the position
-        BallState ball_state(ball_detections.front().position, Vector(0, 0),
-                             ball_detections.front().distance_from_ground);
-        Ball ball(ball_state, ball_detections.front().timestamp);
+        const BallDetection& detection = ball_detection_buffer.newest();
+        BallState ball_state(detection.position, Vector(0, 0),
+                             detection.distance_from_ground);
+        Ball ball(ball_state, detection.timestamp);
         return ball;
     }
 
-    std::optional<size_t> adjusted_buffer_size = getAdjustedBufferSize(ball_detections);
+    std::optional<size_t> adjusted_buffer_size = getAdjustedBufferSize();
     if (!adjusted_buffer_size)
     {
         return std::nullopt;
     }
-    ball_detections.resize(*adjusted_buffer_size);
 
-    auto regression = calculateLineOfBestFit(ball_detections);
+    auto regression = calculateLineOfBestFit(
+        ball_detection_buffer.positionSums(*adjusted_buffer_size));
 
+    // Take the position of the most recent ball position and project it onto the line of
+    // best fit. We do this because we assume the ball must be travelling along its
+    // velocity vector (the line), and this allows us to return more stable position
+    // values since the line of best fit is less likely to fluctuate compared to the raw
+    // position of a ball detection
+    const BallDetection& latest_ball_detection = ball_detection_buffer.newest();
     Point filtered_position =
-        estimateBallPosition(ball_detections, regression.regression_line);
-
-    auto estimated_velocity = estimateBallVelocity(ball_detections, std::nullopt);
+        closestPoint(latest_ball_detection.position, regression.regression_line);
 
+    std::optional<BallVelocityEstimate> estimated_velocity;
     if (regression.regression_error < LINEAR_REGRESSION_ERROR_THRESHOLD)
     {
         estimated_velocity =
-            estimateBallVelocity(ball_detections, regression.regression_line);
+            estimateBallVelocity(*adjusted_buffer_size, regression.regression_line);
+    }
+    else
+    {
+        estimated_velocity = estimateBallVelocity(*adjusted_buffer_size, std::nullopt);
     }
     if (!estimated_velocity)
     {
@@ -145,29 +146,23 @@ std::optional<Ball> BallFilter::estimateBallStateFromBuffer(
     }
 
     BallState ball_state(filtered_position, estimated_velocity->average_velocity,
-                         ball_detections.front().distance_from_ground);
-    return Ball(ball_state, ball_detections.front().timestamp);
+                         latest_ball_detection.distance_from_ground);
+    return Ball(ball_state, latest_ball_detection.timestamp);
 }
 
-std::optional<size_t> BallFilter::getAdjustedBufferSize(
-    boost::circular_buffer<BallDetection> ball_detections)
+std::optional<size_t> BallFilter::getAdjustedBufferSize() const
 {
-    // Sort the detections in decreasing order before processing. This places the most
-    // recent detections (with the largest timestamp) at the front of the buffer, and the
-    // oldest detections (smallest timestamp) at the end of the buffer
-    std::sort(ball_detections.rbegin(), ball_detections.rend());
+    const auto num_detections = static_cast<unsigned int>(ball_detection_buffer.size());
 
     double buffer_size_velocity_magnitude_diff =
         MAX_BUFFER_SIZE_VELOCITY_MAGNITUDE - MIN_BUFFER_SIZE_VELOCITY_MAGNITUDE;
 
-    unsigned int max_buffer_size =
-        std::min(MAX_BUFFER_SIZE, static_cast<unsigned int>(ball_detections.size()));
-    unsigned int min_buffer_size =
-        std::min(MIN_BUFFER_SIZE, static_cast<unsigned int>(ball_detections.size()));
-    double buffer_size_diff = max_buffer_size - min_buffer_size;
+    unsigned int max_buffer_size = std::min(MAX_BUFFER_SIZE, num_detections);
+    unsigned int min_buffer_size = std::min(MIN_BUFFER_SIZE, num_detections);
+    double buffer_size_diff       = max_buffer_size - min_buffer_size;
 
     std::optional<BallVelocityEstimate> velocity_estimate =
-        estimateBallVelocity(ball_detections);
+        estimateBallVelocity(num_detections);
     if (!velocity_estimate)
     {
         return std::nullopt;
@@ -196,24 +191,19 @@ std::optional<size_t> BallFilter::getAdjustedBufferSize(
 }
 
 BallFilter::LinearRegressionResults BallFilter::calculateLineOfBestFit(
-    boost::circular_buffer<BallDetection> ball_detections)
+    const DetectionBuffer::PositionSums& position_sums)
 {
-    if (ball_detections.size() < 2)
+    if (position_sums.count < 2)
     {
         throw std::invalid_argument("At least 2 elements required for linear regression");
     }
 
-    auto x_vs_y_regression = calculateLinearRegression(ball_detections);
+    auto x_vs_y_regression = calculateLinearRegression(position_sums);
 
     // Linear regression cannot fit a vertical line. To get around this, we fit two lines,
     // one with x and y swapped, so any vertical line becomes horizontal. Then we take the
     // line of the two that fit the best.
-    boost::circular_buffer<BallDetection> swapped_ball_detections = ball_detections;
-    for (auto& detection : swapped_ball_detections)
-    {
-        detection.position = Point(detection.position.y(), detection.position.x());
-    }
-    auto y_vs_x_regression = calculateLinearRegression(swapped_ball_detections);
+    auto y_vs_x_regression = calculateLinearRegression(position_sums.swapXY());
     // Because we swapped the coordinates of the input, we have to swap the coordinates of
     // the output to get back to our expected coordinate space
     y_vs_x_regression.regression_line.swapXY();
@@ -230,49 +220,46 @@ BallFilter::LinearRegressionResults BallFilter::calculateLineOfBestFit(
 }
 
 BallFilter::LinearRegressionResults BallFilter::calculateLinearRegression(
-    boost::circular_buffer<BallDetection> ball_detections)
+    const DetectionBuffer::PositionSums& position_sums)
 {
-    if (ball_detections.size() < 2)
+    if (position_sums.count < 2)
     {
         throw std::invalid_argument("At least 2 elements required for linear regression");
     }
 
-    // Sort the detections in increasing order before processing. This places the oldest
-    // detections (smallest timestamp) at the front of the buffer, and the most recent
-    // detections (with the largest timestamp) at the end of the buffer
-    std::sort(ball_detections.begin(), ball_detections.end());
-
-    // Construct matrix A and vector b for linear regression. The first column of A
-    // contains the bias variable, and the second column contains the x coordinates of the
-    // ball. Vector b contains the y coordinates of the ball.
-    Eigen::MatrixXf A(ball_detections.size(), 2);
-    Eigen::VectorXf b(ball_detections.size());
-    for (unsigned i = 0; i < ball_detections.size(); i++)
+    // Solve the normal equations of the least squares fit y = intercept + slope * x.
+    // The sums of squares about the mean are computed from the raw running sums, and
+    // the sums of fewer detections by subtracting the older ones back out, which both
+    // lose precision to cancellation when the positions are far from the origin
+    // compared to how spread out they are. Positions on the field are at most a few
+    // meters from the origin, so this is still accurate enough for ball detections.
+    const double count = static_cast<double>(position_sums.count);
+    const double x_sum_of_squares =
+        position_sums.xx - position_sums.x * position_sums.x / count;
+    const double xy_sum_of_products =
+        position_sums.xy - position_sums.x * position_sums.y / count;
+    const double y_sum_of_squares =
+        position_sums.yy - position_sums.y * position_sums.y / count;
+
+    // If every x coordinate is the same (up to the rounding error in the sums), any
+    // line through the mean fits equally well, so we use a horizontal one. The other
+    // regression will fit these positions with a vertical line instead.
+    double slope = 0;
+    if (x_sum_of_squares > std::numeric_limits<double>::epsilon() * position_sums.xx)
     {
-        // This extra column of 1's is the bias variable, so that we can regress with a
-        // y-intercept
-        A(i, 0) = 1.0;
-        A(i, 1) = static_cast<float>(ball_detections.at(i).position.x());
-
-        b(i) = static_cast<float>(ball_detections.at(i).position.y());
+        slope = xy_sum_of_products / x_sum_of_squares;
     }
+    const double intercept = (position_sums.y - slope * position_sums.x) / count;
 
-    // Perform linear regression to find the line of best fit through the ball positions.
-    // This is solving the formula Ax = b, where x is the vector we want to solve for.
-    Eigen::Vector2f regression_vector =
-        A.bdcSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(b);
-    // How to calculate the error is from
-    // https://eigen.tuxfamily.org/dox/group__TutorialLinearAlgebra.html
     // NOTE: using absolute error instead of relative because coordinates
     // values should not affect error, also handles divide by 0 error
-    double regression_error = (A * regression_vector - b).norm();  // norm() is L2 norm
+    double regression_error =
+        std::sqrt(std::max(0.0, y_sum_of_squares - slope * xy_sum_of_products));
 
     // Find 2 points on the regression line that we solved for, and use this to construct
     // our own Line class
-    Eigen::Vector2f p1_vec(1, 0);
-    Point p1(0, p1_vec.dot(regression_vector));
-    Eigen::Vector2f p2_vec(1, 1);
-    Point p2(1, p2_vec.dot(regression_vector));
+    Point p1(0, intercept);
+    Point p2(1, intercept + slope);
     Line regression_line = Line(p1, p2);
 
     LinearRegressionResults results({regression_line, regression_error});
@@ -280,41 +267,40 @@ BallFilter::LinearRegressionResults BallFilter::calculateLinearRegression(
     return results;
 }
 
-Point BallFilter::estimateBallPosition(
-    boost::circular_buffer<BallDetection> ball_detections, const Line& regression_line)
+std::optional<BallFilter::BallVelocityEstimate> BallFilter::estimateBallVelocity(
+    size_t num_detections, const std::optional<Line>& ball_regression_line) const
 {
-    if (ball_detections.empty())
+    num_detections = std::min(num_detections, ball_detection_buffer.size());
+
+    // Order the detections in increasing order before processing. This places the oldest
+    // detections (smallest timestamp) at the front, and the most recent detections (with
+    // the largest timestamp) at the end. Project the detection positions onto the
+    // regression line if it was provided.
+    std::array<const BallDetection*, MAX_BUFFER_SIZE> ball_detections;
+    std::array<Point, MAX_BUFFER_SIZE> positions;
+    for (size_t i = 0; i < num_detections; i++)
     {
-        throw std::invalid_argument(
-            "Non-empty buffer required to estimate ball position");
+        ball_detections[i] = &ball_detection_buffer.at(num_detections - 1 - i);
+        positions[i]       = ball_detections[i]->position;
+        if (ball_regression_line)
+        {
+            positions[i] = closestPoint(positions[i], ball_regression_line.value());
+        }
     }
 
-    // Take the position of the most recent ball position and project it onto the line of
-    // best fit. We do this because we assume the ball must be travelling along its
-    // velocity vector (the line), and this allows us to return more stable position
-    // values since the line of best fit is less likely to fluctuate compared to the raw
-    // position of a ball detection
-    BallDetection latest_ball_detection = ball_detections.front();
-    return closestPoint(latest_ball_detection.position, regression_line);
-}
-
-std::optional<BallFilter::BallVelocityEstimate> BallFilter::estimateBallVelocity(
-    boost::circular_buffer<BallDetection> ball_detections,
-    const std::optional<Line>& ball_regression_line)
-{
-    // Sort the detections in increasing order before processing. This places the oldest
-    // detections (smallest timestamp) at the front of the buffer, and the most recent
-    // detections (with the largest timestamp) at the end of the buffer
-    std::sort(ball_detections.begin(), ball_detections.end());
-
-    std::vector<Vector> ball_velocities;
-    std::vector<double> ball_velocity_magnitudes;
-    for (unsigned i = 1; i < ball_detections.size(); i++)
+    // Accumulate the velocities between pairs of detections as we go, rather than
+    // storing them
+    unsigned int num_velocities   = 0;
+    double velocity_magnitude_sum = 0;
+    double velocity_magnitude_max = 0;
+    double velocity_magnitude_min = std::numeric_limits<double>::max();
+    Vector velocity_vector_sum    = Vector(0, 0);
+    for (unsigned i = 1; i < num_detections; i++)
     {
-        for (unsigned j = i; j < ball_detections.size(); j++)
+        for (unsigned j = i; j < num_detections; j++)
         {
-            BallDetection previous_detection = ball_detections.at(i - 1);
-            BallDetection current_detection  = ball_detections.at(j);
+            const BallDetection& previous_detection = *ball_detections[i - 1];
+            const BallDetection& current_detection  = *ball_detections[j];
 
             Duration time_diff =
                 current_detection.timestamp - previous_detection.timestamp;
@@ -325,53 +311,27 @@ std::optional<BallFilter::BallVelocityEstimate> BallFilter::estimateBallVelocity
                 continue;
             }
 
-            // Project the detection positions onto the regression line if it was provided
-            Point current_position;
-            Point previous_position;
-            if (ball_regression_line)
-            {
-                current_position  = closestPoint(current_detection.position,
-                                                 ball_regression_line.value());
-                previous_position = closestPoint(previous_detection.position,
-                                                 ball_regression_line.value());
-            }
-            else
-            {
-                current_position  = current_detection.position;
-                previous_position = previous_detection.position;
-            }
-            Vector velocity_vector    = current_position - previous_position;
+            Vector velocity_vector    = positions[j] - positions[i - 1];
             double velocity_magnitude = velocity_vector.length() / time_diff.toSeconds();
             Vector velocity           = velocity_vector.normalize(velocity_magnitude);
 
-            ball_velocity_magnitudes.emplace_back(velocity_magnitude);
-            ball_velocities.emplace_back(velocity);
+            num_velocities++;
+            velocity_magnitude_sum += velocity_magnitude;
+            velocity_vector_sum    += velocity;
+
+            velocity_magnitude_max = std::max(velocity_magnitude_max, velocity_magnitude);
+            velocity_magnitude_min = std::min(velocity_magnitude_min, velocity_magnitude);
         }
     }
 
-    if (ball_velocities.empty() || ball_velocity_magnitudes.empty())
+    if (num_velocities == 0)
     {
         return std::nullopt;
     }
 
-    double velocity_magnitude_sum = 0;
-    for (const auto& velocity_magnitude : ball_velocity_magnitudes)
-    {
-        velocity_magnitude_sum += velocity_magnitude;
-    }
     double average_velocity_magnitude =
-        velocity_magnitude_sum / static_cast<double>(ball_velocity_magnitudes.size());
-    double velocity_magnitude_max = *std::max_element(ball_velocity_magnitudes.begin(),
-                                                      ball_velocity_magnitudes.end());
-    double velocity_magnitude_min = *std::min_element(ball_velocity_magnitudes.begin(),
-                                                      ball_velocity_magnitudes.end());
-    double min_max_average = (velocity_magnitude_min + velocity_magnitude_max) / 2.0;
-
-    Vector velocity_vector_sum = Vector(0, 0);
-    for (const auto& velocity : ball_velocities)
-    {
-        velocity_vector_sum += velocity;
-    }
+        velocity_magnitude_sum / static_cast<double>(num_velocities);
+    double min_max_average  = (velocity_magnitude_min + velocity_magnitude_max) / 2.0;
     Vector average_velocity = velocity_vector_sum.normalize(average_velocity_magnitude);
 
     BallVelocityEstimate velocity_data(
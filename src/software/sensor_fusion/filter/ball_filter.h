@@ -1,11 +1,12 @@
 #pragma once
 
-#include <boost/circular_buffer.hpp>
 #include <optional>
+#include <vector>
 
 #include "software/geom/line.h"
 #include "software/geom/point.h"
 #include "software/geom/rectangle.h"
+#include "software/sensor_fusion/filter/ball_detection_buffer.hpp"
 #include "software/sensor_fusion/filter/vision_detection.h"
 #include "software/time/timestamp.h"
 #include "software/world/ball.h"
@@ -26,6 +27,10 @@
  * consistently receiving a pass relies on the ball's velocity being very stable,
  * otherwise the robot would "jiggle" back and forth as the estimated receiver position
  * would keep changing.
+ *
+ * The detections are kept in a fixed capacity buffer that also keeps the sums the
+ * regression needs up to date, so filtering a frame doesn't copy the buffer or
+ * allocate memory.
  */
 class BallFilter
 {
@@ -69,6 +74,8 @@ class BallFilter
         const Rectangle& filter_area);
 
    private:
+    using DetectionBuffer = BallDetectionBuffer<MAX_BUFFER_SIZE>;
+
     /**
      * A simple struct we use to pass around velocity estimate data
      */
@@ -86,7 +93,7 @@ class BallFilter
     struct LinearRegressionResults
     {
         Line regression_line;
-        // Regression error is root mean squared error
+        // Regression error is the L2 norm of the residuals
         double regression_error;
     };
 
@@ -101,96 +108,78 @@ class BallFilter
      * @param filter_area The area within which the ball filter will work. Any detections
      * outside of this area will be ignored.
      */
-    void addNewDetectionsToBuffer(std::vector<BallDetection> new_ball_detections,
+    void addNewDetectionsToBuffer(const std::vector<BallDetection>& new_ball_detections,
                                   const Rectangle& filter_area);
 
     /**
-     * Uses linear regression to filter the given list of ball detections to find the
+     * Uses linear regression to filter the detections in the buffer to find the
      * current "real" state of the ball.
      *
-     * @param ball_detections The detections to filter
-     *
      * @return The new ball based on the filtered state. If a filtered result cannot be
      * calculated, returns std::nullopt
      */
-    static std::optional<Ball> estimateBallStateFromBuffer(
-        boost::circular_buffer<BallDetection> ball_detections);
+    std::optional<Ball> estimateBallStateFromBuffer() const;
 
     /**
-     * Returns how large the buffer of ball detections should be based on the ball's
-     * estimated velocity. A slower moving ball will result in a larger buffer size, and a
-     * faster ball will result in a smaller buffer size. This is because with a slow
-     * moving ball, we need more data in order to fit a line with reasonable accuracy,
-     * since the datapoints will be very close to one another.
-     *
-     * @param ball_detections The full list of ball detections
+     * Returns how many of the most recent detections in the buffer should be used based
+     * on the ball's estimated velocity. A slower moving ball will result in a larger
+     * buffer size, and a faster ball will result in a smaller buffer size. This is
+     * because with a slow moving ball, we need more data in order to fit a line with
+     * reasonable accuracy, since the datapoints will be very close to one another.
      *
      * @return The size the buffer should be to perform filtering operations. If an error
      * occurs that prevents the size from being calculated correctly, returns std::nullopt
      */
-    static std::optional<size_t> getAdjustedBufferSize(
-        boost::circular_buffer<BallDetection> ball_detections);
+    std::optional<size_t> getAdjustedBufferSize() const;
 
     /**
-     * Given a buffer of ball detections, returns the line of best fit through
-     * the detection positions, and calculate the root mean squared error of this
-     * regression.
+     * Given the sums of a set of ball detection positions, returns the line of best fit
+     * through the positions, and calculate the root of the sum of squared errors of
+     * this regression.
      * Note: also considers vertical lines.
      *
-     * @throws std::invalid_argument if ball_detections has less than 2 elements
+     * @throws std::invalid_argument if the sums are of less than 2 positions
      *
-     * @param ball_detections The ball detections to fit
+     * @param position_sums The sums of the ball detection positions to fit
      *
      * @return The line of best fit through the given ball detection positions
      */
     static LinearRegressionResults calculateLineOfBestFit(
-        boost::circular_buffer<BallDetection> ball_detections);
+        const DetectionBuffer::PositionSums& position_sums);
 
     /**
-     * Given a list of ball detections, use linear regression to find a line of best fit
-     * through the ball positions, and calculate the root mean squared error of this
-     * regression.
+     * Given the sums of a set of ball detection positions, use linear regression to find
+     * a line of best fit through the ball positions, and calculate the root of the sum
+     * of squared errors of this regression. The line is fit with y as a function of x.
      *
-     * @throws std::invalid_argument if ball_detections has less than 2 elements
+     * @throws std::invalid_argument if the sums are of less than 2 positions
      *
-     * @param ball_detections The ball detections to use in the regression
+     * @param position_sums The sums of the ball detection positions to use in the
+     * regression
      *
      * @return A struct containing the regression line and error of the linear regression
      */
     static LinearRegressionResults calculateLinearRegression(
-        boost::circular_buffer<BallDetection> ball_detections);
-
-    /**
-     * Estimates the current position of the ball given a buffer of ball detections
-     * and the line of best fit through them.
-     *
-     * @throws std::invalid_argument if ball_detections has less than 2 elements
-     *
-     * @param ball_detections The ball detections
-     * @param regression_line The line of best fit through the ball positions
-     *
-     * @return The estimated position of the ball
-     */
-    static Point estimateBallPosition(
-        boost::circular_buffer<BallDetection> ball_detections,
-        const Line& regression_line);
+        const DetectionBuffer::PositionSums& position_sums);
 
     /**
-     * Estimates the ball's velocity based on the current detections in the given buffer.
+     * Estimates the ball's velocity based on the most recent detections in the buffer.
      * If the ball_regression_line is provided, the detection positions are projected onto
      * the line before the velocities are calculated. If no velocity can be estimated,
      * std::nullopt is returned.
      *
-     * @param ball_detections The ball detections to use to calculate
+     * @param num_detections The number of the most recent detections to use
      * @param ball_regression_line The ball_regression_line to snap detections to before
      * calculating velocities.
      *
      * @return A struct containing various estimates of the ball's velocity based on the
      * given detections. If no velocity can be estimated, std::nullopt is returned
      */
-    static std::optional<BallVelocityEstimate> estimateBallVelocity(
-        boost::circular_buffer<BallDetection> ball_detections,
-        const std::optional<Line>& ball_regression_line = std::nullopt);
+    std::optional<BallVelocityEstimate> estimateBallVelocity(
+        size_t num_detections,
+        const std::optional<Line>& ball_regression_line = std::nullopt) const;
 
-    boost::circular_buffer<BallDetection> ball_detection_buffer;
+    DetectionBuffer ball_detection_buffer;
+    // New detections sorted by timestamp, kept between frames to reuse its memory
+    std::vector<BallDetection> sorted_new_ball_detections;
 };
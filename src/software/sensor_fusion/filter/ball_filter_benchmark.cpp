@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+
+#include "software/sensor_fusion/filter/ball_filter.h"
+#include "software/world/field.h"
+
+namespace
+{
+    /**
+     * Creates the detections of a ball rolling around a circle in the middle of the
+     * field at a constant speed, as seen by a single camera at 60Hz
+     *
+     * @param speed The speed of the ball (m/s)
+     * @param num_detections The number of detections to create
+     *
+     * @return the ball detections, oldest first
+     */
+    std::vector<BallDetection> createDetections(double speed,
+                                                unsigned int num_detections)
+    {
+        static constexpr double CIRCLE_RADIUS_METERS = 1.5;
+        static constexpr double NOISE_STDDEV_METERS  = 0.002;
+
+        std::mt19937 random_engine(0);
+        std::normal_distribution<double> noise(0, NOISE_STDDEV_METERS);
+
+        std::vector<BallDetection> detections;
+        for (unsigned int i = 0; i < num_detections; i++)
+        {
+            double t     = i / 60.0;
+            double angle = speed * t / CIRCLE_RADIUS_METERS;
+            Point position(CIRCLE_RADIUS_METERS * std::cos(angle) + noise(random_engine),
+                           CIRCLE_RADIUS_METERS * std::sin(angle) + noise(random_engine));
+            detections.push_back(
+                BallDetection{position, 0.0, Timestamp::fromSeconds(t), 0.9});
+        }
+        return detections;
+    }
+}  // namespace
+
+static void BM_estimateBallState(benchmark::State& state)
+{
+    const Field field = Field::createSSLDivisionAField();
+    const std::vector<BallDetection> detections =
+        createDetections(static_cast<double>(state.range(0)), 6000);
+
+    BallFilter ball_filter;
+    size_t detection_index = 0;
+    for (auto _ : state)
+    {
+        if (detection_index == detections.size())
+        {
+            // Start over with a new filter so timestamps keep increasing
+            state.PauseTiming();
+            ball_filter     = BallFilter();
+            detection_index = 0;
+            state.ResumeTiming();
+        }
+        benchmark::DoNotOptimize(ball_filter.estimateBallState(
+            {detections[detection_index++]}, field.fieldBoundary()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+// The speed of the ball (m/s) changes how many detections the filter uses
+BENCHMARK(BM_estimateBallState)->Arg(0)->Arg(1)->Arg(5);
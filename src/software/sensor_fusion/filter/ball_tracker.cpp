@@ -0,0 +1,498 @@
+#include "software/sensor_fusion/filter/ball_tracker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+#include "shared/constants.h"
+#include "software/geom/algorithms/contains.h"
+
+BallTracker::BallTracker() : tracks(), ball_track_index(), sorted_new_ball_detections()
+{
+}
+
+std::optional<Ball> BallTracker::estimateBallState(
+    const std::vector<BallDetection>& new_ball_detections, const Rectangle& filter_area)
+{
+    // Apply the detections in increasing order of timestamp, so each track moves
+    // forward in time
+    sorted_new_ball_detections.assign(new_ball_detections.begin(),
+                                      new_ball_detections.end());
+    std::sort(sorted_new_ball_detections.begin(), sorted_new_ball_detections.end());
+
+    for (auto& track : tracks)
+    {
+        if (track)
+        {
+            track->detected = false;
+        }
+    }
+
+    std::optional<Timestamp> latest_timestamp;
+    for (const auto& detection : sorted_new_ball_detections)
+    {
+        if (!contains(filter_area, detection.position))
+        {
+            continue;
+        }
+        addDetection(detection);
+        latest_timestamp = detection.timestamp;
+    }
+
+    if (latest_timestamp)
+    {
+        updateBallTrack(*latest_timestamp);
+    }
+    return getBall();
+}
+
+bool BallTracker::isBallChipped() const
+{
+    if (!ball_track_index)
+    {
+        return false;
+    }
+    const auto& chip_fit = tracks[*ball_track_index]->chip_fit;
+    return chip_fit && chip_fit->chipped;
+}
+
+BallTracker::Track BallTracker::createTrack(const BallDetection& detection)
+{
+    Track track;
+    resetGroundFilter(track.ground_filter,
+                      BallState(detection.position, Vector(0, 0), 0));
+    track.chip_fit  = std::nullopt;
+    track.timestamp = detection.timestamp;
+    track.score     = 1;
+    track.detected  = true;
+    return track;
+}
+
+void BallTracker::updateTrack(Track& track, const BallDetection& detection)
+{
+    std::optional<ChipFit>& chip_fit  = track.chip_fit;
+    Timestamp ground_filter_timestamp = track.timestamp;
+
+    if (chip_fit && chip_fit->chipped)
+    {
+        const double vertical_speed = chip_fit->chip_parameters(4);
+        const Timestamp landing_timestamp =
+            chip_fit->kick_timestamp +
+            Duration::fromSeconds(2 * vertical_speed /
+                                  ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED);
+
+        if (detection.timestamp >= landing_timestamp)
+        {
+            // The ball landed, so it slows down and either bounces back up or starts
+            // rolling
+            const BallState landing_state = getChipState(*chip_fit, landing_timestamp);
+            resetGroundFilter(
+                track.ground_filter,
+                BallState(landing_state.position(),
+                          landing_state.velocity() * BOUNCE_HORIZONTAL_DAMPING, 0));
+            ground_filter_timestamp = landing_timestamp;
+
+            chip_fit = std::nullopt;
+            if (vertical_speed * BOUNCE_VERTICAL_DAMPING >=
+                MIN_BOUNCE_SPEED_METERS_PER_SECOND)
+            {
+                chip_fit = createChipFit(landing_timestamp, landing_state.position());
+            }
+        }
+        else if ((predictDetectionPosition(track, detection) - detection.position)
+                     .length() > MAX_CHIP_DEVIATION_METERS)
+        {
+            // Something changed the flight of the ball, like a robot blocking it, so we
+            // no longer know where it's going
+            resetGroundFilter(track.ground_filter,
+                              getChipState(*chip_fit, track.timestamp));
+            chip_fit = std::nullopt;
+        }
+    }
+
+    const double delta_time_seconds =
+        std::max(0.0, (detection.timestamp - ground_filter_timestamp).toSeconds());
+    if (delta_time_seconds > 0)
+    {
+        predictGroundFilter(track.ground_filter, delta_time_seconds);
+    }
+
+    if (!chip_fit || !chip_fit->chipped)
+    {
+        // Give a new chip hypothesis a few detections to fit the kick before deciding
+        // whether it explains the detections
+        const bool fitting_chip =
+            chip_fit && chip_fit->num_detections < MIN_CHIP_FIT_DETECTIONS;
+        const bool explained_by_chip =
+            chip_fit && !fitting_chip &&
+            (projectToGround(getChipState(*chip_fit, detection.timestamp),
+                             detection.camera) -
+             detection.position)
+                    .length() <= KICK_DETECTION_DISTANCE_METERS;
+        const Point predicted_position(track.ground_filter.state_estimate(0),
+                                       track.ground_filter.state_estimate(1));
+        const bool kicked = (detection.position - predicted_position).length() >
+                            KICK_DETECTION_DISTANCE_METERS;
+
+        if (kicked && detection.camera && !fitting_chip && !explained_by_chip)
+        {
+            // The ball was kicked at some point since it was last detected
+            const Timestamp kick_timestamp =
+                track.timestamp +
+                Duration::fromSeconds(
+                    (detection.timestamp - track.timestamp).toSeconds() / 2);
+            chip_fit = createChipFit(kick_timestamp, detection.position);
+        }
+    }
+
+    if (chip_fit && detection.camera)
+    {
+        addDetectionToChipFit(*chip_fit, detection);
+    }
+    if (chip_fit && !chip_fit->chipped &&
+        ((chip_fit->num_detections >= MIN_CHIP_FIT_DETECTIONS &&
+          chip_fit->log_likelihood_ratio <= -CHIP_LOG_LIKELIHOOD_RATIO_THRESHOLD) ||
+         (detection.timestamp - chip_fit->kick_timestamp).toSeconds() >
+             MAX_CHIP_FIT_DURATION_SECONDS))
+    {
+        chip_fit = std::nullopt;
+    }
+
+    // A chipped ball is detected away from where it is, so its detections would
+    // mislead the ground filter
+    if (!chip_fit || !chip_fit->chipped)
+    {
+        track.ground_filter.update(
+            Eigen::Vector2d(detection.position.x(), detection.position.y()));
+    }
+
+    track.timestamp = std::max(track.timestamp, detection.timestamp);
+    if (!track.detected)
+    {
+        track.score    = std::min(track.score + 1, MAX_TRACK_SCORE);
+        track.detected = true;
+    }
+}
+
+void BallTracker::resetGroundFilter(GroundFilter& filter, const BallState& ball_state)
+{
+    const double position_variance =
+        POSITION_MEASUREMENT_STDDEV_METERS * POSITION_MEASUREMENT_STDDEV_METERS;
+    const double velocity_variance = INITIAL_VELOCITY_STDDEV_METERS_PER_SECOND *
+                                     INITIAL_VELOCITY_STDDEV_METERS_PER_SECOND;
+
+    filter.state_estimate << ball_state.position().x(), ball_state.position().y(),
+        ball_state.velocity().x(), ball_state.velocity().y();
+    filter.state_covariance = Eigen::Vector4d(position_variance, position_variance,
+                                              velocity_variance, velocity_variance)
+                                  .asDiagonal();
+    filter.measurement_model.setIdentity();
+    filter.measurement_covariance =
+        Eigen::Vector2d(position_variance, position_variance).asDiagonal();
+}
+
+void BallTracker::predictGroundFilter(GroundFilter& filter, double delta_time_seconds)
+{
+    const double delta_time_squared = delta_time_seconds * delta_time_seconds;
+    const double delta_time_cubed   = delta_time_squared * delta_time_seconds;
+    const double delta_time_fourth  = delta_time_cubed * delta_time_seconds;
+
+    filter.process_model.setIdentity();
+    filter.process_model(0, 2) = delta_time_seconds;
+    filter.process_model(1, 3) = delta_time_seconds;
+
+    // Friction slows the ball down along its direction of travel, until it stops
+    const Vector velocity(filter.state_estimate(2), filter.state_estimate(3));
+    double deceleration = 0;
+    filter.control_model.setZero();
+    if (velocity.length() > 0)
+    {
+        const Vector direction = velocity.normalize();
+        deceleration =
+            std::min(-BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED,
+                     velocity.length() / delta_time_seconds);
+        filter.control_model << -direction.x() * delta_time_squared / 2,
+            -direction.y() * delta_time_squared / 2, -direction.x() * delta_time_seconds,
+            -direction.y() * delta_time_seconds;
+    }
+
+    // Model the unmodelled acceleration of the ball between detections as white noise
+    const double variance = ACCELERATION_STDDEV_METERS_PER_SECOND_SQUARED *
+                            ACCELERATION_STDDEV_METERS_PER_SECOND_SQUARED;
+    auto& process_covariance = filter.process_covariance;
+    process_covariance.setZero();
+    for (int position : {0, 1})
+    {
+        const int velocity = position + 2;
+        process_covariance(position, position) = delta_time_fourth / 4 * variance;
+        process_covariance(position, velocity) = delta_time_cubed / 2 * variance;
+        process_covariance(velocity, position) = delta_time_cubed / 2 * variance;
+        process_covariance(velocity, velocity) = delta_time_squared * variance;
+    }
+
+    filter.predict(Eigen::Vector<double, 1>(deceleration));
+}
+
+BallTracker::ChipFit BallTracker::createChipFit(const Timestamp& kick_timestamp,
+                                                const Point& origin)
+{
+    ChipFit chip_fit;
+    chip_fit.kick_timestamp = kick_timestamp;
+    chip_fit.origin         = origin;
+    chip_fit.num_detections = 0;
+    chip_fit.chip_normal_matrix.setZero();
+    chip_fit.chip_normal_vector.setZero();
+    chip_fit.chip_sum_of_squares = 0;
+    chip_fit.roll_normal_matrix.setZero();
+    chip_fit.roll_normal_vector.setZero();
+    chip_fit.roll_sum_of_squares = 0;
+    chip_fit.chip_parameters.setZero();
+    chip_fit.log_likelihood_ratio = 0;
+    chip_fit.chipped              = false;
+    return chip_fit;
+}
+
+void BallTracker::addDetectionToChipFit(ChipFit& chip_fit, const BallDetection& detection)
+{
+    // A ball at position p and height z is detected at m = c + (p - c) * h / (h - z) by
+    // a camera at height h above the point c. For a ball kicked from p0 with horizontal
+    // velocity v and vertical velocity vz, this rearranges to
+    //     (m - c) * (1 + g * t^2 / 2h) + c = p0 + v * t + vz * t * (m - c) / h
+    // which is linear in the parameters of the chip
+    const double t = (detection.timestamp - chip_fit.kick_timestamp).toSeconds();
+    const double camera_height = detection.camera->height;
+    const Vector camera_position = detection.camera->ground_position - chip_fit.origin;
+    const Vector detection_position  = detection.position - chip_fit.origin;
+    const Vector camera_to_detection = detection_position - camera_position;
+    const double gravity_scale =
+        1 + ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED * t * t /
+                (2 * camera_height);
+
+    for (int axis : {0, 1})
+    {
+        const double camera_coordinate    = axis == 0 ? camera_position.x()
+                                                      : camera_position.y();
+        const double detection_coordinate = axis == 0 ? detection_position.x()
+                                                      : detection_position.y();
+        const double offset_coordinate    = axis == 0 ? camera_to_detection.x()
+                                                      : camera_to_detection.y();
+
+        Eigen::Vector<double, 5> chip_row = Eigen::Vector<double, 5>::Zero();
+        chip_row(axis)     = 1;
+        chip_row(axis + 2) = t;
+        chip_row(4)        = t * offset_coordinate / camera_height;
+        const double chip_value = offset_coordinate * gravity_scale + camera_coordinate;
+        chip_fit.chip_normal_matrix  += chip_row * chip_row.transpose();
+        chip_fit.chip_normal_vector  += chip_row * chip_value;
+        chip_fit.chip_sum_of_squares += chip_value * chip_value;
+
+        Eigen::Vector<double, 4> roll_row = Eigen::Vector<double, 4>::Zero();
+        roll_row(axis)     = 1;
+        roll_row(axis + 2) = t;
+        chip_fit.roll_normal_matrix  += roll_row * roll_row.transpose();
+        chip_fit.roll_normal_vector  += roll_row * detection_coordinate;
+        chip_fit.roll_sum_of_squares += detection_coordinate * detection_coordinate;
+    }
+    chip_fit.num_detections++;
+
+    // The chip has 5 parameters, and each detection gives 2 equations
+    if (chip_fit.num_detections < 3)
+    {
+        return;
+    }
+
+    chip_fit.chip_parameters =
+        chip_fit.chip_normal_matrix.ldlt().solve(chip_fit.chip_normal_vector);
+    const Eigen::Vector<double, 4> roll_parameters =
+        chip_fit.roll_normal_matrix.ldlt().solve(chip_fit.roll_normal_vector);
+
+    // At the least squares solution x of Ax = b, the sum of squared residuals is
+    // |b|^2 - x^T A^T b
+    const double chip_residual =
+        std::max(0.0, chip_fit.chip_sum_of_squares -
+                          chip_fit.chip_parameters.dot(chip_fit.chip_normal_vector));
+    const double roll_residual =
+        std::max(0.0, chip_fit.roll_sum_of_squares -
+                          roll_parameters.dot(chip_fit.roll_normal_vector));
+    chip_fit.log_likelihood_ratio =
+        (roll_residual - chip_residual) /
+        (2 * FIT_RESIDUAL_STDDEV_METERS * FIT_RESIDUAL_STDDEV_METERS);
+
+    // Once the ball is known to be chipped, it stays chipped until it lands
+    chip_fit.chipped =
+        chip_fit.chipped ||
+        (chip_fit.num_detections >= MIN_CHIP_FIT_DETECTIONS &&
+         chip_fit.log_likelihood_ratio >= CHIP_LOG_LIKELIHOOD_RATIO_THRESHOLD &&
+         chip_fit.chip_parameters(4) >= MIN_CHIP_VERTICAL_SPEED_METERS_PER_SECOND);
+}
+
+BallState BallTracker::getChipState(const ChipFit& chip_fit, const Timestamp& timestamp)
+{
+    const double t = (timestamp - chip_fit.kick_timestamp).toSeconds();
+    const Vector velocity(chip_fit.chip_parameters(2), chip_fit.chip_parameters(3));
+    const Point position =
+        chip_fit.origin +
+        Vector(chip_fit.chip_parameters(0), chip_fit.chip_parameters(1)) + velocity * t;
+    const double height =
+        chip_fit.chip_parameters(4) * t -
+        ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED * t * t / 2;
+    return BallState(position, velocity, std::max(0.0, height));
+}
+
+BallState BallTracker::getTrackState(const Track& track)
+{
+    if (track.chip_fit && track.chip_fit->chipped)
+    {
+        return getChipState(*track.chip_fit, track.timestamp);
+    }
+
+    const auto& state = track.ground_filter.state_estimate;
+    return BallState(Point(state(0), state(1)), Vector(state(2), state(3)), 0);
+}
+
+Point BallTracker::projectToGround(const BallState& ball_state,
+                                   const std::optional<CameraPosition>& camera)
+{
+    if (!camera || ball_state.distanceFromGround() >= camera->height)
+    {
+        return ball_state.position();
+    }
+    return camera->ground_position +
+           (ball_state.position() - camera->ground_position) *
+               (camera->height / (camera->height - ball_state.distanceFromGround()));
+}
+
+Point BallTracker::predictDetectionPosition(const Track& track,
+                                            const BallDetection& detection)
+{
+    if (track.chip_fit && track.chip_fit->chipped)
+    {
+        return projectToGround(getChipState(*track.chip_fit, detection.timestamp),
+                               detection.camera);
+    }
+
+    const double delta_time_seconds =
+        std::max(0.0, (detection.timestamp - track.timestamp).toSeconds());
+    const BallState state = getTrackState(track);
+    return state.position() + state.velocity() * delta_time_seconds;
+}
+
+std::optional<size_t> BallTracker::findTrack(const BallDetection& detection) const
+{
+    std::optional<size_t> closest_track_index;
+    double closest_distance = MAX_TRACK_ASSOCIATION_DISTANCE_METERS;
+    for (size_t i = 0; i < tracks.size(); i++)
+    {
+        if (!tracks[i])
+        {
+            continue;
+        }
+
+        double distance =
+            (predictDetectionPosition(*tracks[i], detection) - detection.position)
+                .length();
+        if (distance <= closest_distance)
+        {
+            closest_track_index = i;
+            closest_distance    = distance;
+        }
+    }
+    return closest_track_index;
+}
+
+void BallTracker::addDetection(const BallDetection& detection)
+{
+    std::optional<size_t> track_index = findTrack(detection);
+    if (track_index)
+    {
+        Track& track = *tracks[*track_index];
+        if ((track.timestamp - detection.timestamp).toSeconds() <=
+            MAX_OUT_OF_ORDER_DETECTION_AGE_SECONDS)
+        {
+            updateTrack(track, detection);
+        }
+        return;
+    }
+
+    auto empty_track =
+        std::find_if(tracks.begin(), tracks.end(),
+                     [](const std::optional<Track>& track) { return !track; });
+    if (empty_track != tracks.end())
+    {
+        *empty_track = createTrack(detection);
+    }
+    else
+    {
+        tracks[findTrackToReplace()] = createTrack(detection);
+    }
+}
+
+size_t BallTracker::findTrackToReplace() const
+{
+    std::optional<size_t> track_to_replace;
+    for (size_t i = 0; i < tracks.size(); i++)
+    {
+        if (i == ball_track_index)
+        {
+            continue;
+        }
+
+        if (!track_to_replace ||
+            std::tie(tracks[i]->score, tracks[i]->timestamp) <
+                std::tie(tracks[*track_to_replace]->score,
+                         tracks[*track_to_replace]->timestamp))
+        {
+            track_to_replace = i;
+        }
+    }
+    return *track_to_replace;
+}
+
+void BallTracker::updateBallTrack(const Timestamp& latest_timestamp)
+{
+    for (auto& track : tracks)
+    {
+        if (!track)
+        {
+            continue;
+        }
+
+        if (!track->detected && track->score > 0)
+        {
+            track->score--;
+        }
+        if ((latest_timestamp - track->timestamp).toSeconds() > TRACK_TIMEOUT_SECONDS)
+        {
+            track = std::nullopt;
+        }
+    }
+
+    if (ball_track_index && !tracks[*ball_track_index])
+    {
+        ball_track_index = std::nullopt;
+    }
+
+    // Only switch to another track if it is more trusted than the ball's current
+    // track, so the ball doesn't jump between tracks with the same score
+    for (size_t i = 0; i < tracks.size(); i++)
+    {
+        if (tracks[i] && (!ball_track_index ||
+                          tracks[i]->score > tracks[*ball_track_index]->score))
+        {
+            ball_track_index = i;
+        }
+    }
+}
+
+std::optional<Ball> BallTracker::getBall() const
+{
+    if (!ball_track_index)
+    {
+        return std::nullopt;
+    }
+
+    const Track& track = *tracks[*ball_track_index];
+    Ball ball(getTrackState(track), track.timestamp);
+    ball.setChipped(isBallChipped());
+    return ball;
+}
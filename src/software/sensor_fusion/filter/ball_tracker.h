@@ -0,0 +1,317 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "software/geom/rectangle.h"
+#include "software/sensor_fusion/filter/kalman_filter.hpp"
+#include "software/sensor_fusion/filter/vision_detection.h"
+#include "software/time/timestamp.h"
+#include "software/world/ball.h"
+
+/**
+ * Given ball data from SSL Vision, tracks the "real" ball with multiple hypotheses.
+ *
+ * Unlike the BallFilter, which fits a single line through recent detections, the
+ * tracker keeps several ball tracks at once. Detections update the track they are
+ * closest to, and detections that are too far from every track start a new track.
+ * Spurious detections (e.g. a robot's coloured markers being mistaken for the ball)
+ * start short lived tracks that are discarded once they stop being detected, so they
+ * never move the estimate of the real ball.
+ *
+ * Each track has two hypotheses of how the ball moves:
+ * - the ball rolls along the ground and slows down due to friction, which is
+ *   tracked with a Kalman filter
+ * - the ball was chipped when it was last kicked, and flies through the air under
+ *   gravity
+ *
+ * Cameras see a ball in the air where the line from the camera through the ball meets
+ * the ground, so a chipped ball appears to move away from the camera as it rises.
+ * Between two frames, this looks just like the ball moving sideways, so the chip
+ * hypothesis is fit to every detection since the kick at once. Given when the ball
+ * was kicked, the projected positions of a chipped ball are linear in its initial
+ * position and velocity, so the fit is a linear least squares problem whose normal
+ * equations are updated in constant time per detection. The ball is considered
+ * chipped once the chip fits the detections much better than a ball rolling in a
+ * straight line. When a chipped ball lands, it bounces, which is tracked as a new
+ * chip that starts where the ball landed.
+ *
+ * Detections that don't include the position of their camera say nothing about the
+ * height of the ball, so balls only seen in those detections are never chipped.
+ *
+ * All of the tracker's state has a fixed size, so tracking the ball never allocates
+ * memory once the tracker has seen its first frame.
+ */
+class BallTracker
+{
+   public:
+    // The maximum number of ball tracks that are kept at once
+    static constexpr unsigned int MAX_NUM_TRACKS = 4;
+    // Detections further than this from the predicted position of every track start a
+    // new track
+    static constexpr double MAX_TRACK_ASSOCIATION_DISTANCE_METERS = 0.5;
+    // Tracks that haven't been detected for this long are discarded
+    static constexpr double TRACK_TIMEOUT_SECONDS = 0.5;
+    // The score of a track that has been detected in every recent frame. The ball's
+    // track only changes when another track has a higher score.
+    static constexpr unsigned int MAX_TRACK_SCORE = 10;
+    // Detections that are older than the latest detection applied to a track by less
+    // than this are still applied, as if they were taken at the same time
+    static constexpr double MAX_OUT_OF_ORDER_DETECTION_AGE_SECONDS = 0.01;
+
+    // The standard deviation of the ball positions reported by vision
+    static constexpr double POSITION_MEASUREMENT_STDDEV_METERS = 0.003;
+    // The standard deviation of the unmodelled acceleration of a ball rolling along the
+    // ground
+    static constexpr double ACCELERATION_STDDEV_METERS_PER_SECOND_SQUARED = 3.0;
+    // The standard deviation of the velocity of a ball when it is first detected
+    static constexpr double INITIAL_VELOCITY_STDDEV_METERS_PER_SECOND = 2.0;
+
+    // The ball is considered kicked when it is detected this far from where it was
+    // expected to be, which starts a new chip hypothesis
+    static constexpr double KICK_DETECTION_DISTANCE_METERS = 0.02;
+    // The number of detections needed before the chip hypothesis is trusted
+    static constexpr unsigned int MIN_CHIP_FIT_DETECTIONS = 6;
+    // The standard deviation of the distance between the detections and either
+    // hypothesis, used to compare how well they fit
+    static constexpr double FIT_RESIDUAL_STDDEV_METERS = 0.005;
+    // The ball is chipped when the log of how much more likely the detections are if
+    // the ball was chipped than if it rolled is at least this high, and is not chipped
+    // when it is at most the negative of this
+    static constexpr double CHIP_LOG_LIKELIHOOD_RATIO_THRESHOLD = 10.0;
+    // A chip must leave the ground at least this fast (m/s)
+    static constexpr double MIN_CHIP_VERTICAL_SPEED_METERS_PER_SECOND = 0.5;
+    // A kick that hasn't been found to be a chip after this long was not a chip
+    static constexpr double MAX_CHIP_FIT_DURATION_SECONDS = 1.5;
+    // A chipped ball detected further than this from where it was expected to be had
+    // its flight interrupted, e.g. by hitting a robot
+    static constexpr double MAX_CHIP_DEVIATION_METERS = 0.1;
+
+    // The fraction of the ball's vertical and horizontal speed it keeps when it
+    // bounces
+    static constexpr double BOUNCE_VERTICAL_DAMPING   = 0.6;
+    static constexpr double BOUNCE_HORIZONTAL_DAMPING = 0.75;
+    // A chipped ball that would bounce slower than this starts rolling when it lands
+    static constexpr double MIN_BOUNCE_SPEED_METERS_PER_SECOND = 0.5;
+
+    /**
+     * Creates a new Ball Tracker
+     */
+    explicit BallTracker();
+
+    /**
+     * Update the tracker with the new ball detection data, and returns the new
+     * estimated state of the ball given the new data
+     *
+     * @param new_ball_detections A list of new Ball detections
+     * @param filter_area The area within which the ball tracker will work. Any
+     * detections outside of this area will be ignored.
+     *
+     * @return The new ball based on the estimated state of the ball given the new data,
+     * marked as chipped if the ball is chipped. If there is no ball being tracked,
+     * returns std::nullopt
+     */
+    std::optional<Ball> estimateBallState(
+        const std::vector<BallDetection>& new_ball_detections,
+        const Rectangle& filter_area);
+
+    /**
+     * Returns whether the ball is in the air after being chipped, according to the
+     * latest estimate of the ball's state
+     *
+     * @return whether the ball is chipped. If there is no ball being tracked, returns
+     * false
+     */
+    bool isBallChipped() const;
+
+   private:
+    // The state of the ground filter is [x, y, vx, vy]
+    using GroundFilter = KalmanFilter<4, 2, 1>;
+
+    /**
+     * The hypothesis that the ball was chipped when it was kicked, fit to the
+     * detections since the kick.
+     *
+     * Positions are relative to the origin of the fit, to keep the sums small. The
+     * parameters of the chip are [x, y, vx, vy, vz], the position and velocity of the
+     * ball when it was kicked. A ball rolling in a straight line from the kick is fit
+     * to the same detections, with parameters [x, y, vx, vy].
+     */
+    struct ChipFit
+    {
+        Timestamp kick_timestamp;
+        Point origin;
+        unsigned int num_detections;
+
+        Eigen::Matrix<double, 5, 5> chip_normal_matrix;
+        Eigen::Vector<double, 5> chip_normal_vector;
+        double chip_sum_of_squares;
+        Eigen::Matrix<double, 4, 4> roll_normal_matrix;
+        Eigen::Vector<double, 4> roll_normal_vector;
+        double roll_sum_of_squares;
+
+        Eigen::Vector<double, 5> chip_parameters;
+        // The log of how much more likely the detections are if the ball was chipped
+        // than if it rolled
+        double log_likelihood_ratio;
+        bool chipped;
+    };
+
+    /**
+     * A single hypothesis of where the ball is
+     */
+    struct Track
+    {
+        GroundFilter ground_filter;
+        // The chip hypothesis since the ball was last kicked, if it hasn't been ruled
+        // out yet
+        std::optional<ChipFit> chip_fit;
+        // The timestamp of the latest detection applied to the track
+        Timestamp timestamp;
+        // Goes up every frame the track is detected and down every frame it isn't,
+        // between 0 and MAX_TRACK_SCORE
+        unsigned int score;
+        // Whether the track was detected in the latest frame
+        bool detected;
+    };
+
+    /**
+     * Creates a new track at a ball detection
+     *
+     * @param detection The detection to start the track at
+     *
+     * @return the new track
+     */
+    static Track createTrack(const BallDetection& detection);
+
+    /**
+     * Updates a track with a detection of the ball it tracks
+     *
+     * @param track The track to update
+     * @param detection The detection to update the track with, which must not be
+     * older than the latest detection applied to the track
+     */
+    static void updateTrack(Track& track, const BallDetection& detection);
+
+    /**
+     * Sets the state of the ground filter, forgetting what it knew about the ball
+     *
+     * @param filter The filter to reset
+     * @param ball_state The new state of the ball
+     */
+    static void resetGroundFilter(GroundFilter& filter, const BallState& ball_state);
+
+    /**
+     * Predicts the state of a ball rolling along the ground the given amount of time
+     * into the future
+     *
+     * @param filter The ground filter
+     * @param delta_time_seconds How far into the future to predict (s)
+     */
+    static void predictGroundFilter(GroundFilter& filter, double delta_time_seconds);
+
+    /**
+     * Starts a chip hypothesis for a ball that was kicked
+     *
+     * @param kick_timestamp When the ball was kicked
+     * @param origin Where the ball was kicked from
+     *
+     * @return the chip hypothesis, with no detections
+     */
+    static ChipFit createChipFit(const Timestamp& kick_timestamp, const Point& origin);
+
+    /**
+     * Adds a detection to a chip hypothesis and refits it
+     *
+     * @param chip_fit The chip hypothesis
+     * @param detection The detection, which must include the position of its camera
+     */
+    static void addDetectionToChipFit(ChipFit& chip_fit, const BallDetection& detection);
+
+    /**
+     * Returns the state of a chipped ball according to a chip hypothesis
+     *
+     * @param chip_fit The chip hypothesis
+     * @param timestamp The time to get the state of the ball at
+     *
+     * @return the state of the ball
+     */
+    static BallState getChipState(const ChipFit& chip_fit, const Timestamp& timestamp);
+
+    /**
+     * Returns the latest state of the ball according to a track
+     *
+     * @param track The track
+     *
+     * @return the state of the ball
+     */
+    static BallState getTrackState(const Track& track);
+
+    /**
+     * Returns where the camera that made a detection would see a ball
+     *
+     * @param ball_state The state of the ball
+     * @param camera The camera, or std::nullopt if its position is unknown
+     *
+     * @return the position at which the camera would detect the ball
+     */
+    static Point projectToGround(const BallState& ball_state,
+                                 const std::optional<CameraPosition>& camera);
+
+    /**
+     * Returns where a track predicts a detection will be
+     *
+     * @param track The track
+     * @param detection The detection
+     *
+     * @return the position at which the track predicts the ball will be detected
+     */
+    static Point predictDetectionPosition(const Track& track,
+                                          const BallDetection& detection);
+
+    /**
+     * Finds the track that a detection belongs to
+     *
+     * @param detection The detection
+     *
+     * @return the index of the track closest to the detection, or std::nullopt if
+     * every track is too far from the detection
+     */
+    std::optional<size_t> findTrack(const BallDetection& detection) const;
+
+    /**
+     * Adds a detection to the track it belongs to, or starts a new track with it
+     *
+     * @param detection The detection to add
+     */
+    void addDetection(const BallDetection& detection);
+
+    /**
+     * Finds the track to replace with a new track when every track is in use
+     *
+     * @return the index of the least trusted track that isn't the ball
+     */
+    size_t findTrackToReplace() const;
+
+    /**
+     * Discards the tracks that have timed out and chooses which track is the ball
+     *
+     * @param latest_timestamp The timestamp of the latest detection
+     */
+    void updateBallTrack(const Timestamp& latest_timestamp);
+
+    /**
+     * Returns the state of the ball according to the track that is the ball
+     *
+     * @return the ball, or std::nullopt if there is no ball being tracked
+     */
+    std::optional<Ball> getBall() const;
+
+    std::array<std::optional<Track>, MAX_NUM_TRACKS> tracks;
+    // The index of the track that is the ball
+    std::optional<size_t> ball_track_index;
+    // New detections sorted by timestamp, kept between frames to reuse its memory
+    std::vector<BallDetection> sorted_new_ball_detections;
+};
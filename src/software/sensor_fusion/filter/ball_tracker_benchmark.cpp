@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+#include "proto/message_translation/ssl_detection.h"
+#include "proto/message_translation/ssl_geometry.h"
+#include "proto/ssl_vision_wrapper.pb.h"
+#include "shared/constants.h"
+#include "software/logger/replay_reader.h"
+#include "software/sensor_fusion/filter/ball_tracker.h"
+
+/**
+ * Measures how long the BallTracker takes to process each frame of ball detections.
+ *
+ * The frames are replayed from the SSL_WrapperPacket protobufs in a log recorded by
+ * the ProtoLogger. If no log is given, a ball that is repeatedly chipped and then
+ * rolls, seen by a single camera at 60Hz, is replayed instead.
+ */
+
+namespace
+{
+    // The time the tracker must process a frame in
+    constexpr double FRAME_BUDGET_MICROSECONDS = 200;
+    // Ball detections are tracked anywhere on a division A field, including its
+    // boundary
+    const Rectangle FILTER_AREA(Point(-6.5, -5), Point(6.5, 5));
+
+    /**
+     * Reads the ball detections in every SSL_WrapperPacket in a replay log
+     *
+     * @param replay_folder The folder the ProtoLogger wrote the log to
+     *
+     * @return the ball detections in each frame, oldest first
+     */
+    std::vector<std::vector<BallDetection>> readReplayFrames(
+        const std::string& replay_folder)
+    {
+        const std::string wrapper_packet_type =
+            SSLProto::SSL_WrapperPacket::descriptor()->full_name();
+
+        std::vector<std::vector<BallDetection>> frames;
+        std::map<unsigned int, CameraPosition> camera_positions;
+        ReplayReader reader(replay_folder);
+        while (std::optional<ReplayEntry> entry = reader.nextEntry())
+        {
+            SSLProto::SSL_WrapperPacket packet;
+            if (entry->protobuf_type_full_name != wrapper_packet_type ||
+                !packet.ParseFromString(entry->serialized_proto))
+            {
+                continue;
+            }
+
+            if (packet.has_geometry())
+            {
+                camera_positions = createCameraPositions(packet.geometry());
+            }
+            if (packet.has_detection())
+            {
+                frames.push_back(createBallDetections(
+                    {packet.detection()}, std::numeric_limits<double>::lowest(),
+                    std::numeric_limits<double>::max(), false, camera_positions));
+            }
+        }
+        return frames;
+    }
+
+    /**
+     * Creates the frames of a ball that is chipped, bounces, rolls to a stop and is
+     * chipped again, as seen by a single camera at 60Hz
+     *
+     * @param num_frames The number of frames to create
+     *
+     * @return the ball detections in each frame, oldest first
+     */
+    std::vector<std::vector<BallDetection>> createSyntheticFrames(unsigned int num_frames)
+    {
+        static constexpr double KICK_PERIOD_SECONDS = 3.0;
+        static constexpr double NOISE_STDDEV_METERS = 0.002;
+        const CameraPosition camera{Point(-1.5, 1.5), 4.0};
+        const Vector chip_velocity(3, 1);
+        const double chip_vertical_speed = 3.0;
+        const double flight_time         = 2 * chip_vertical_speed /
+                                   ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED;
+        const Point kick_origin(-2, -1);
+
+        std::mt19937 random_engine(0);
+        std::normal_distribution<double> noise(0, NOISE_STDDEV_METERS);
+
+        std::vector<std::vector<BallDetection>> frames;
+        for (unsigned int i = 0; i < num_frames; i++)
+        {
+            double t      = i / 60.0;
+            double kick_t = std::fmod(t, KICK_PERIOD_SECONDS);
+
+            Point position;
+            double height = 0;
+            if (kick_t < flight_time)
+            {
+                position = kick_origin + chip_velocity * kick_t;
+                height   = chip_vertical_speed * kick_t -
+                         ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED *
+                             kick_t * kick_t / 2;
+            }
+            else
+            {
+                // The ball rolls after landing, slowing down at a constant rate
+                double roll_t     = kick_t - flight_time;
+                double roll_speed = std::max(0.0, chip_velocity.length() - 1.0 * roll_t);
+                double distance   = (chip_velocity.length() + roll_speed) / 2 * roll_t;
+                position          = kick_origin + chip_velocity * flight_time +
+                           chip_velocity.normalize(distance);
+            }
+
+            // The camera sees the ball where the line from the camera through the ball
+            // meets the ground
+            Point detected = camera.ground_position +
+                             (position - camera.ground_position) * camera.height /
+                                 (camera.height - height);
+            detected = Point(detected.x() + noise(random_engine),
+                             detected.y() + noise(random_engine));
+            frames.push_back({BallDetection{detected, 0, Timestamp::fromSeconds(t), 0.9,
+                                            camera}});
+        }
+        return frames;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    struct CommandLineArgs
+    {
+        bool help                 = false;
+        std::string replay_folder = "";
+        unsigned int repetitions  = 10;
+    };
+
+    CommandLineArgs args;
+    boost::program_options::options_description desc{"Options"};
+    desc.add_options()("help,h", boost::program_options::bool_switch(&args.help),
+                       "Help screen");
+    desc.add_options()("replay_folder",
+                       boost::program_options::value<std::string>(&args.replay_folder),
+                       "The folder of a replay log with SSL_WrapperPackets. If not "
+                       "given, a synthetic chipped ball is replayed instead.");
+    desc.add_options()("repetitions",
+                       boost::program_options::value<unsigned int>(&args.repetitions),
+                       "The number of times to replay the frames.");
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (args.help)
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    const std::vector<std::vector<BallDetection>> frames =
+        args.replay_folder.empty() ? createSyntheticFrames(6000)
+                                   : readReplayFrames(args.replay_folder);
+    if (frames.empty())
+    {
+        std::cerr << "No ball detections to replay" << std::endl;
+        return 1;
+    }
+
+    std::vector<double> frame_times_us;
+    frame_times_us.reserve(frames.size() * args.repetitions);
+    for (unsigned int repetition = 0; repetition < args.repetitions; repetition++)
+    {
+        // Start over with a new tracker so timestamps keep increasing
+        BallTracker ball_tracker;
+        for (const std::vector<BallDetection>& frame : frames)
+        {
+            auto start = std::chrono::steady_clock::now();
+            ball_tracker.estimateBallState(frame, FILTER_AREA);
+            auto end = std::chrono::steady_clock::now();
+            frame_times_us.push_back(
+                std::chrono::duration<double, std::micro>(end - start).count());
+        }
+    }
+
+    std::sort(frame_times_us.begin(), frame_times_us.end());
+    double mean_us = 0;
+    for (double frame_time_us : frame_times_us)
+    {
+        mean_us += frame_time_us / static_cast<double>(frame_times_us.size());
+    }
+    double p99_us = frame_times_us[frame_times_us.size() * 99 / 100];
+    double max_us = frame_times_us.back();
+
+    std::cout << "Frames: " << frame_times_us.size() << std::endl
+              << "Mean: " << mean_us << " us" << std::endl
+              << "p99: " << p99_us << " us" << std::endl
+              << "Max: " << max_us << " us" << std::endl
+              << "Budget: " << FRAME_BUDGET_MICROSECONDS << " us" << std::endl;
+
+    return p99_us <= FRAME_BUDGET_MICROSECONDS ? 0 : 1;
+}
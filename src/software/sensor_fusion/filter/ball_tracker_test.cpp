@@ -0,0 +1,252 @@
+#include "software/sensor_fusion/filter/ball_tracker.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "shared/constants.h"
+
+class BallTrackerTest : public ::testing::Test
+{
+   protected:
+    BallDetection createDetection(const Point& position, double t)
+    {
+        return BallDetection{.position             = position,
+                             .distance_from_ground = 0,
+                             .timestamp            = Timestamp::fromSeconds(t),
+                             .confidence           = 0.9,
+                             .camera               = camera};
+    }
+
+    /**
+     * Returns where a camera detects a ball at the given position and height
+     */
+    static Point projectToGround(const Point& position, double height,
+                                 const CameraPosition& camera)
+    {
+        return camera.ground_position + (position - camera.ground_position) *
+                                            (camera.height / (camera.height - height));
+    }
+
+    Point projectToGround(const Point& position, double height)
+    {
+        return projectToGround(position, height, camera);
+    }
+
+    BallTracker tracker;
+    const CameraPosition camera = {.ground_position = Point(-1.5, 1.5), .height = 4};
+    const Rectangle filter_area = Rectangle(Point(-5, -4), Point(5, 4));
+    const double period         = 1.0 / 60;
+    std::mt19937 random_engine  = std::mt19937(0);
+    std::normal_distribution<double> position_noise =
+        std::normal_distribution<double>(0, 0.002);
+};
+
+TEST_F(BallTrackerTest, no_detections)
+{
+    EXPECT_FALSE(tracker.estimateBallState({}, filter_area));
+    EXPECT_FALSE(tracker.isBallChipped());
+}
+
+TEST_F(BallTrackerTest, first_detection_is_initial_state)
+{
+    std::optional<Ball> ball =
+        tracker.estimateBallState({createDetection(Point(1, 2), 3)}, filter_area);
+    ASSERT_TRUE(ball);
+    EXPECT_EQ(Point(1, 2), ball->position());
+    EXPECT_EQ(Vector(0, 0), ball->velocity());
+    EXPECT_EQ(Timestamp::fromSeconds(3), ball->timestamp());
+    EXPECT_FALSE(tracker.isBallChipped());
+}
+
+TEST_F(BallTrackerTest, detections_outside_filter_area_are_ignored)
+{
+    EXPECT_FALSE(
+        tracker.estimateBallState({createDetection(Point(6, 0), 0)}, filter_area));
+}
+
+TEST_F(BallTrackerTest, rolling_ball_is_not_chipped)
+{
+    const Vector initial_velocity(3, 1);
+    const double deceleration =
+        -BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED;
+
+    std::optional<Ball> ball;
+    for (int i = 0; i < 90; i++)
+    {
+        double t        = i * period;
+        Vector velocity = initial_velocity.normalize(initial_velocity.length() -
+                                                     deceleration * t);
+        Point position =
+            Point(-3, -1) + initial_velocity.normalize(initial_velocity.length() * t -
+                                                       deceleration * t * t / 2);
+        ball = tracker.estimateBallState(
+            {createDetection(position + Vector(position_noise(random_engine),
+                                               position_noise(random_engine)),
+                             t)},
+            filter_area);
+
+        ASSERT_TRUE(ball);
+        EXPECT_FALSE(tracker.isBallChipped()) << "at t = " << t;
+        if (i > 20)
+        {
+            EXPECT_LT((ball->position() - position).length(), 0.01);
+            EXPECT_LT((ball->velocity() - velocity).length(), 0.15);
+            EXPECT_NEAR(0, ball->currentState().distanceFromGround(), 0.01);
+        }
+    }
+}
+
+TEST_F(BallTrackerTest, chipped_ball_is_detected_and_lands)
+{
+    // The ball is chipped at 3 m/s along the field and 3 m/s up, so it lands about
+    // 0.6 s later and then rolls
+    const Vector ground_velocity(3, 0);
+    const double vertical_speed = 3;
+    const double flight_time =
+        2 * vertical_speed / ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED;
+    const Point landing_position = Point(-2, -1) + ground_velocity * flight_time;
+
+    bool chip_detected = false;
+    for (int i = 0; i < 90; i++)
+    {
+        double t       = i * period;
+        Point position = Point(-2, -1) + ground_velocity * t;
+        double height  = vertical_speed * t -
+                        ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED * t * t / 2;
+        if (t > flight_time)
+        {
+            position = landing_position + ground_velocity *
+                                              BallTracker::BOUNCE_HORIZONTAL_DAMPING *
+                                              (t - flight_time);
+            height   = 0;
+        }
+
+        std::optional<Ball> ball = tracker.estimateBallState(
+            {createDetection(projectToGround(position, height) +
+                                 Vector(position_noise(random_engine),
+                                        position_noise(random_engine)),
+                             t)},
+            filter_area);
+        ASSERT_TRUE(ball);
+
+        // Near the top of the chip, the tracker knows the ball is in the air and
+        // roughly how high it is
+        if (std::abs(t - flight_time / 2) < 0.05)
+        {
+            EXPECT_TRUE(tracker.isBallChipped()) << "at t = " << t;
+            EXPECT_NEAR(height, ball->currentState().distanceFromGround(), 0.05);
+            EXPECT_LT((ball->position() - position).length(), 0.05);
+            EXPECT_LT((ball->velocity() - ground_velocity).length(), 0.2);
+        }
+        chip_detected = chip_detected || tracker.isBallChipped();
+    }
+
+    EXPECT_TRUE(chip_detected);
+    // Once the ball has landed and rolled for a while, it's back on the ground
+    EXPECT_FALSE(tracker.isBallChipped());
+}
+
+TEST_F(BallTrackerTest, chipped_ball_seen_by_two_cameras)
+{
+    // Each camera sees the ball in the air at a different position, but they agree on
+    // where the ball is once the height of the ball is known
+    const CameraPosition other_camera = {.ground_position = Point(2.5, -1.5),
+                                         .height          = 3.8};
+    const Vector ground_velocity(3, 1);
+    const double vertical_speed = 2.5;
+    const double flight_time =
+        2 * vertical_speed / ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED;
+
+    for (int i = 0; i * period < flight_time; i++)
+    {
+        double t       = i * period;
+        Point position = Point(-1, -1) + ground_velocity * t;
+        double height  = vertical_speed * t -
+                        ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED * t * t / 2;
+
+        BallDetection detection = createDetection(projectToGround(position, height), t);
+        if (i % 2 == 1)
+        {
+            detection.camera   = other_camera;
+            detection.position = projectToGround(position, height, other_camera);
+        }
+        std::optional<Ball> ball = tracker.estimateBallState({detection}, filter_area);
+        ASSERT_TRUE(ball);
+
+        if (t > flight_time / 4 && t < flight_time * 3 / 4)
+        {
+            EXPECT_TRUE(tracker.isBallChipped()) << "at t = " << t;
+            EXPECT_NEAR(height, ball->currentState().distanceFromGround(), 0.02);
+            EXPECT_LT((ball->position() - position).length(), 0.02);
+        }
+    }
+}
+
+TEST_F(BallTrackerTest, detections_without_camera_position_are_not_chipped)
+{
+    // Without knowing where the camera is, there is no parallax to tell a chipped ball
+    // apart from one rolling along the ground
+    for (int i = 0; i < 30; i++)
+    {
+        double t                 = i * period;
+        BallDetection detection  = createDetection(Point(2 * t, 0), t);
+        detection.camera         = std::nullopt;
+        std::optional<Ball> ball = tracker.estimateBallState({detection}, filter_area);
+        ASSERT_TRUE(ball);
+        EXPECT_FALSE(tracker.isBallChipped());
+    }
+}
+
+TEST_F(BallTrackerTest, outliers_do_not_move_the_ball)
+{
+    std::optional<Ball> ball;
+    for (int i = 0; i < 60; i++)
+    {
+        double t                               = i * period;
+        std::vector<BallDetection> detections = {createDetection(Point(t, 0), t)};
+
+        // Something else on the field is mistaken for the ball every few frames
+        if (i % 3 == 0)
+        {
+            detections.push_back(createDetection(Point(-3, 2), t));
+        }
+        ball = tracker.estimateBallState(detections, filter_area);
+        ASSERT_TRUE(ball);
+        if (i > 0)
+        {
+            EXPECT_LT((ball->position() - Point(t, 0)).length(), 0.01);
+        }
+    }
+    EXPECT_NEAR(1, ball->velocity().x(), 0.1);
+}
+
+TEST_F(BallTrackerTest, deflected_ball_is_tracked_continuously)
+{
+    // The ball rolls along x, then is deflected to roll along y
+    std::optional<Ball> ball;
+    Point position(0, 0);
+    for (int i = 0; i < 60; i++)
+    {
+        double t        = i * period;
+        Vector velocity = i < 30 ? Vector(2, 0) : Vector(0, 2);
+        position        = position + velocity * period;
+        ball = tracker.estimateBallState({createDetection(position, t)}, filter_area);
+        ASSERT_TRUE(ball);
+        EXPECT_LT((ball->position() - position).length(), 0.05);
+    }
+    EXPECT_NEAR(0, ball->velocity().x(), 0.2);
+    EXPECT_NEAR(2, ball->velocity().y(), 0.2);
+}
+
+TEST_F(BallTrackerTest, ball_is_lost_after_timeout)
+{
+    tracker.estimateBallState({createDetection(Point(0, 0), 0)}, filter_area);
+
+    // A detection far away from the old ball, long after it was last seen
+    std::optional<Ball> ball = tracker.estimateBallState(
+        {createDetection(Point(3, 3), BallTracker::TRACK_TIMEOUT_SECONDS + 0.1)},
+        filter_area);
+    ASSERT_TRUE(ball);
+    EXPECT_EQ(Point(3, 3), ball->position());
+}
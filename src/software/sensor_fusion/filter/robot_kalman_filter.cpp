@@ -0,0 +1,138 @@
+#include "software/sensor_fusion/filter/robot_kalman_filter.h"
+
+#include <tuple>
+
+RobotKalmanFilter::RobotKalmanFilter(const RobotDetection& detection,
+                                     const Duration& expiry_buffer_duration)
+    : filter(),
+      robot_id(detection.id),
+      timestamp(detection.timestamp),
+      expiry_buffer_duration(expiry_buffer_duration)
+{
+    const double position_variance =
+        POSITION_MEASUREMENT_STDDEV_METERS * POSITION_MEASUREMENT_STDDEV_METERS;
+    const double orientation_variance =
+        ORIENTATION_MEASUREMENT_STDDEV_RADIANS * ORIENTATION_MEASUREMENT_STDDEV_RADIANS;
+    const double velocity_variance = INITIAL_VELOCITY_STDDEV_METERS_PER_SECOND *
+                                     INITIAL_VELOCITY_STDDEV_METERS_PER_SECOND;
+    const double angular_velocity_variance =
+        INITIAL_ANGULAR_VELOCITY_STDDEV_RADIANS_PER_SECOND *
+        INITIAL_ANGULAR_VELOCITY_STDDEV_RADIANS_PER_SECOND;
+
+    filter.state_estimate << detection.position.x(), detection.position.y(),
+        detection.orientation.clamp().toRadians(), 0, 0, 0;
+    filter.state_covariance =
+        Eigen::Vector<double, STATE_SIZE>(position_variance, position_variance,
+                                          orientation_variance, velocity_variance,
+                                          velocity_variance, angular_velocity_variance)
+            .asDiagonal();
+
+    // clang-format off
+    filter.measurement_model <<
+        1, 0, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0;
+    // clang-format on
+    filter.measurement_covariance =
+        Eigen::Vector<double, MEASUREMENT_SIZE>(position_variance, position_variance,
+                                                orientation_variance)
+            .asDiagonal();
+}
+
+bool RobotKalmanFilter::update(const RobotDetection& detection)
+{
+    if (detection.id != robot_id)
+    {
+        return false;
+    }
+
+    double delta_time_seconds = detection.timestamp.toSeconds() - timestamp.toSeconds();
+    if (delta_time_seconds < -MAX_OUT_OF_ORDER_DETECTION_AGE_SECONDS)
+    {
+        return false;
+    }
+
+    if (delta_time_seconds > 0)
+    {
+        predict(delta_time_seconds);
+        timestamp = detection.timestamp;
+    }
+
+    // Measure the orientation relative to the predicted orientation, so that the
+    // filter doesn't see a full rotation when the orientation wraps around
+    const double predicted_orientation = filter.state_estimate(ORIENTATION);
+    const double measured_orientation =
+        predicted_orientation +
+        (detection.orientation - Angle::fromRadians(predicted_orientation))
+            .clamp()
+            .toRadians();
+
+    filter.update(Eigen::Vector<double, MEASUREMENT_SIZE>(
+        detection.position.x(), detection.position.y(), measured_orientation));
+    filter.state_estimate(ORIENTATION) =
+        Angle::fromRadians(filter.state_estimate(ORIENTATION)).clamp().toRadians();
+
+    return true;
+}
+
+std::optional<Robot> RobotKalmanFilter::getFilteredData(
+    const Timestamp& latest_detection_timestamp,
+    const std::optional<RobotId> breakbeam_tripped_id) const
+{
+    if (latest_detection_timestamp.toSeconds() >
+        timestamp.toSeconds() + expiry_buffer_duration.toSeconds())
+    {
+        return std::nullopt;
+    }
+
+    const auto& state = filter.state_estimate;
+    return Robot(robot_id, Point(state(X_POSITION), state(Y_POSITION)),
+                 Vector(state(X_VELOCITY), state(Y_VELOCITY)),
+                 Angle::fromRadians(state(ORIENTATION)),
+                 AngularVelocity::fromRadians(state(ANGULAR_VELOCITY)), timestamp,
+                 breakbeam_tripped_id == robot_id);
+}
+
+RobotId RobotKalmanFilter::getRobotId() const
+{
+    return robot_id;
+}
+
+void RobotKalmanFilter::predict(double delta_time_seconds)
+{
+    // clang-format off
+    filter.process_model <<
+        1, 0, 0, delta_time_seconds, 0, 0,
+        0, 1, 0, 0, delta_time_seconds, 0,
+        0, 0, 1, 0, 0, delta_time_seconds,
+        0, 0, 0, 1, 0, 0,
+        0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 1;
+    // clang-format on
+
+    // Model the acceleration of the robot between detections as white noise
+    const double delta_time_squared = delta_time_seconds * delta_time_seconds;
+    const double delta_time_cubed   = delta_time_squared * delta_time_seconds;
+    const double delta_time_fourth  = delta_time_cubed * delta_time_seconds;
+    const double linear_acceleration_variance =
+        LINEAR_ACCELERATION_STDDEV_METERS_PER_SECOND_SQUARED *
+        LINEAR_ACCELERATION_STDDEV_METERS_PER_SECOND_SQUARED;
+    const double angular_acceleration_variance =
+        ANGULAR_ACCELERATION_STDDEV_RADIANS_PER_SECOND_SQUARED *
+        ANGULAR_ACCELERATION_STDDEV_RADIANS_PER_SECOND_SQUARED;
+
+    auto& process_covariance = filter.process_covariance;
+    process_covariance.setZero();
+    for (auto [position, velocity, variance] :
+         {std::tuple(X_POSITION, X_VELOCITY, linear_acceleration_variance),
+          std::tuple(Y_POSITION, Y_VELOCITY, linear_acceleration_variance),
+          std::tuple(ORIENTATION, ANGULAR_VELOCITY, angular_acceleration_variance)})
+    {
+        process_covariance(position, position) = delta_time_fourth / 4 * variance;
+        process_covariance(position, velocity) = delta_time_cubed / 2 * variance;
+        process_covariance(velocity, position) = delta_time_cubed / 2 * variance;
+        process_covariance(velocity, velocity) = delta_time_squared * variance;
+    }
+
+    filter.predict(Eigen::Vector<double, CONTROL_SIZE>::Zero());
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <optional>
+
+#include "software/sensor_fusion/filter/kalman_filter.hpp"
+#include "software/sensor_fusion/filter/vision_detection.h"
+#include "software/time/duration.h"
+#include "software/time/timestamp.h"
+#include "software/world/robot.h"
+
+/**
+ * Tracks a single robot from its vision detections with a constant velocity Kalman
+ * filter.
+ *
+ * The state of the filter is the position, orientation, velocity and angular velocity
+ * of the robot, and every detection is a measurement of its position and orientation.
+ * Each detection is applied as soon as it is received in constant time, and all the
+ * filter's matrices have a fixed size, so tracking a robot never allocates memory.
+ */
+class RobotKalmanFilter
+{
+   public:
+    // Standard deviation of the position (m) and orientation (rad) reported by vision
+    static constexpr double POSITION_MEASUREMENT_STDDEV_METERS    = 0.005;
+    static constexpr double ORIENTATION_MEASUREMENT_STDDEV_RADIANS = 0.02;
+
+    // Standard deviation of the unmodelled linear (m/s^2) and angular (rad/s^2)
+    // accelerations of the robot between detections
+    static constexpr double LINEAR_ACCELERATION_STDDEV_METERS_PER_SECOND_SQUARED = 4.0;
+    static constexpr double ANGULAR_ACCELERATION_STDDEV_RADIANS_PER_SECOND_SQUARED =
+        20.0;
+
+    // Standard deviation of the velocity (m/s) and angular velocity (rad/s) of a
+    // robot when it is first detected
+    static constexpr double INITIAL_VELOCITY_STDDEV_METERS_PER_SECOND          = 2.0;
+    static constexpr double INITIAL_ANGULAR_VELOCITY_STDDEV_RADIANS_PER_SECOND = 10.0;
+
+    // Detections that are older than the latest detection applied to the filter by
+    // less than this are still applied, as if they were taken at the same time. Older
+    // detections are ignored.
+    static constexpr double MAX_OUT_OF_ORDER_DETECTION_AGE_SECONDS = 0.01;
+
+    /**
+     * Creates a new robot Kalman filter, starting at the given detection
+     *
+     * @param detection The first detection of the robot
+     * @param expiry_buffer_duration How long the robot can go without being detected
+     * before it is considered to have left the field
+     */
+    explicit RobotKalmanFilter(const RobotDetection& detection,
+                               const Duration& expiry_buffer_duration);
+
+    /**
+     * Updates the filter with a new detection of the robot
+     *
+     * @param detection A detection of the robot this filter tracks
+     *
+     * @return whether the detection was applied. Detections of other robots, and
+     * detections that are too old, are ignored.
+     */
+    bool update(const RobotDetection& detection);
+
+    /**
+     * Returns the filtered state of the robot
+     *
+     * @param latest_detection_timestamp The timestamp of the latest detection of any
+     * robot, used to check if this robot has expired
+     * @param breakbeam_tripped_id The id of the robot with the tripped breakbeam
+     * according to sensor fusion filtering logic (or none if no robot has a tripped
+     * beam)
+     *
+     * @return The filtered state of the robot, or std::nullopt if the robot has not
+     * been detected for longer than the expiry buffer duration
+     */
+    std::optional<Robot> getFilteredData(
+        const Timestamp& latest_detection_timestamp,
+        const std::optional<RobotId> breakbeam_tripped_id = std::nullopt) const;
+
+    /**
+     * Returns the id of the Robot that this filter is filtering for
+     *
+     * @return the id of the Robot that this filter is filtering for
+     */
+    RobotId getRobotId() const;
+
+   private:
+    static constexpr int STATE_SIZE       = 6;
+    static constexpr int MEASUREMENT_SIZE = 3;
+    static constexpr int CONTROL_SIZE     = 1;
+
+    // The indices of each quantity in the state vector
+    static constexpr int X_POSITION       = 0;
+    static constexpr int Y_POSITION       = 1;
+    static constexpr int ORIENTATION      = 2;
+    static constexpr int X_VELOCITY       = 3;
+    static constexpr int Y_VELOCITY       = 4;
+    static constexpr int ANGULAR_VELOCITY = 5;
+
+    /**
+     * Predicts the state of the robot the given amount of time after the latest
+     * detection
+     *
+     * @param delta_time_seconds The time since the latest detection (s)
+     */
+    void predict(double delta_time_seconds);
+
+    KalmanFilter<STATE_SIZE, MEASUREMENT_SIZE, CONTROL_SIZE> filter;
+    RobotId robot_id;
+    // The timestamp of the latest detection applied to the filter
+    Timestamp timestamp;
+    Duration expiry_buffer_duration;
+};
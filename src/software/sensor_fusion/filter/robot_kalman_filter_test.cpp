@@ -0,0 +1,140 @@
+#include "software/sensor_fusion/filter/robot_kalman_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "software/test_util/equal_within_tolerance.h"
+
+class RobotKalmanFilterTest : public ::testing::Test
+{
+   protected:
+    RobotDetection createDetection(RobotId id, const Point& position,
+                                   const Angle& orientation, double t)
+    {
+        return RobotDetection{.id          = id,
+                              .position    = position,
+                              .orientation = orientation,
+                              .confidence  = 1.0,
+                              .timestamp   = Timestamp::fromSeconds(t)};
+    }
+
+    const Duration expiry_buffer_duration = Duration::fromMilliseconds(200);
+};
+
+TEST_F(RobotKalmanFilterTest, first_detection_is_initial_state)
+{
+    RobotKalmanFilter filter(createDetection(3, Point(1, -2), Angle::fromRadians(0.5), 4),
+                             expiry_buffer_duration);
+
+    std::optional<Robot> robot = filter.getFilteredData(Timestamp::fromSeconds(4));
+    ASSERT_TRUE(robot);
+    EXPECT_EQ(Robot(3, Point(1, -2), Vector(0, 0), Angle::fromRadians(0.5),
+                    AngularVelocity::zero(), Timestamp::fromSeconds(4)),
+              *robot);
+    EXPECT_EQ(Timestamp::fromSeconds(4), robot->timestamp());
+    EXPECT_EQ(3, filter.getRobotId());
+}
+
+TEST_F(RobotKalmanFilterTest, ignores_other_robots_and_old_detections)
+{
+    RobotKalmanFilter filter(createDetection(1, Point(0, 0), Angle::zero(), 1),
+                             expiry_buffer_duration);
+
+    EXPECT_FALSE(filter.update(createDetection(2, Point(1, 1), Angle::zero(), 1.1)));
+    EXPECT_FALSE(filter.update(createDetection(1, Point(1, 1), Angle::zero(), 0.5)));
+
+    std::optional<Robot> robot = filter.getFilteredData(Timestamp::fromSeconds(1.1));
+    ASSERT_TRUE(robot);
+    EXPECT_EQ(Point(0, 0), robot->position());
+    EXPECT_EQ(Timestamp::fromSeconds(1), robot->timestamp());
+}
+
+TEST_F(RobotKalmanFilterTest, detections_at_the_same_time_are_fused)
+{
+    RobotKalmanFilter filter(createDetection(1, Point(0, 0), Angle::zero(), 1),
+                             expiry_buffer_duration);
+
+    // Two cameras see the robot at the same time, slightly apart
+    EXPECT_TRUE(filter.update(createDetection(1, Point(0.01, 0), Angle::zero(), 1.016)));
+    EXPECT_TRUE(filter.update(createDetection(1, Point(0.02, 0), Angle::zero(), 1.016)));
+
+    std::optional<Robot> robot = filter.getFilteredData(Timestamp::fromSeconds(1.016));
+    ASSERT_TRUE(robot);
+    EXPECT_GT(robot->position().x(), 0.01);
+    EXPECT_LT(robot->position().x(), 0.02);
+    EXPECT_EQ(Timestamp::fromSeconds(1.016), robot->timestamp());
+}
+
+TEST_F(RobotKalmanFilterTest, estimates_velocity_from_noisy_detections)
+{
+    std::mt19937 random_engine(0);
+    std::normal_distribution<double> position_noise(
+        0, RobotKalmanFilter::POSITION_MEASUREMENT_STDDEV_METERS);
+
+    const Vector velocity(1.5, -0.5);
+    const AngularVelocity angular_velocity = AngularVelocity::fromRadians(2);
+    const double period                    = 1.0 / 60;
+
+    RobotKalmanFilter filter(createDetection(0, Point(0, 0), Angle::zero(), 0),
+                             expiry_buffer_duration);
+    Point previous_position(0, 0);
+    double filter_squared_error            = 0;
+    double finite_difference_squared_error = 0;
+    for (int i = 1; i <= 120; i++)
+    {
+        double t = i * period;
+        Point position =
+            Point(velocity * t) + Vector(position_noise(random_engine),
+                                         position_noise(random_engine));
+        filter.update(createDetection(0, position, angular_velocity * t, t));
+
+        // The velocity a single position difference would give
+        Vector finite_difference_velocity = (position - previous_position) / period;
+        previous_position                 = position;
+
+        // Compare the errors once the filter has settled
+        if (i > 60)
+        {
+            std::optional<Robot> robot =
+                filter.getFilteredData(Timestamp::fromSeconds(t));
+            ASSERT_TRUE(robot);
+            filter_squared_error += (robot->velocity() - velocity).lengthSquared();
+            finite_difference_squared_error +=
+                (finite_difference_velocity - velocity).lengthSquared();
+
+            // The orientation wraps around while the robot turns
+            EXPECT_NEAR(2, robot->angularVelocity().toRadians(), 0.1);
+        }
+    }
+
+    double filter_rms_error            = std::sqrt(filter_squared_error / 60);
+    double finite_difference_rms_error = std::sqrt(finite_difference_squared_error / 60);
+    EXPECT_LT(filter_rms_error, 0.2);
+    EXPECT_LT(filter_rms_error, finite_difference_rms_error / 2);
+}
+
+TEST_F(RobotKalmanFilterTest, orientation_wraps_around)
+{
+    RobotKalmanFilter filter(createDetection(0, Point(0, 0), Angle::fromDegrees(175), 0),
+                             expiry_buffer_duration);
+    filter.update(createDetection(0, Point(0, 0), Angle::fromDegrees(-175), 0.1));
+
+    std::optional<Robot> robot = filter.getFilteredData(Timestamp::fromSeconds(0.1));
+    ASSERT_TRUE(robot);
+    // The robot turned 10 degrees counterclockwise, not 350 degrees clockwise
+    EXPECT_NEAR(100, robot->angularVelocity().toDegrees(), 10);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(robot->orientation(),
+                                               Angle::fromDegrees(180),
+                                               Angle::fromDegrees(5)));
+}
+
+TEST_F(RobotKalmanFilterTest, robot_expires)
+{
+    RobotKalmanFilter filter(createDetection(0, Point(0, 0), Angle::zero(), 1),
+                             expiry_buffer_duration);
+
+    EXPECT_TRUE(filter.getFilteredData(Timestamp::fromSeconds(1.2)));
+    EXPECT_FALSE(filter.getFilteredData(Timestamp::fromSeconds(1.21)));
+}
@@ -11,39 +11,63 @@ Team RobotTeamFilter::getFilteredData(
     const std::vector<RobotDetection>& new_robot_detections,
     const std::optional<RobotId> breakbeam_tripped_id)
 {
-    // Add filters for any robot we haven't seen before
-    for (auto detection : new_robot_detections)
+    // Pass each detection straight to the filter for its robot, adding filters for any
+    // robot we haven't seen before
+    Timestamp latest_timestamp = Timestamp::fromSeconds(0);
+    for (const RobotDetection& detection : new_robot_detections)
     {
-        if (robot_filters.find(detection.id) == robot_filters.end())
+        if (detection.id >= robot_filters.size())
         {
-            robot_filters.insert(
-                {detection.id,
-                 RobotFilter(detection, Duration::fromMilliseconds(
-                                            ROBOT_DEBOUNCE_DURATION_MILLISECONDS))});
+            continue;
+        }
+
+        std::optional<RobotKalmanFilter>& robot_filter = robot_filters[detection.id];
+        if (robot_filter)
+        {
+            robot_filter->update(detection);
+        }
+        else
+        {
+            robot_filter.emplace(detection, Duration::fromMilliseconds(
+                                                ROBOT_DEBOUNCE_DURATION_MILLISECONDS));
+        }
+
+        if (latest_timestamp < detection.timestamp)
+        {
+            latest_timestamp = detection.timestamp;
         }
     }
 
     // Get the filtered data for each robot from the robot filters. The robot filters
     // handle robot expiry (robots disappearing after not being detected for a while),
-    // so we ignore any expired robots
-    std::vector<Robot> new_filtered_robot_data;
-    for (auto it = robot_filters.begin(); it != robot_filters.end(); it++)
+    // so we drop the filters of any expired robots
+    filtered_robots.clear();
+    for (std::optional<RobotKalmanFilter>& robot_filter : robot_filters)
     {
-        auto data =
-            it->second.getFilteredData(new_robot_detections, breakbeam_tripped_id);
-        if (data)
+        if (!robot_filter)
+        {
+            continue;
+        }
+
+        std::optional<Robot> robot =
+            robot_filter->getFilteredData(latest_timestamp, breakbeam_tripped_id);
+        if (robot)
+        {
+            filtered_robots.emplace_back(*robot);
+        }
+        else
         {
-            new_filtered_robot_data.emplace_back(*data);
+            robot_filter.reset();
         }
     }
 
     Team new_team_state = current_team_state;
-    new_team_state.updateRobots(new_filtered_robot_data);
+    new_team_state.updateRobots(filtered_robots);
 
-    // Using the most recent timestamp for the team, remove any robots that have not
-    // been detected for a while
-    // TODO: Mathew - The RobotFilter and Team are both handling expiry now?
-    // Just the filter probably should
+    // Updating the team only adds and updates robots, so robots whose filters expired
+    // above are still on the team with their last filtered state. Using the most
+    // recent timestamp for the team, remove any robots that have not been updated for a
+    // while so they leave the team too
     auto most_recent_team_timestamp = new_team_state.timestamp();
     if (most_recent_team_timestamp)
     {
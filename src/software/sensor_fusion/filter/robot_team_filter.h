@@ -1,9 +1,14 @@
 #pragma once
 
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "shared/constants.h"
 #include "software/constants.h"
 #include "software/geom/angle.h"
 #include "software/geom/point.h"
-#include "software/sensor_fusion/filter/robot_filter.h"
+#include "software/sensor_fusion/filter/robot_kalman_filter.h"
 #include "software/world/team.h"
 
 class RobotTeamFilter
@@ -18,6 +23,10 @@ class RobotTeamFilter
      * Filters the new robot detection data, and returns the updated state of the team
      * given the new data
      *
+     * Each detection is passed straight to the filter for its robot, so the cost of
+     * filtering scales linearly with the number of detections and robots. Detections
+     * with a robot id of MAX_ROBOT_IDS or more are ignored.
+     *
      * @param current_team_state The current state of the Team
      * @param new_robot_detections A list of new SSL Robot detections
      * @param breakbeam_tripped_id The id of the robot with the tripped breakbeam
@@ -31,7 +40,11 @@ class RobotTeamFilter
         const std::optional<RobotId> breakbeam_tripped_id = std::nullopt);
 
 
-    // A map used to store a separate robot filter for each robot on this team, so
+    // A separate robot filter for each robot on this team, indexed by robot id, so
     // each robot can be filtered and handled separately
-    std::map<int, RobotFilter> robot_filters;
+    std::array<std::optional<RobotKalmanFilter>, MAX_ROBOT_IDS> robot_filters;
+
+   private:
+    // The filtered robots, kept between calls so that its memory is reused
+    std::vector<Robot> filtered_robots;
 };
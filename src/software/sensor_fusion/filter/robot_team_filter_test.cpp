@@ -88,3 +88,36 @@ TEST(RobotTeamFilterTest, detections_with_different_times_test)
 
     EXPECT_EQ(1, new_team.numRobots());
 }
+
+TEST(RobotTeamFilterTest, detections_with_invalid_ids_are_ignored_test)
+{
+    Team old_team = Team(Duration::fromMilliseconds(1000));
+    RobotTeamFilter robot_team_filter;
+
+    std::vector<RobotDetection> robot_detections = {
+        {0, Point(0, 0), Angle::zero(), 1.0, Timestamp::fromSeconds(1)},
+        {MAX_ROBOT_IDS, Point(1, 0), Angle::zero(), 1.0, Timestamp::fromSeconds(1)}};
+
+    Team new_team = robot_team_filter.getFilteredData(old_team, robot_detections);
+
+    EXPECT_EQ(1, new_team.numRobots());
+    EXPECT_NE(std::nullopt, new_team.getRobotById(0));
+}
+
+TEST(RobotTeamFilterTest, robot_moving_at_constant_velocity_test)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+    RobotTeamFilter robot_team_filter;
+
+    const Vector velocity(1, 2);
+    for (int i = 0; i < 60; i++)
+    {
+        double t = i / 60.0;
+        std::vector<RobotDetection> robot_detections = {
+            {4, Point(velocity * t), Angle::zero(), 1.0, Timestamp::fromSeconds(t)}};
+        team = robot_team_filter.getFilteredData(team, robot_detections);
+    }
+
+    ASSERT_NE(std::nullopt, team.getRobotById(4));
+    EXPECT_LT((team.getRobotById(4)->velocity() - velocity).length(), 0.01);
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "software/geom/angle.h"
 #include "software/geom/point.h"
 #include "software/time/timestamp.h"
@@ -24,6 +26,17 @@ struct RobotDetection
     }
 };
 
+/**
+ * The position of the SSL-Vision camera that made a detection
+ */
+struct CameraPosition
+{
+    // The point on the field directly below the camera, in meters
+    Point ground_position;
+    // The height of the camera above the field, in meters
+    double height;
+};
+
 /**
  * A lightweight datatype used to input new data into the filter.
  * We do this rather than taking the SSLProto::SSL_DetectionBall directly
@@ -40,6 +53,9 @@ struct BallDetection
     // containing the detection was captured
     Timestamp timestamp;
     double confidence;
+    // The camera that saw the ball, if its position is known. A ball in the air is
+    // detected where the line from this camera through the ball meets the ground.
+    std::optional<CameraPosition> camera = std::nullopt;
 
     bool operator<(const BallDetection& b) const
     {
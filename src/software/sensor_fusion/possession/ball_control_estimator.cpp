@@ -0,0 +1,64 @@
+#include "software/sensor_fusion/possession/ball_control_estimator.h"
+
+#include <algorithm>
+
+BallControlEstimator::BallControlEstimator(
+    const TbotsProto::SensorFusionConfig& sensor_fusion_config)
+    : possession_tracker(sensor_fusion_config.possession_tracker_config()),
+      touching_ball_threshold_meters(
+          sensor_fusion_config.touching_ball_threshold_meters()),
+      ball_contacts_by_friendly_robots()
+{
+}
+
+BallControlEstimate BallControlEstimator::update(const Team& friendly_team,
+                                                 const Team& enemy_team,
+                                                 const Ball& ball, const Field& field)
+{
+    return BallControlEstimate{
+        .possession = possession_tracker.getTeamWithPossession(friendly_team,
+                                                               enemy_team, ball, field),
+        .dribble_displacement = updateDribbleDisplacement(friendly_team, ball),
+    };
+}
+
+std::optional<Segment> BallControlEstimator::updateDribbleDisplacement(
+    const Team& friendly_team, const Ball& ball)
+{
+    // Dribble distance algorithm taken from TIGERs autoref implementation
+    // https://t.ly/vNZf9
+
+    // Add new touching robots and remove non-touching robots
+    for (const Robot& robot : friendly_team.getAllRobots())
+    {
+        if (robot.isNearDribbler(ball.position(), touching_ball_threshold_meters))
+        {
+            // Insert only occurs if the map doesn't already contain a value
+            // with the key robot.id()
+            ball_contacts_by_friendly_robots.insert(
+                std::make_pair(robot.id(), ball.position()));
+        }
+        else
+        {
+            ball_contacts_by_friendly_robots.erase(robot.id());
+        }
+    }
+    // Remove touching robots that have vanished
+    std::erase_if(ball_contacts_by_friendly_robots,
+                  [&](const auto& kv_pair)
+                  { return !friendly_team.getRobotById(kv_pair.first).has_value(); });
+
+    // The dribble displacement is the longest displacement from an initial contact
+    // point to the current ball position
+    std::optional<Segment> dribble_displacement;
+    for (const auto& [robot_id, contact_point] : ball_contacts_by_friendly_robots)
+    {
+        Segment displacement(contact_point, ball.position());
+        if (!dribble_displacement ||
+            displacement.length() > dribble_displacement->length())
+        {
+            dribble_displacement = displacement;
+        }
+    }
+    return dribble_displacement;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <map>
+#include <optional>
+
+#include "proto/parameters.pb.h"
+#include "software/geom/segment.h"
+#include "software/sensor_fusion/possession/possession_tracker.h"
+#include "software/world/ball.h"
+#include "software/world/field.h"
+#include "software/world/team.h"
+
+/**
+ * Which team controls the ball, and how far the friendly team has dribbled it
+ */
+struct BallControlEstimate
+{
+    TeamPossession possession;
+    // The displacement of the ball due to the friendly team continuously dribbling
+    // it, or std::nullopt if no friendly robot is touching the ball
+    std::optional<Segment> dribble_displacement;
+};
+
+/**
+ * Estimates which team has possession of the ball and how far the friendly team has
+ * dribbled it, from consecutive snapshots of the teams and the ball.
+ *
+ * None of the filters in sensor fusion depend on these estimates, so they can be
+ * computed after a World is published and applied to the next one.
+ */
+class BallControlEstimator
+{
+   public:
+    /**
+     * Creates a BallControlEstimator
+     *
+     * @param sensor_fusion_config The config to fetch parameters from
+     */
+    explicit BallControlEstimator(
+        const TbotsProto::SensorFusionConfig& sensor_fusion_config);
+
+    /**
+     * Updates the estimate with a new snapshot of the teams and the ball
+     *
+     * @param friendly_team The friendly team
+     * @param enemy_team The enemy team
+     * @param ball The ball
+     * @param field The field being played on
+     *
+     * @return the new estimate
+     */
+    BallControlEstimate update(const Team& friendly_team, const Team& enemy_team,
+                               const Ball& ball, const Field& field);
+
+   private:
+    /**
+     * Updates the points where friendly robots started touching the ball and returns
+     * the longest displacement of the ball from any of them
+     *
+     * @param friendly_team The friendly team
+     * @param ball The ball
+     *
+     * @return the dribble displacement, or std::nullopt if no friendly robot is
+     * touching the ball
+     */
+    std::optional<Segment> updateDribbleDisplacement(const Team& friendly_team,
+                                                     const Ball& ball);
+
+    PossessionTracker possession_tracker;
+    double touching_ball_threshold_meters;
+    // Points on the field where a friendly bot initially touched the ball
+    std::map<RobotId, Point> ball_contacts_by_friendly_robots;
+};
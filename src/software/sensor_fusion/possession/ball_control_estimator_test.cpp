@@ -0,0 +1,71 @@
+#include "software/sensor_fusion/possession/ball_control_estimator.h"
+
+#include <gtest/gtest.h>
+
+#include "shared/constants.h"
+#include "software/test_util/test_util.h"
+
+class BallControlEstimatorTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Returns a ball in front of the dribbler of a robot facing the positive x axis
+     *
+     * @param robot_position The position of the robot
+     * @param timestamp The timestamp of the ball
+     *
+     * @return the ball
+     */
+    static Ball ballInDribbler(const Point& robot_position, const Timestamp& timestamp)
+    {
+        return Ball(robot_position + Vector(DIST_TO_FRONT_OF_ROBOT_METERS, 0),
+                    Vector(), timestamp);
+    }
+
+    TbotsProto::SensorFusionConfig config;
+    Field field = Field::createSSLDivisionBField();
+    Team enemy_team;
+};
+
+TEST_F(BallControlEstimatorTest, dribble_displacement_follows_ball_from_first_contact)
+{
+    BallControlEstimator estimator(config);
+    Team friendly_team = TestUtil::setRobotPositionsHelper(
+        Team(), {Point(0, 0)}, Timestamp::fromSeconds(0));
+
+    BallControlEstimate estimate =
+        estimator.update(friendly_team, enemy_team,
+                         Ball(Point(2, 0), Vector(), Timestamp::fromSeconds(0)), field);
+    EXPECT_FALSE(estimate.dribble_displacement);
+
+    estimate = estimator.update(friendly_team, enemy_team,
+                                ballInDribbler(Point(0, 0), Timestamp::fromSeconds(0.1)),
+                                field);
+    ASSERT_TRUE(estimate.dribble_displacement);
+    EXPECT_DOUBLE_EQ(0, estimate.dribble_displacement->length());
+
+    friendly_team = TestUtil::setRobotPositionsHelper(Team(), {Point(1, 0)},
+                                                      Timestamp::fromSeconds(0.2));
+    Ball ball     = ballInDribbler(Point(1, 0), Timestamp::fromSeconds(0.2));
+    estimate      = estimator.update(friendly_team, enemy_team, ball, field);
+    ASSERT_TRUE(estimate.dribble_displacement);
+    EXPECT_DOUBLE_EQ(1, estimate.dribble_displacement->length());
+}
+
+TEST_F(BallControlEstimatorTest, dribble_displacement_is_cleared_when_robot_vanishes)
+{
+    BallControlEstimator estimator(config);
+    Team friendly_team = TestUtil::setRobotPositionsHelper(
+        Team(), {Point(0, 0)}, Timestamp::fromSeconds(0));
+
+    BallControlEstimate estimate = estimator.update(
+        friendly_team, enemy_team, ballInDribbler(Point(0, 0), Timestamp::fromSeconds(0)),
+        field);
+    ASSERT_TRUE(estimate.dribble_displacement);
+
+    estimate = estimator.update(Team(), enemy_team,
+                                ballInDribbler(Point(1, 0), Timestamp::fromSeconds(0.1)),
+                                field);
+    EXPECT_FALSE(estimate.dribble_displacement);
+    EXPECT_EQ(TeamPossession::FRIENDLY_TEAM, estimate.possession);
+}
@@ -45,11 +45,16 @@ TeamPossession PossessionTracker::getTeamWithPossession(const Team& friendly_tea
         // If the ball is on our side of the field, or there are enemy robots
         // on our side of the field, consider enemy team as having possession.
 
-        auto enemy_team_robots = enemy_team.getAllRobotsExceptGoalie();
-        auto num_enemies_in_friendly_half =
-            std::count_if(enemy_team_robots.begin(), enemy_team_robots.end(),
-                          [&field](const auto& enemy)
-                          { return field.pointInFriendlyHalf(enemy.position()); });
+        const TeamView& enemies             = enemy_team.view();
+        size_t num_enemies_in_friendly_half = 0;
+        for (size_t i = 0; i < enemies.size(); i++)
+        {
+            if (enemies.ids()[i] != enemy_team.getGoalieId() &&
+                field.pointInFriendlyHalf(enemies.positions()[i]))
+            {
+                num_enemies_in_friendly_half++;
+            }
+        }
 
         if (field.pointInFriendlyHalf(ball.position()) ||
             num_enemies_in_friendly_half > 0)
@@ -1,9 +1,31 @@
 #include "software/sensor_fusion/sensor_fusion.h"
 
+#include <algorithm>
+
 #include "software/geom/algorithms/distance.h"
 #include "software/logger/logger.h"
+#include "software/tracing/tracer.h"
 
-SensorFusion::SensorFusion(TbotsProto::SensorFusionConfig sensor_fusion_config)
+namespace
+{
+    /**
+     * Assigns the goalie of a team. The team is only modified, giving it a new
+     * generation, if the goalie changed.
+     *
+     * @param team The team
+     * @param goalie_id The id of the goalie
+     */
+    void assignGoalie(Versioned<Team>& team, unsigned int goalie_id)
+    {
+        if (team->getGoalieId() != goalie_id)
+        {
+            team.modify().assignGoalie(goalie_id);
+        }
+    }
+}  // namespace
+
+SensorFusion::SensorFusion(TbotsProto::SensorFusionConfig sensor_fusion_config,
+                           bool estimate_ball_control)
     : sensor_fusion_config(sensor_fusion_config),
       field(std::nullopt),
       ball(std::nullopt),
@@ -12,12 +34,15 @@ SensorFusion::SensorFusion(TbotsProto::SensorFusionConfig sensor_fusion_config)
       game_state(),
       referee_stage(std::nullopt),
       dribble_displacement(std::nullopt),
+      camera_positions(),
+      vision_frame_aggregator(Duration::fromSeconds(
+          sensor_fusion_config.vision_capture_window_seconds())),
       ball_filter(),
+      ball_tracker(),
       friendly_team_filter(),
       enemy_team_filter(),
       possession(TeamPossession::FRIENDLY_TEAM),
-      possession_tracker(std::make_shared<PossessionTracker>(
-          sensor_fusion_config.possession_tracker_config())),
+      ball_control_estimator(std::nullopt),
       friendly_goalie_id(0),
       enemy_goalie_id(0),
       defending_positive_side(false),
@@ -25,6 +50,10 @@ SensorFusion::SensorFusion(TbotsProto::SensorFusionConfig sensor_fusion_config)
       reset_time_vision_packets_detected(0),
       last_t_capture(0)
 {
+    if (estimate_ball_control)
+    {
+        ball_control_estimator.emplace(sensor_fusion_config);
+    }
 }
 
 std::optional<World> SensorFusion::getWorld() const
@@ -49,11 +78,13 @@ std::optional<World> SensorFusion::getWorld() const
     }
 }
 
-void SensorFusion::processSensorProto(const SensorProto& sensor_msg)
+bool SensorFusion::processSensorProto(SensorProto sensor_msg)
 {
+    bool vision_window_applied = false;
     if (sensor_msg.has_ssl_vision_msg())
     {
-        updateWorld(sensor_msg.ssl_vision_msg());
+        vision_window_applied =
+            updateWorld(std::move(*sensor_msg.mutable_ssl_vision_msg()));
     }
 
     if (sensor_msg.has_ssl_referee_msg())
@@ -63,24 +94,26 @@ void SensorFusion::processSensorProto(const SensorProto& sensor_msg)
 
     updateWorld(sensor_msg.robot_status_msgs());
 
-    friendly_team.assignGoalie(friendly_goalie_id);
-    enemy_team.assignGoalie(enemy_goalie_id);
+    assignGoalie(friendly_team, friendly_goalie_id);
+    assignGoalie(enemy_team, enemy_goalie_id);
 
     if (sensor_fusion_config.override_game_controller_friendly_goalie_id())
     {
         RobotId friendly_goalie_id_override = sensor_fusion_config.friendly_goalie_id();
-        friendly_team.assignGoalie(friendly_goalie_id_override);
+        assignGoalie(friendly_team, friendly_goalie_id_override);
     }
 
     if (sensor_fusion_config.override_game_controller_enemy_goalie_id())
     {
         RobotId enemy_goalie_id_override = sensor_fusion_config.enemy_goalie_id();
-        enemy_team.assignGoalie(enemy_goalie_id_override);
+        assignGoalie(enemy_team, enemy_goalie_id_override);
     }
+
+    return vision_window_applied;
 }
 
 
-void SensorFusion::updateWorld(const SSLProto::SSL_WrapperPacket& packet)
+bool SensorFusion::updateWorld(SSLProto::SSL_WrapperPacket packet)
 {
     if (packet.has_geometry())
     {
@@ -98,26 +131,62 @@ void SensorFusion::updateWorld(const SSLProto::SSL_WrapperPacket& packet)
             updateWorld(packet.geometry());
         }
 
-        updateWorld(packet.detection());
+        std::vector<VisionFrameAggregator::CaptureWindow> capture_windows =
+            vision_frame_aggregator.addFrame(std::move(*packet.mutable_detection()));
+        if (capture_windows.empty())
+        {
+            return false;
+        }
+
+        for (const auto& ssl_detection_frames : capture_windows)
+        {
+            updateWorld(ssl_detection_frames);
+        }
 
-        if (!ball && (packet.detection().robots_blue().size() != 0 ||
-                      packet.detection().robots_yellow().size() != 0))
+        const auto& latest_frames = capture_windows.back();
+        bool robots_detected      = std::any_of(
+            latest_frames.begin(), latest_frames.end(),
+            [](const SSLProto::SSL_DetectionFrame& frame)
+            {
+                return frame.robots_blue().size() != 0 ||
+                       frame.robots_yellow().size() != 0;
+            });
+        if (!ball && robots_detected)
         {
             LOG(WARNING)
                 << "There are robots on the field, but no ball. It is highly likely that sensor fusion has filtered the ball out!";
         }
+        return true;
     }
+
+    return false;
 }
 
 void SensorFusion::updateWorld(const SSLProto::SSL_GeometryData& geometry_packet)
 {
-    field = createField(geometry_packet);
-    if (!field)
+    std::optional<Field> new_field = createField(geometry_packet);
+    if (new_field)
+    {
+        // Geometry packets are sent repeatedly, so the field only changes when the new
+        // packet describes a different field
+        if (!field || field->get() != *new_field)
+        {
+            field = Versioned<Field>(*new_field);
+        }
+    }
+    else
     {
+        field = std::nullopt;
         LOG(WARNING)
             << "Invalid field packet has been detected, which means field may be unreliable "
             << "and the createFieldFromPacketGeometry may be parsing using the wrong proto format";
     }
+
+    // Geometry packets without calibrations don't say the cameras moved
+    if (geometry_packet.calib_size() > 0)
+    {
+        camera_positions = createCameraPositions(geometry_packet);
+    }
 }
 
 void SensorFusion::updateWorld(const SSLProto::Referee& packet)
@@ -125,8 +194,12 @@ void SensorFusion::updateWorld(const SSLProto::Referee& packet)
     if (sensor_fusion_config.friendly_color_yellow())
     {
         if (!ssl_referee::deprecated_commands.contains(packet.command()))
-            game_state.updateRefereeCommand(
-                ssl_referee::createRefereeCommand(packet, TeamColour::YELLOW));
+            game_state.update(
+                [&](GameState& state)
+                {
+                    state.updateRefereeCommand(
+                        ssl_referee::createRefereeCommand(packet, TeamColour::YELLOW));
+                });
         friendly_goalie_id = packet.yellow().goalkeeper();
         enemy_goalie_id    = packet.blue().goalkeeper();
         if (packet.has_blue_team_on_positive_half())
@@ -137,8 +210,12 @@ void SensorFusion::updateWorld(const SSLProto::Referee& packet)
     else
     {
         if (!ssl_referee::deprecated_commands.contains(packet.command()))
-            game_state.updateRefereeCommand(
-                ssl_referee::createRefereeCommand(packet, TeamColour::BLUE));
+            game_state.update(
+                [&](GameState& state)
+                {
+                    state.updateRefereeCommand(
+                        ssl_referee::createRefereeCommand(packet, TeamColour::BLUE));
+                });
         friendly_goalie_id = packet.blue().goalkeeper();
         enemy_goalie_id    = packet.yellow().goalkeeper();
         if (packet.has_blue_team_on_positive_half())
@@ -147,17 +224,18 @@ void SensorFusion::updateWorld(const SSLProto::Referee& packet)
         }
     }
 
-    if (game_state.isBallPlacement())
+    if (game_state->isBallPlacement())
     {
         auto pt = getBallPlacementPoint(packet);
         if (pt)
         {
-            game_state.setBallPlacementPoint(*pt);
+            game_state.update([&](GameState& state)
+                              { state.setBallPlacementPoint(*pt); });
         }
         else
         {
-            std::string state = game_state.isOurBallPlacement() ? "BALL_PLACEMENT_US"
-                                                                : "BALL_PLACEMENT_THEM";
+            std::string state = game_state->isOurBallPlacement() ? "BALL_PLACEMENT_US"
+                                                                 : "BALL_PLACEMENT_THEM";
             LOG(WARNING) << "In " << state << " state, but no ball placement point found"
                          << std::endl;
         }
@@ -186,7 +264,12 @@ void SensorFusion::updateWorld(
                 unavailableCapabilities.insert(RobotCapability::Dribble);
             }
         }
-        friendly_team.setUnavailableRobotCapabilities(robot_id, unavailableCapabilities);
+        std::optional<Robot> robot = friendly_team->getRobotById(robot_id);
+        if (robot && robot->getUnavailableCapabilities() != unavailableCapabilities)
+        {
+            friendly_team.modify().setUnavailableRobotCapabilities(
+                robot_id, unavailableCapabilities);
+        }
 
         if (robot_status_msg.has_power_status() &&
             robot_status_msg.power_status().breakbeam_tripped())
@@ -207,7 +290,7 @@ bool SensorFusion::shouldTrustRobotStatus()
     }
 
     std::optional<Robot> robot_with_ball_in_dribbler =
-        friendly_team.getRobotById(friendly_robot_id_with_ball_in_dribbler.value());
+        friendly_team->getRobotById(friendly_robot_id_with_ball_in_dribbler.value());
     if (!robot_with_ball_in_dribbler.has_value())
     {
         return false;
@@ -223,13 +306,14 @@ bool SensorFusion::shouldTrustRobotStatus()
     // agrees that the ball is roughly near the robot or if ssl vision doesn't detect an
     // ball. If vision has the ball far from the breakbeam detection, then we will ignore
     // the breakbeam detection and trust vision instead.
-    return distance(robot_with_ball_in_dribbler->position(), ball->position()) <=
+    return distance(robot_with_ball_in_dribbler->position(), (*ball)->position()) <=
            DISTANCE_THRESHOLD_FOR_BREAKBEAM_FAULT_DETECTION;
 }
 
 
 
-void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame& ssl_detection_frame)
+void SensorFusion::updateWorld(
+    const std::vector<SSLProto::SSL_DetectionFrame>& ssl_detection_frames)
 {
     double min_valid_x              = sensor_fusion_config.min_valid_x();
     double max_valid_x              = sensor_fusion_config.max_valid_x();
@@ -237,16 +321,23 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame& ssl_detection
     bool friendly_team_is_yellow    = sensor_fusion_config.friendly_color_yellow();
 
     std::optional<Ball> new_ball;
-    auto ball_detections = createBallDetections({ssl_detection_frame}, min_valid_x,
-                                                max_valid_x, ignore_invalid_camera_data);
+    auto ball_detections =
+        createBallDetections(ssl_detection_frames, min_valid_x, max_valid_x,
+                             ignore_invalid_camera_data, camera_positions);
 
     auto yellow_team =
-        createTeamDetection({ssl_detection_frame}, TeamColour::YELLOW, min_valid_x,
+        createTeamDetection(ssl_detection_frames, TeamColour::YELLOW, min_valid_x,
                             max_valid_x, ignore_invalid_camera_data);
     auto blue_team =
-        createTeamDetection({ssl_detection_frame}, TeamColour::BLUE, min_valid_x,
+        createTeamDetection(ssl_detection_frames, TeamColour::BLUE, min_valid_x,
                             max_valid_x, ignore_invalid_camera_data);
 
+    double latest_t_capture = 0;
+    for (const auto& ssl_detection_frame : ssl_detection_frames)
+    {
+        latest_t_capture = std::max(latest_t_capture, ssl_detection_frame.t_capture());
+    }
+
     if (defending_positive_side)
     {
         for (auto& detection : ball_detections)
@@ -263,15 +354,15 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame& ssl_detection
         }
     }
 
-    if (friendly_team_is_yellow)
     {
-        friendly_team = createFriendlyTeam(yellow_team);
-        enemy_team    = createEnemyTeam(blue_team);
+        TRACE_ZONE("SensorFusion: friendly team filter");
+        friendly_team.set(
+            createFriendlyTeam(friendly_team_is_yellow ? yellow_team : blue_team));
     }
-    else
     {
-        friendly_team = createFriendlyTeam(blue_team);
-        enemy_team    = createEnemyTeam(yellow_team);
+        TRACE_ZONE("SensorFusion: enemy team filter");
+        enemy_team.set(
+            createEnemyTeam(friendly_team_is_yellow ? blue_team : yellow_team));
     }
 
     ball_in_dribbler_timeout--;
@@ -286,7 +377,7 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame& ssl_detection
         // friendly_robot_id_with_ball_in_dribbler will always have a value since this is
         // checked by the member function shouldTrustRobotStatus
         std::optional<Robot> robot_with_ball_in_dribbler =
-            friendly_team.getRobotById(friendly_robot_id_with_ball_in_dribbler.value());
+            friendly_team->getRobotById(friendly_robot_id_with_ball_in_dribbler.value());
 
         std::vector<BallDetection> dribbler_in_ball_detection = {BallDetection{
             .position =
@@ -295,7 +386,7 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame& ssl_detection
                     .normalize(DIST_TO_FRONT_OF_ROBOT_METERS +
                                BALL_TO_FRONT_OF_ROBOT_DISTANCE_WHEN_DRIBBLING),
             .distance_from_ground = 0,
-            .timestamp  = Timestamp::fromSeconds(ssl_detection_frame.t_capture()),
+            .timestamp  = Timestamp::fromSeconds(latest_t_capture),
             .confidence = 1}};
 
         std::optional<Ball> new_ball = createBall(dribbler_in_ball_detection);
@@ -317,14 +408,14 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame& ssl_detection
         {
             // If we already have a ball from a previous frame, but is occluded this frame
             std::optional<Robot> closest_enemy =
-                enemy_team.getNearestRobot(ball->position());
+                enemy_team->getNearestRobot((*ball)->position());
 
             if (closest_enemy.has_value())
             {
-                ball = Ball(closest_enemy->position() +
-                                Vector::createFromAngle(closest_enemy->orientation())
-                                    .normalize(DIST_TO_FRONT_OF_ROBOT_METERS),
-                            Vector(0, 0), closest_enemy->timestamp());
+                ball->set(Ball(closest_enemy->position() +
+                                   Vector::createFromAngle(closest_enemy->orientation())
+                                       .normalize(DIST_TO_FRONT_OF_ROBOT_METERS),
+                               Vector(0, 0), closest_enemy->timestamp()));
             }
         }
 
@@ -334,18 +425,18 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame& ssl_detection
         ball_in_dribbler_timeout                = 0;
     }
 
-    if (ball && field)
+    if (ball && field && ball_control_estimator)
     {
-        possession = possession_tracker->getTeamWithPossession(friendly_team, enemy_team,
-                                                               *ball, *field);
-        updateDribbleDisplacement();
+        TRACE_ZONE("SensorFusion: possession tracker");
+        setBallControlEstimate(
+            ball_control_estimator->update(*friendly_team, *enemy_team, **ball, **field));
     }
 }
 
 void SensorFusion::updateBall(Ball new_ball)
 {
-    ball = new_ball;
-    game_state.updateBall(*ball);
+    game_state.update([&](GameState& state) { state.updateBall(new_ball); });
+    ball = Versioned<Ball>(new_ball);
 }
 
 std::optional<Ball> SensorFusion::createBall(
@@ -353,9 +444,12 @@ std::optional<Ball> SensorFusion::createBall(
 {
     if (field)
     {
-        std::optional<Ball> new_ball =
-            ball_filter.estimateBallState(ball_detections, field.value().fieldBoundary());
-        return new_ball;
+        TRACE_ZONE("SensorFusion: ball filter");
+        return sensor_fusion_config.use_ball_tracker()
+                   ? ball_tracker.estimateBallState(ball_detections,
+                                                    (*field)->fieldBoundary())
+                   : ball_filter.estimateBallState(ball_detections,
+                                                   (*field)->fieldBoundary());
     }
     return std::nullopt;
 }
@@ -363,76 +457,14 @@ std::optional<Ball> SensorFusion::createBall(
 Team SensorFusion::createFriendlyTeam(const std::vector<RobotDetection>& robot_detections)
 {
     Team new_friendly_team = friendly_team_filter.getFilteredData(
-        friendly_team, robot_detections, friendly_robot_id_with_ball_in_dribbler);
+        *friendly_team, robot_detections, friendly_robot_id_with_ball_in_dribbler);
     return new_friendly_team;
 }
 
-void SensorFusion::updateDribbleDisplacement()
-{
-    // Dribble distance algorithm taken from TIGERs autoref implementation
-    // https://t.ly/vNZf9
-
-    if (!ball.has_value())
-    {
-        return;
-    }
-
-    // Add new touching robots and remove non-touching robots
-    for (const Robot& robot : friendly_team.getAllRobots())
-    {
-        if (robot.isNearDribbler(ball->position(),
-                                 sensor_fusion_config.touching_ball_threshold_meters()))
-        {
-            // Insert only occurs if the map doesn't already contain a value
-            // with the key robot.id()
-            ball_contacts_by_friendly_robots.insert(
-                std::make_pair(robot.id(), ball->position()));
-        }
-        else
-        {
-            ball_contacts_by_friendly_robots.erase(robot.id());
-        }
-    }
-    // Remove touching robots that have vanished
-    for (const auto& [robot_id, contact_point] : ball_contacts_by_friendly_robots)
-    {
-        if (std::none_of(friendly_team.getAllRobots().begin(),
-                         friendly_team.getAllRobots().end(),
-                         [&](const Robot& robot) { return robot.id() == robot_id; }))
-        {
-            ball_contacts_by_friendly_robots.erase(robot_id);
-        }
-    }
-    // Compute displacements from initial contact points to current ball position
-    std::vector<Segment> dribble_displacements;
-    dribble_displacements.reserve(ball_contacts_by_friendly_robots.size());
-
-    std::transform(ball_contacts_by_friendly_robots.begin(),
-                   ball_contacts_by_friendly_robots.end(),
-                   std::back_inserter(dribble_displacements),
-                   [&](const auto& kv_pair)
-                   {
-                       const Point contact_point = kv_pair.second;
-                       return Segment(contact_point, ball->position());
-                   });
-
-    // Set dribble_displacement to the longest of dribble_displacements
-    if (dribble_displacements.empty())
-    {
-        dribble_displacement = std::nullopt;
-    }
-    else
-    {
-        dribble_displacement = *std::max_element(
-            dribble_displacements.begin(), dribble_displacements.end(),
-            [](const Segment& a, const Segment& b) { return a.length() < b.length(); });
-    }
-}
-
 Team SensorFusion::createEnemyTeam(const std::vector<RobotDetection>& robot_detections)
 {
     Team new_enemy_team =
-        enemy_team_filter.getFilteredData(enemy_team, robot_detections, false);
+        enemy_team_filter.getFilteredData(*enemy_team, robot_detections, false);
     return new_enemy_team;
 }
 
@@ -467,6 +499,12 @@ BallDetection SensorFusion::invert(BallDetection ball_detection) const
 {
     ball_detection.position =
         Point(-ball_detection.position.x(), -ball_detection.position.y());
+    if (ball_detection.camera)
+    {
+        ball_detection.camera->ground_position =
+            Point(-ball_detection.camera->ground_position.x(),
+                  -ball_detection.camera->ground_position.y());
+    }
     return ball_detection;
 }
 
@@ -508,18 +546,28 @@ void SensorFusion::resetWorldComponents()
 {
     field                = std::nullopt;
     ball                 = std::nullopt;
-    friendly_team        = Team();
-    enemy_team           = Team();
-    game_state           = GameState();
+    friendly_team        = Versioned<Team>();
+    enemy_team           = Versioned<Team>();
+    game_state           = Versioned<GameState>();
     referee_stage        = std::nullopt;
     ball_filter          = BallFilter();
+    ball_tracker         = BallTracker();
+    camera_positions.clear();
     friendly_team_filter = RobotTeamFilter();
     enemy_team_filter    = RobotTeamFilter();
     possession           = TeamPossession::FRIENDLY_TEAM;
     dribble_displacement = std::nullopt;
+    vision_frame_aggregator.reset();
 }
 
 void SensorFusion::setVirtualObstacles(TbotsProto::VirtualObstacles virtual_obstacles)
 {
-    virtual_obstacles_ = virtual_obstacles;
+    virtual_obstacles_.set(virtual_obstacles);
 }
+
+void SensorFusion::setBallControlEstimate(const BallControlEstimate& estimate)
+{
+    possession           = estimate.possession;
+    dribble_displacement = estimate.dribble_displacement;
+}
+
@@ -8,9 +8,12 @@
 #include "proto/parameters.pb.h"
 #include "proto/sensor_msg.pb.h"
 #include "software/sensor_fusion/filter/ball_filter.h"
+#include "software/sensor_fusion/filter/ball_tracker.h"
 #include "software/sensor_fusion/filter/robot_team_filter.h"
 #include "software/sensor_fusion/filter/vision_detection.h"
-#include "software/sensor_fusion/possession/possession_tracker.h"
+#include "software/sensor_fusion/possession/ball_control_estimator.h"
+#include "software/sensor_fusion/vision_frame_aggregator.h"
+#include "software/util/versioned/versioned.hpp"
 #include "software/world/ball.h"
 #include "software/world/team.h"
 #include "software/world/world.h"
@@ -26,8 +29,12 @@ class SensorFusion
      * Creates a SensorFusion with a sensor_fusion_config
      *
      * @param sensor_fusion_config The config to fetch parameters from
+     * @param estimate_ball_control Whether to estimate possession and dribble
+     * displacement whenever a capture window is applied. If false, the estimates are
+     * computed elsewhere and given to setBallControlEstimate.
      */
-    explicit SensorFusion(TbotsProto::SensorFusionConfig sensor_fusion_config);
+    explicit SensorFusion(TbotsProto::SensorFusionConfig sensor_fusion_config,
+                          bool estimate_ball_control = true);
 
     virtual ~SensorFusion() = default;
 
@@ -35,9 +42,16 @@ class SensorFusion
      * Processes a new SensorProto, which may update the latest representation of the
      * World
      *
-     * @param new data
+     * Detection frames are collected from every camera and only applied to the World
+     * once a capture window containing all the cameras is complete, see
+     * VisionFrameAggregator
+     *
+     * @param sensor_msg The new data. The SSL vision packet in it is moved into sensor
+     * fusion, so SensorProtos passed in as rvalues are never copied.
+     *
+     * @return whether the detections of a capture window were applied to the World
      */
-    void processSensorProto(const SensorProto& sensor_msg);
+    bool processSensorProto(SensorProto sensor_msg);
 
     /**
      * Returns the most up-to-date world if enough data has been received
@@ -55,6 +69,13 @@ class SensorFusion
      */
     void setVirtualObstacles(TbotsProto::VirtualObstacles virtual_obstacles);
 
+    /**
+     * Sets the possession and dribble displacement of the Worlds created from now on
+     *
+     * @param estimate The estimate, computed from an earlier World
+     */
+    void setBallControlEstimate(const BallControlEstimate& estimate);
+
     // Number of vision packets to indicate that the vision client most likely reset,
     // determined experimentally with the simulator
     static constexpr unsigned int VISION_PACKET_RESET_COUNT_THRESHOLD = 5;
@@ -73,13 +94,16 @@ class SensorFusion
      * Updates relevant components of world based on a new data
      *
      * @param new data
+     *
+     * @return whether the detections of a capture window were applied to the World
      */
-    void updateWorld(const SSLProto::SSL_WrapperPacket& packet);
+    bool updateWorld(SSLProto::SSL_WrapperPacket packet);
     void updateWorld(const SSLProto::Referee& packet);
     void updateWorld(const google::protobuf::RepeatedPtrField<TbotsProto::RobotStatus>&
                          robot_status_msgs);
     void updateWorld(const SSLProto::SSL_GeometryData& geometry_packet);
-    void updateWorld(const SSLProto::SSL_DetectionFrame& ssl_detection_frame);
+    void updateWorld(
+        const std::vector<SSLProto::SSL_DetectionFrame>& ssl_detection_frames);
 
     /**
      * Updates relevant components with a new ball
@@ -89,7 +113,8 @@ class SensorFusion
     void updateBall(Ball new_ball);
 
     /**
-     * Create state of the ball from a list of ball detections
+     * Create state of the ball from a list of ball detections, using the BallTracker
+     * if it is enabled in the config and the BallFilter otherwise
      *
      * @param ball_detections list of ball detections to filter
      *
@@ -128,12 +153,6 @@ class SensorFusion
     RobotDetection invert(RobotDetection robot_detection) const;
     BallDetection invert(BallDetection ball_detection) const;
 
-    /**
-     * Updates the segment representing the displacement of the ball due to
-     * the friendly team continuously dribbling the ball across the field.
-     */
-    void updateDribbleDisplacement();
-
     /**
      * Checks for a vision reset and if there is one, then reset SensorFusion
      *
@@ -167,15 +186,15 @@ class SensorFusion
      */
     bool shouldTrustRobotStatus();
     TbotsProto::SensorFusionConfig sensor_fusion_config;
-    std::optional<Field> field;
-    std::optional<Ball> ball;
-    Team friendly_team;
-    Team enemy_team;
-    GameState game_state;
+    // The field, ball, teams, game state and virtual obstacles are shared with the
+    // Worlds created from them until they change
+    std::optional<Versioned<Field>> field;
+    std::optional<Versioned<Ball>> ball;
+    Versioned<Team> friendly_team;
+    Versioned<Team> enemy_team;
+    Versioned<GameState> game_state;
     std::optional<RefereeStage> referee_stage;
 
-    // Points on the field where a friendly bot initially touched the ball
-    std::map<RobotId, Point> ball_contacts_by_friendly_robots;
     // Segment representing the displacement of the ball (in metres) due to
     // the friendly team continuously dribbling the ball across the field.
     //
@@ -191,12 +210,20 @@ class SensorFusion
     std::optional<Segment> dribble_displacement;
 
 
+    // The position of each camera, from the calibrations in the latest geometry packet
+    // that had any
+    std::map<unsigned int, CameraPosition> camera_positions;
+
+    VisionFrameAggregator vision_frame_aggregator;
     BallFilter ball_filter;
+    BallTracker ball_tracker;
     RobotTeamFilter friendly_team_filter;
     RobotTeamFilter enemy_team_filter;
 
     TeamPossession possession;
-    std::shared_ptr<PossessionTracker> possession_tracker;
+    // Estimates the possession and dribble displacement, unless they are estimated
+    // outside of sensor fusion
+    std::optional<BallControlEstimator> ball_control_estimator;
 
     std::optional<RobotId> friendly_robot_id_with_ball_in_dribbler;
 
@@ -213,5 +240,5 @@ class SensorFusion
     // The timestamp, in seconds, of the most recently received vision packet
     double last_t_capture;
 
-    TbotsProto::VirtualObstacles virtual_obstacles_;
+    Versioned<TbotsProto::VirtualObstacles> virtual_obstacles_;
 };
@@ -0,0 +1,400 @@
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+
+#include "proto/message_translation/ssl_detection.h"
+#include "proto/message_translation/ssl_geometry.h"
+#include "proto/message_translation/ssl_wrapper.h"
+#include "proto/sensor_msg.pb.h"
+#include "proto/ssl_vision_wrapper.pb.h"
+#include "software/logger/replay_reader.h"
+#include "software/sensor_fusion/sensor_fusion.h"
+#include "software/tracing/trace_exporter.h"
+#include "software/tracing/tracer.h"
+
+/**
+ * Measures how fast SensorFusion processes SensorProtos, to catch regressions in the
+ * sensor fusion filters.
+ *
+ * The SensorProtos and SSL_WrapperPackets in a log recorded by the ProtoLogger are fed
+ * through SensorFusion as fast as possible. If no log is given, a match with a rolling
+ * ball and two full teams seen by four cameras is fed through instead. The throughput,
+ * the distribution of how long each stage of sensor fusion takes, and how many memory
+ * allocations sensor fusion makes are reported.
+ *
+ * The stages of sensor fusion are measured from the zones it traces, so tracing is
+ * started for the whole benchmark.
+ */
+
+namespace
+{
+    // The number of memory allocations made by this thread so far. Only the thread
+    // running sensor fusion is counted, so allocations made by the tracer's drain
+    // thread aren't blamed on sensor fusion.
+    thread_local size_t num_allocations = 0;
+}  // namespace
+
+// Replacing the global operator new lets the benchmark count every allocation. The
+// replacements aren't inlined so the compiler doesn't see malloc paired with delete.
+[[gnu::noinline]] void* operator new(std::size_t size)
+{
+    num_allocations++;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void* ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+namespace
+{
+    /**
+     * A distribution of how long something took
+     */
+    class LatencyDistribution
+    {
+       public:
+        /**
+         * Adds a sample to the distribution
+         *
+         * @param duration How long it took
+         */
+        void add(const Duration& duration)
+        {
+            samples_us.push_back(duration.toMilliseconds() * 1000);
+        }
+
+        /**
+         * Prints the mean, 50th, 99th percentile and maximum of the distribution
+         *
+         * @param name The name of what was measured
+         */
+        void print(const std::string& name)
+        {
+            if (samples_us.empty())
+            {
+                std::cout << std::setw(36) << name << "  no samples" << std::endl;
+                return;
+            }
+
+            std::sort(samples_us.begin(), samples_us.end());
+            double mean_us = 0;
+            for (double sample_us : samples_us)
+            {
+                mean_us += sample_us / static_cast<double>(samples_us.size());
+            }
+            std::cout << std::setw(36) << name << std::fixed << std::setprecision(2)
+                      << "  mean " << std::setw(9) << mean_us << " us"
+                      << "  p50 " << std::setw(9) << percentile(0.5) << " us"
+                      << "  p99 " << std::setw(9) << percentile(0.99) << " us"
+                      << "  max " << std::setw(9) << samples_us.back() << " us"
+                      << std::endl;
+        }
+
+       private:
+        double percentile(double fraction) const
+        {
+            return samples_us[static_cast<size_t>(
+                fraction * static_cast<double>(samples_us.size() - 1))];
+        }
+
+        std::vector<double> samples_us;
+    };
+
+    /**
+     * Collects how long each traced zone took into a distribution per zone name
+     */
+    class ZoneLatencyExporter : public TraceExporter
+    {
+       public:
+        /**
+         * Creates a ZoneLatencyExporter
+         *
+         * @param zone_latencies The distributions to add the zone durations to, keyed
+         * by zone name. Must outlive tracing, and must only be read once tracing stops.
+         */
+        explicit ZoneLatencyExporter(
+            std::map<std::string, LatencyDistribution>& zone_latencies)
+            : zone_latencies(zone_latencies)
+        {
+        }
+
+        void exportEvents(const std::vector<TraceEvent>& events) override
+        {
+            for (const TraceEvent& event : events)
+            {
+                std::optional<double> duration_ms = zone_timer.update(event);
+                if (duration_ms)
+                {
+                    zone_latencies[event.name].add(
+                        Duration::fromMilliseconds(*duration_ms));
+                }
+            }
+        }
+
+       private:
+        std::map<std::string, LatencyDistribution>& zone_latencies;
+        TraceZoneTimer zone_timer;
+    };
+
+    /**
+     * Reads the SensorProtos in a replay log. SSL_WrapperPackets that were logged on
+     * their own are wrapped in a SensorProto, the way the backend would send them to
+     * sensor fusion.
+     *
+     * @param replay_folder The folder the ProtoLogger wrote the log to
+     *
+     * @return the SensorProtos, in the order they were logged
+     */
+    std::vector<SensorProto> readReplaySensorProtos(const std::string& replay_folder)
+    {
+        const std::string sensor_proto_type = SensorProto::descriptor()->full_name();
+        const std::string wrapper_packet_type =
+            SSLProto::SSL_WrapperPacket::descriptor()->full_name();
+
+        std::vector<SensorProto> sensor_protos;
+        ReplayReader reader(replay_folder);
+        while (std::optional<ReplayEntry> entry = reader.nextEntry())
+        {
+            SensorProto sensor_proto;
+            if (entry->protobuf_type_full_name == sensor_proto_type)
+            {
+                if (!sensor_proto.ParseFromString(entry->serialized_proto))
+                {
+                    continue;
+                }
+            }
+            else if (entry->protobuf_type_full_name == wrapper_packet_type)
+            {
+                if (!sensor_proto.mutable_ssl_vision_msg()->ParseFromString(
+                        entry->serialized_proto))
+                {
+                    continue;
+                }
+            }
+            else
+            {
+                continue;
+            }
+            sensor_protos.push_back(std::move(sensor_proto));
+        }
+        return sensor_protos;
+    }
+
+    /**
+     * Creates the SensorProtos of a match in which both teams drive in circles around
+     * a rolling ball, seen by four cameras at 60Hz that each cover a quarter of the
+     * field
+     *
+     * @param num_capture_windows The number of times every camera sees the field
+     *
+     * @return the SensorProtos, one per camera frame
+     */
+    std::vector<SensorProto> createSyntheticSensorProtos(unsigned int num_capture_windows)
+    {
+        static constexpr unsigned int NUM_CAMERAS         = 4;
+        static constexpr unsigned int NUM_ROBOTS_PER_TEAM = 11;
+        const Field field = Field::createSSLDivisionAField();
+
+        std::vector<SensorProto> sensor_protos;
+        for (unsigned int i = 0; i < num_capture_windows; i++)
+        {
+            double t            = i / 60.0;
+            Timestamp timestamp = Timestamp::fromSeconds(t);
+
+            // Each camera sees the quarter of the field on its side of both axes
+            auto camera_id = [](const Point& position) -> uint32_t
+            { return (position.x() < 0 ? 0 : 1) + (position.y() < 0 ? 0 : 2); };
+
+            std::array<std::vector<BallState>, NUM_CAMERAS> balls;
+            std::array<std::vector<RobotStateWithId>, NUM_CAMERAS> yellow_robots;
+            std::array<std::vector<RobotStateWithId>, NUM_CAMERAS> blue_robots;
+
+            Point ball_position(3 * std::cos(t / 2), 2 * std::sin(t / 2));
+            Vector ball_velocity(-1.5 * std::sin(t / 2), std::cos(t / 2));
+            balls[camera_id(ball_position)].push_back(
+                BallState(ball_position, ball_velocity));
+
+            for (unsigned int id = 0; id < NUM_ROBOTS_PER_TEAM; id++)
+            {
+                for (auto* robots : {&yellow_robots, &blue_robots})
+                {
+                    double side  = robots == &yellow_robots ? -1 : 1;
+                    double angle = t + id * 2 * M_PI / NUM_ROBOTS_PER_TEAM;
+                    Point position(side * (2.5 + std::cos(angle)), 2 * std::sin(angle));
+                    (*robots)[camera_id(position)].push_back(RobotStateWithId{
+                        .id          = id,
+                        .robot_state = RobotState(position, Vector(-std::sin(angle),
+                                                                   std::cos(angle)),
+                                                  Angle::fromRadians(angle),
+                                                  AngularVelocity::zero())});
+                }
+            }
+
+            for (uint32_t camera = 0; camera < NUM_CAMERAS; camera++)
+            {
+                std::unique_ptr<SSLProto::SSL_GeometryData> geometry;
+                if (i % 60 == 0 && camera == 0)
+                {
+                    geometry = createGeometryData(field, 0.01f);
+                }
+
+                SensorProto sensor_proto;
+                *sensor_proto.mutable_ssl_vision_msg() = *createSSLWrapperPacket(
+                    std::move(geometry),
+                    createSSLDetectionFrame(camera, timestamp, i, balls[camera],
+                                            yellow_robots[camera], blue_robots[camera]));
+                sensor_protos.push_back(std::move(sensor_proto));
+            }
+        }
+        return sensor_protos;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    struct CommandLineArgs
+    {
+        bool help                 = false;
+        std::string replay_folder = "";
+        unsigned int repetitions  = 1;
+    };
+
+    CommandLineArgs args;
+    boost::program_options::options_description desc{"Options"};
+    desc.add_options()("help,h", boost::program_options::bool_switch(&args.help),
+                       "Help screen");
+    desc.add_options()("replay_folder",
+                       boost::program_options::value<std::string>(&args.replay_folder),
+                       "The folder of a replay log with SensorProtos or "
+                       "SSL_WrapperPackets. If not given, a synthetic match is fed "
+                       "through sensor fusion instead.");
+    desc.add_options()("repetitions",
+                       boost::program_options::value<unsigned int>(&args.repetitions),
+                       "The number of times to feed the log through sensor fusion.");
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (args.help)
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    const std::vector<SensorProto> sensor_protos =
+        args.replay_folder.empty() ? createSyntheticSensorProtos(36000)
+                                   : readReplaySensorProtos(args.replay_folder);
+    if (sensor_protos.empty())
+    {
+        std::cerr << "No SensorProtos to replay" << std::endl;
+        return 1;
+    }
+
+    LatencyDistribution process_sensor_proto_latency;
+    LatencyDistribution get_world_latency;
+    std::map<std::string, LatencyDistribution> zone_latencies;
+
+    std::vector<std::unique_ptr<TraceExporter>> exporters;
+    exporters.push_back(std::make_unique<ZoneLatencyExporter>(zone_latencies));
+    Tracer::start(std::move(exporters));
+
+    size_t num_capture_windows                  = 0;
+    size_t num_process_sensor_proto_allocations = 0;
+    size_t num_get_world_allocations            = 0;
+    Duration total_duration;
+
+    for (unsigned int repetition = 0; repetition < args.repetitions; repetition++)
+    {
+        // Start over with a new SensorFusion so timestamps keep increasing
+        SensorFusion sensor_fusion(TbotsProto::SensorFusionConfig{});
+        for (const SensorProto& sensor_proto : sensor_protos)
+        {
+            // SensorFusion takes ownership of the SensorProtos it processes, like it
+            // does in ThreadedSensorFusion, so it is given a copy made before timing
+            SensorProto sensor_proto_copy = sensor_proto;
+
+            size_t allocations_before = num_allocations;
+            auto start                = std::chrono::steady_clock::now();
+            bool capture_window_applied =
+                sensor_fusion.processSensorProto(std::move(sensor_proto_copy));
+            auto end = std::chrono::steady_clock::now();
+            num_process_sensor_proto_allocations += num_allocations - allocations_before;
+
+            Duration duration = Duration::fromSeconds(
+                std::chrono::duration<double>(end - start).count());
+            total_duration += duration;
+            process_sensor_proto_latency.add(duration);
+
+            if (!capture_window_applied)
+            {
+                continue;
+            }
+            num_capture_windows++;
+
+            allocations_before         = num_allocations;
+            start                      = std::chrono::steady_clock::now();
+            std::optional<World> world = sensor_fusion.getWorld();
+            end                        = std::chrono::steady_clock::now();
+            num_get_world_allocations += num_allocations - allocations_before;
+
+            duration = Duration::fromSeconds(
+                std::chrono::duration<double>(end - start).count());
+            total_duration += duration;
+            get_world_latency.add(duration);
+        }
+    }
+
+    // Stopping exports every zone traced so far
+    Tracer::stop();
+
+    size_t num_sensor_protos = sensor_protos.size() * args.repetitions;
+    std::cout << "SensorProtos: " << num_sensor_protos << std::endl
+              << "Capture windows applied: " << num_capture_windows << std::endl
+              << "SensorProtos/s: " << num_sensor_protos / total_duration.toSeconds()
+              << std::endl
+              << "Capture windows/s: "
+              << num_capture_windows / total_duration.toSeconds() << std::endl
+              << std::endl;
+
+    process_sensor_proto_latency.print("processSensorProto");
+    for (auto& [zone_name, zone_latency] : zone_latencies)
+    {
+        zone_latency.print(zone_name);
+    }
+    get_world_latency.print("getWorld");
+    if (Tracer::numDroppedEvents() > 0)
+    {
+        std::cout << "Traced events dropped: " << Tracer::numDroppedEvents()
+                  << std::endl;
+    }
+
+    std::cout << std::endl
+              << "Allocations per processSensorProto: "
+              << static_cast<double>(num_process_sensor_proto_allocations) /
+                     static_cast<double>(num_sensor_protos)
+              << std::endl
+              << "Allocations per getWorld: "
+              << static_cast<double>(num_get_world_allocations) /
+                     static_cast<double>(std::max<size_t>(num_capture_windows, 1))
+              << std::endl;
+
+    return 0;
+}
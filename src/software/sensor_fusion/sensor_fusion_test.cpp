@@ -496,6 +496,91 @@ TEST_F(SensorFusionTest, test_complete_wrapper_packet)
     EXPECT_EQ(initWorld(), result);
 }
 
+TEST_F(SensorFusionTest, test_detection_frames_from_all_cameras_are_fused)
+{
+    // Camera 0 sees the ball, the yellow team and one blue robot, and camera 1 sees
+    // the rest of the blue team
+    std::vector<RobotStateWithId> camera_0_blue_robot_states = {blue_robot_states[0]};
+    std::vector<RobotStateWithId> camera_1_blue_robot_states = {blue_robot_states[1],
+                                                                blue_robot_states[2]};
+    Timestamp t_capture = current_time;
+    auto process_frame  = [&](uint32_t camera_id, const Timestamp& frame_t_capture)
+    {
+        std::unique_ptr<SSLProto::SSL_DetectionFrame> frame;
+        if (camera_id == 0)
+        {
+            frame = createSSLDetectionFrame(camera_id, frame_t_capture, 0, {ball_state},
+                                            yellow_robot_states,
+                                            camera_0_blue_robot_states);
+        }
+        else
+        {
+            frame = createSSLDetectionFrame(camera_id, frame_t_capture, 0, {}, {},
+                                            camera_1_blue_robot_states);
+        }
+        SensorProto sensor_msg;
+        *(sensor_msg.mutable_ssl_vision_msg()) =
+            *createSSLWrapperPacket(initSSLDivBGeomData(), std::move(frame));
+        return sensor_fusion.processSensorProto(sensor_msg);
+    };
+
+    // Sensor fusion doesn't know about camera 1 until the first vision period, so
+    // camera 1's first frame is applied once the next vision period starts
+    EXPECT_TRUE(process_frame(0, t_capture));
+    EXPECT_FALSE(process_frame(1, t_capture + Duration::fromMilliseconds(1)));
+    t_capture = t_capture + Duration::fromMilliseconds(16);
+    EXPECT_TRUE(process_frame(0, t_capture));
+    EXPECT_TRUE(process_frame(1, t_capture + Duration::fromMilliseconds(1)));
+
+    // From then on, the detections of both cameras are applied together once per
+    // vision period
+    for (int i = 0; i < 5; i++)
+    {
+        t_capture = t_capture + Duration::fromMilliseconds(16);
+        EXPECT_FALSE(process_frame(1, t_capture));
+        EXPECT_TRUE(process_frame(0, t_capture + Duration::fromMilliseconds(1)));
+
+        std::optional<World> world = sensor_fusion.getWorld();
+        ASSERT_TRUE(world);
+        EXPECT_EQ(2, world->friendlyTeam().numRobots());
+        EXPECT_EQ(3, world->enemyTeam().numRobots());
+    }
+}
+
+TEST_F(SensorFusionTest, ball_tracker_estimates_ball_when_enabled)
+{
+    config.set_use_ball_tracker(true);
+    sensor_fusion = SensorFusion(config);
+
+    // Camera 0 hangs 4m above the centre of the field
+    SSLProto::SSL_GeometryCameraCalibration* calibration = geom_data->add_calib();
+    calibration->set_camera_id(0);
+    calibration->set_focal_length(0);
+    calibration->set_principal_point_x(0);
+    calibration->set_principal_point_y(0);
+    calibration->set_distortion(0);
+    calibration->set_q0(0);
+    calibration->set_q1(0);
+    calibration->set_q2(0);
+    calibration->set_q3(0);
+    calibration->set_tx(0);
+    calibration->set_ty(0);
+    calibration->set_tz(0);
+    calibration->set_derived_camera_world_tx(0);
+    calibration->set_derived_camera_world_ty(0);
+    calibration->set_derived_camera_world_tz(4000);
+
+    SensorProto sensor_msg;
+    *(sensor_msg.mutable_ssl_vision_msg()) =
+        *createSSLWrapperPacket(std::move(geom_data), initDetectionFrame());
+    sensor_fusion.processSensorProto(sensor_msg);
+
+    std::optional<World> world = sensor_fusion.getWorld();
+    ASSERT_TRUE(world);
+    EXPECT_LT((initWorld().ball().position() - world->ball().position()).length(), 1e-6);
+    EXPECT_FALSE(world->ball().isChipped());
+}
+
 TEST_F(SensorFusionTest, test_robot_status_msg_packet)
 {
     SensorProto sensor_msg;
@@ -860,7 +945,8 @@ TEST_F(SensorFusionTest, test_sensor_fusion_reset_behaviour_ignore_bad_packets)
     sensor_fusion.processSensorProto(sensor_msg_future);
     ASSERT_TRUE(sensor_fusion.getWorld());
     result = *sensor_fusion.getWorld();
-    EXPECT_NE(initWorld(), result);
+    // Nothing on the field moved, so the world is only updated with the new time
+    EXPECT_EQ(current_time + Duration::fromSeconds(1), result.ball().timestamp());
     for (unsigned int i = 0; i < SensorFusion::VISION_PACKET_RESET_COUNT_THRESHOLD; i++)
     {
         sensor_fusion.processSensorProto(sensor_msg_0);
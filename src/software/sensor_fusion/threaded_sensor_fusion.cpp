@@ -2,45 +2,142 @@
 
 #include <google/protobuf/util/message_differencer.h>
 
+#include <Tracy.hpp>
+#include <chrono>
+#include <utility>
+
+#include "proto/message_translation/tbots_protobuf.h"
+#include "software/tracing/tracer.h"
+#include "software/tracy/tracy_constants.h"
+
 ThreadedSensorFusion::ThreadedSensorFusion(
     TbotsProto::SensorFusionConfig sensor_fusion_config)
     : FirstInFirstOutThreadedObserver<SensorProto>(DIFFERENT_GRSIM_FRAMES_RECEIVED),
-      sensor_fusion(sensor_fusion_config)
+      sensor_fusion(sensor_fusion_config, false),
+      sensor_fusion_config(sensor_fusion_config),
+      capture_window_received_time(0.0),
+      deferred_path(sensor_fusion_config)
 {
 }
 
 void ThreadedSensorFusion::onValueReceived(TbotsProto::ThunderbotsConfig config)
 {
-    std::scoped_lock lock(sensor_fusion_mutex);
-
     // If we received a new SensorFusion, restart sensor fusion
-    // with the new config
-    if (!google::protobuf::util::MessageDifferencer::Equivalent(
+    // with the new config. Only this thread reads sensor_fusion_config, and the new
+    // SensorFusion is created before locking so vision updates are only blocked for
+    // the swap.
+    if (google::protobuf::util::MessageDifferencer::Equivalent(
             config.sensor_fusion_config(), sensor_fusion_config))
     {
-        sensor_fusion = SensorFusion(config.sensor_fusion_config());
+        return;
     }
+
+    sensor_fusion_config = config.sensor_fusion_config();
+    SensorFusion new_sensor_fusion(sensor_fusion_config, false);
+    deferred_path.reset(sensor_fusion_config);
+
+    std::scoped_lock lock(sensor_fusion_mutex);
+    sensor_fusion = std::move(new_sensor_fusion);
 }
 
 void ThreadedSensorFusion::onValueReceived(SensorProto sensor_msg)
 {
-    std::scoped_lock lock(sensor_fusion_mutex);
-    sensor_fusion.processSensorProto(sensor_msg);
+    ZoneScopedN("SensorFusion: fast path");
+    TRACE_ZONE("SensorFusion: fast path");
+    auto start = std::chrono::steady_clock::now();
 
-    // Limit sensor fusion to only send out worlds on ssl wrapper packets
-    // to prevent spamming worlds every time a referee msg or robot status
-    // msg comes through.
-    if (sensor_msg.has_ssl_vision_msg())
+    std::optional<World> world;
     {
-        std::optional<World> world = sensor_fusion.getWorld();
-        if (world)
+        std::scoped_lock lock(sensor_fusion_mutex);
+        if (sensor_msg.has_ssl_vision_msg() && capture_window_received_time == 0.0)
         {
-            Subject<World>::sendValueToObservers(world.value());
+            capture_window_received_time =
+                sensor_msg.backend_received_time().epoch_timestamp_seconds();
         }
+
+        bool vision_window_applied =
+            sensor_fusion.processSensorProto(std::move(sensor_msg));
+
+        // Limit sensor fusion to only send out worlds once the detections from every
+        // camera for a capture window have been applied, to prevent spamming worlds
+        // every time a single camera frame, referee msg or robot status msg comes
+        // through.
+        if (vision_window_applied)
+        {
+            std::optional<BallControlEstimate> estimate =
+                deferred_path.takeLatestEstimate();
+            if (estimate)
+            {
+                sensor_fusion.setBallControlEstimate(*estimate);
+            }
+            world = sensor_fusion.getWorld();
+
+            // There's no World until sensor fusion has a field and a ball
+            if (world)
+            {
+                TbotsProto::PipelineLatencyTrace latency_trace;
+                latency_trace.set_sensor_received_time(capture_window_received_time);
+                latency_trace.set_sensor_fusion_done_time(getCurrentEpochTimeSeconds());
+                world->setLatencyTrace(latency_trace);
+            }
+            capture_window_received_time = 0.0;
+        }
+    }
+
+    if (world)
+    {
+        deferred_path.receiveValue(*world);
+        Subject<World>::sendValueToObservers(std::move(*world));
+
+        const double publish_latency_ms =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count() /
+            1000.0;
+        TracyPlot(TracyConstants::SENSOR_FUSION_PUBLISH_LATENCY_PLOT, publish_latency_ms);
+        TRACE_VALUE(TracyConstants::SENSOR_FUSION_PUBLISH_LATENCY_PLOT,
+                    publish_latency_ms);
     }
 }
 
 void ThreadedSensorFusion::onValueReceived(TbotsProto::VirtualObstacles virtual_obstacles)
 {
+    std::scoped_lock lock(sensor_fusion_mutex);
     sensor_fusion.setVirtualObstacles(virtual_obstacles);
 }
+
+ThreadedSensorFusion::DeferredPath::DeferredPath(
+    const TbotsProto::SensorFusionConfig& config)
+    : LastInFirstOutThreadedObserver<World>(1, false),
+      estimator(config),
+      latest_estimate()
+{
+}
+
+void ThreadedSensorFusion::DeferredPath::reset(
+    const TbotsProto::SensorFusionConfig& config)
+{
+    std::scoped_lock lock(estimator_mutex, latest_estimate_mutex);
+    estimator       = BallControlEstimator(config);
+    latest_estimate = std::nullopt;
+}
+
+std::optional<BallControlEstimate>
+ThreadedSensorFusion::DeferredPath::takeLatestEstimate()
+{
+    std::scoped_lock lock(latest_estimate_mutex);
+    return std::exchange(latest_estimate, std::nullopt);
+}
+
+void ThreadedSensorFusion::DeferredPath::onValueReceived(World world)
+{
+    ZoneScopedN("SensorFusion: deferred path");
+    TRACE_ZONE("SensorFusion: deferred path");
+
+    std::scoped_lock estimator_lock(estimator_mutex);
+    BallControlEstimate estimate = estimator.update(
+        world.friendlyTeam(), world.enemyTeam(), world.ball(), world.field());
+
+    std::scoped_lock latest_estimate_lock(latest_estimate_mutex);
+    latest_estimate = estimate;
+}
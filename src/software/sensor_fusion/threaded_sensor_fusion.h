@@ -1,12 +1,27 @@
 #pragma once
 
+#include <mutex>
+
 #include "proto/parameters.pb.h"
 #include "proto/sensor_msg.pb.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
+#include "software/multithreading/last_in_first_out_threaded_observer.h"
 #include "software/multithreading/subject.hpp"
+#include "software/sensor_fusion/possession/ball_control_estimator.h"
 #include "software/sensor_fusion/sensor_fusion.h"
 #include "software/world/world.h"
 
+/**
+ * Runs sensor fusion on its own threads and publishes the Worlds it creates.
+ *
+ * Sensor fusion is split into two paths so that publishing a World never waits for
+ * anything but the filters:
+ * - The fast path runs the filters on every SensorProto and publishes the World once
+ *   a capture window has been applied
+ * - The deferred path estimates possession and dribble displacement from the most
+ *   recently published World on a separate thread. Its estimates are applied to the
+ *   next World the fast path publishes.
+ */
 class ThreadedSensorFusion
     : public Subject<World>,
       public FirstInFirstOutThreadedObserver<SensorProto>,
@@ -19,6 +34,45 @@ class ThreadedSensorFusion
     virtual ~ThreadedSensorFusion() = default;
 
    private:
+    /**
+     * The deferred path of sensor fusion. Only the most recent World is estimated
+     * from, so the deferred path never falls behind the fast path.
+     */
+    class DeferredPath : public LastInFirstOutThreadedObserver<World>
+    {
+       public:
+        /**
+         * Creates a DeferredPath
+         *
+         * @param config The config to fetch parameters from
+         */
+        explicit DeferredPath(const TbotsProto::SensorFusionConfig& config);
+
+        /**
+         * Discards everything estimated so far and starts over with a new config
+         *
+         * @param config The config to fetch parameters from
+         */
+        void reset(const TbotsProto::SensorFusionConfig& config);
+
+        /**
+         * Returns the estimate made since this function was last called
+         *
+         * @return the newest estimate, or std::nullopt if nothing new was estimated
+         */
+        std::optional<BallControlEstimate> takeLatestEstimate();
+
+       private:
+        void onValueReceived(World world) override;
+
+        // The estimator is only locked by the deferred path and config updates, so the
+        // fast path never waits for an estimate to finish
+        std::mutex estimator_mutex;
+        BallControlEstimator estimator;
+        std::mutex latest_estimate_mutex;
+        std::optional<BallControlEstimate> latest_estimate;
+    };
+
     void onValueReceived(SensorProto sensor_msg) override;
     void onValueReceived(TbotsProto::ThunderbotsConfig config) override;
     void onValueReceived(TbotsProto::VirtualObstacles virtual_obstacles) override;
@@ -26,5 +80,11 @@ class ThreadedSensorFusion
     SensorFusion sensor_fusion;
     TbotsProto::SensorFusionConfig sensor_fusion_config;
     static constexpr size_t DIFFERENT_GRSIM_FRAMES_RECEIVED = 4;
+    // Only guards sensor_fusion and capture_window_received_time, and is never held
+    // while Worlds are published
     std::mutex sensor_fusion_mutex;
+    // When the backend received the first vision packet of the capture window being
+    // applied, in seconds since Unix epoch, or 0 if none has been received yet
+    double capture_window_received_time;
+    DeferredPath deferred_path;
 };
@@ -0,0 +1,77 @@
+#include "software/sensor_fusion/vision_frame_aggregator.h"
+
+#include <cmath>
+
+VisionFrameAggregator::VisionFrameAggregator(const Duration& capture_window)
+    : capture_window_seconds(capture_window.toSeconds()),
+      camera_last_seen_windows(),
+      window_frames(),
+      window_start_seconds(0),
+      num_windows_closed(0)
+{
+}
+
+std::vector<VisionFrameAggregator::CaptureWindow> VisionFrameAggregator::addFrame(
+    SSLProto::SSL_DetectionFrame frame)
+{
+    const unsigned int camera_id = frame.camera_id();
+    camera_last_seen_windows[camera_id] = num_windows_closed;
+
+    std::vector<CaptureWindow> closed_windows;
+    bool frame_joins_window =
+        !window_frames.contains(camera_id) &&
+        std::abs(frame.t_capture() - window_start_seconds) < capture_window_seconds;
+    if (!window_frames.empty() && !frame_joins_window)
+    {
+        closed_windows.emplace_back(closeWindow());
+    }
+
+    if (window_frames.empty())
+    {
+        window_start_seconds = frame.t_capture();
+    }
+    window_frames.emplace(camera_id, std::move(frame));
+
+    if (allActiveCamerasInWindow())
+    {
+        closed_windows.emplace_back(closeWindow());
+    }
+
+    return closed_windows;
+}
+
+void VisionFrameAggregator::reset()
+{
+    camera_last_seen_windows.clear();
+    window_frames.clear();
+    window_start_seconds = 0;
+    num_windows_closed   = 0;
+}
+
+VisionFrameAggregator::CaptureWindow VisionFrameAggregator::closeWindow()
+{
+    CaptureWindow frames;
+    frames.reserve(window_frames.size());
+    for (auto& [camera_id, frame] : window_frames)
+    {
+        frames.emplace_back(std::move(frame));
+    }
+    window_frames.clear();
+    num_windows_closed++;
+
+    return frames;
+}
+
+bool VisionFrameAggregator::allActiveCamerasInWindow() const
+{
+    for (const auto& [camera_id, last_seen_window] : camera_last_seen_windows)
+    {
+        bool camera_active =
+            num_windows_closed - last_seen_window <= CAMERA_TIMEOUT_WINDOWS;
+        if (camera_active && !window_frames.contains(camera_id))
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "proto/ssl_vision_detection.pb.h"
+#include "software/time/duration.h"
+
+/**
+ * Collects the detection frames from every SSL-Vision camera into capture windows, so
+ * that sensor fusion can update the world once per vision period with a view of the
+ * whole field instead of once per camera with a partial view.
+ *
+ * A capture window starts with the first frame received after the previous window
+ * was closed. Frames from other cameras captured within the window duration of it
+ * join the window. The window is closed as soon as every active camera has
+ * contributed a frame, or when a frame arrives that cannot join it (because its camera
+ * is already in the window or it was captured outside the window).
+ *
+ * SSL-Vision cameras aren't synchronized, so the frames in a window can be captured up
+ * to the window duration apart. Frames are handed back to sensor fusion with the
+ * capture times their cameras reported, so the filters see when each detection was
+ * actually made.
+ */
+class VisionFrameAggregator
+{
+   public:
+    // The frames from each camera in a capture window
+    using CaptureWindow = std::vector<SSLProto::SSL_DetectionFrame>;
+
+    // The default maximum difference between the capture times of frames in the same
+    // window. This is shorter than the period of SSL-Vision, so frames from consecutive
+    // vision periods are never grouped together.
+    static constexpr double DEFAULT_CAPTURE_WINDOW_SECONDS = 0.008;
+
+    // The number of windows a camera may be missing from before we stop waiting for
+    // it to close a window
+    static constexpr unsigned int CAMERA_TIMEOUT_WINDOWS = 30;
+
+    /**
+     * Creates a VisionFrameAggregator
+     *
+     * @param capture_window The maximum difference between the capture times of the
+     * frames in a window
+     */
+    explicit VisionFrameAggregator(
+        const Duration& capture_window =
+            Duration::fromSeconds(DEFAULT_CAPTURE_WINDOW_SECONDS));
+
+    /**
+     * Adds a detection frame from a camera
+     *
+     * @param frame The detection frame to add. It is moved into the window, so frames
+     * passed in as rvalues are never copied.
+     *
+     * @return the windows closed by adding the frame, oldest first. This is usually
+     * empty or a single window, but the frame can close the previous window and then
+     * complete its own.
+     */
+    std::vector<CaptureWindow> addFrame(SSLProto::SSL_DetectionFrame frame);
+
+    /**
+     * Discards the open window and everything learned about the cameras
+     */
+    void reset();
+
+   private:
+    /**
+     * Closes the open window
+     *
+     * @return the frames in the window
+     */
+    CaptureWindow closeWindow();
+
+    /**
+     * Checks if every active camera has contributed a frame to the open window
+     *
+     * @return whether every active camera is in the open window
+     */
+    bool allActiveCamerasInWindow() const;
+
+    double capture_window_seconds;
+    // The number of windows that had been closed when each camera was last seen
+    std::map<unsigned int, unsigned long> camera_last_seen_windows;
+
+    // The frames in the open window, keyed by camera id
+    std::map<unsigned int, SSLProto::SSL_DetectionFrame> window_frames;
+    // The capture time of the first frame in the open window (s)
+    double window_start_seconds;
+    unsigned long num_windows_closed;
+};
@@ -0,0 +1,162 @@
+#include "software/sensor_fusion/vision_frame_aggregator.h"
+
+#include <gtest/gtest.h>
+
+#include "proto/message_translation/ssl_detection.h"
+
+class VisionFrameAggregatorTest : public ::testing::Test
+{
+   protected:
+    SSLProto::SSL_DetectionFrame createFrame(unsigned int camera_id, double t_capture)
+    {
+        return *createSSLDetectionFrame(camera_id, Timestamp::fromSeconds(t_capture), 0,
+                                        {}, {}, {});
+    }
+
+    std::vector<unsigned int> getCameraIds(
+        const VisionFrameAggregator::CaptureWindow& window)
+    {
+        std::vector<unsigned int> camera_ids;
+        for (const auto& frame : window)
+        {
+            camera_ids.push_back(frame.camera_id());
+        }
+        return camera_ids;
+    }
+
+    // Adds the first two vision periods from cameras 0 and 1, after which the
+    // aggregator knows about both cameras
+    void addFirstVisionPeriods()
+    {
+        aggregator.addFrame(createFrame(0, 1.0));
+        aggregator.addFrame(createFrame(1, 1.0));
+        aggregator.addFrame(createFrame(0, 1.016));
+        aggregator.addFrame(createFrame(1, 1.016));
+    }
+
+    VisionFrameAggregator aggregator;
+};
+
+TEST_F(VisionFrameAggregatorTest, single_camera_closes_window_immediately)
+{
+    for (int i = 0; i < 5; i++)
+    {
+        auto windows = aggregator.addFrame(createFrame(0, 1 + i * 0.016));
+        ASSERT_EQ(1, windows.size());
+        ASSERT_EQ(1, windows[0].size());
+        EXPECT_DOUBLE_EQ(1 + i * 0.016, windows[0][0].t_capture());
+    }
+}
+
+TEST_F(VisionFrameAggregatorTest, window_closes_once_all_cameras_have_been_seen)
+{
+    // The first vision period, where we don't know about every camera yet
+    aggregator.addFrame(createFrame(0, 1.0));
+    EXPECT_TRUE(aggregator.addFrame(createFrame(1, 1.001)).empty());
+    EXPECT_TRUE(aggregator.addFrame(createFrame(2, 1.002)).empty());
+
+    // Camera 0's next frame is in the next vision period, so it closes the window
+    auto windows = aggregator.addFrame(createFrame(0, 1.016));
+    ASSERT_EQ(1, windows.size());
+    EXPECT_EQ(std::vector<unsigned int>({1, 2}), getCameraIds(windows[0]));
+
+    // From now on, a window closes as soon as the last camera arrives
+    EXPECT_TRUE(aggregator.addFrame(createFrame(2, 1.017)).empty());
+    windows = aggregator.addFrame(createFrame(1, 1.018));
+    ASSERT_EQ(1, windows.size());
+    EXPECT_EQ(std::vector<unsigned int>({0, 1, 2}), getCameraIds(windows[0]));
+
+    EXPECT_TRUE(aggregator.addFrame(createFrame(1, 1.032)).empty());
+    EXPECT_TRUE(aggregator.addFrame(createFrame(0, 1.033)).empty());
+    windows = aggregator.addFrame(createFrame(2, 1.034));
+    ASSERT_EQ(1, windows.size());
+    EXPECT_EQ(std::vector<unsigned int>({0, 1, 2}), getCameraIds(windows[0]));
+}
+
+TEST_F(VisionFrameAggregatorTest, frame_outside_window_closes_window)
+{
+    addFirstVisionPeriods();
+
+    EXPECT_TRUE(aggregator.addFrame(createFrame(0, 1.032)).empty());
+
+    // Camera 1 missed a vision period, so camera 0's next frame starts a new window
+    auto windows = aggregator.addFrame(createFrame(0, 1.048));
+    ASSERT_EQ(1, windows.size());
+    EXPECT_EQ(std::vector<unsigned int>({0}), getCameraIds(windows[0]));
+    EXPECT_DOUBLE_EQ(1.032, windows[0][0].t_capture());
+}
+
+TEST_F(VisionFrameAggregatorTest, repeated_camera_closes_window)
+{
+    addFirstVisionPeriods();
+
+    EXPECT_TRUE(aggregator.addFrame(createFrame(1, 1.032)).empty());
+
+    // Within the capture window of the open window, but camera 1 is already in it
+    auto windows = aggregator.addFrame(createFrame(1, 1.033));
+    ASSERT_EQ(1, windows.size());
+    EXPECT_EQ(std::vector<unsigned int>({1}), getCameraIds(windows[0]));
+}
+
+TEST_F(VisionFrameAggregatorTest, capture_times_of_unsynchronized_cameras_are_kept)
+{
+    // Camera 1 always captures 6ms after camera 0
+    const double phase_offset = 0.006;
+    for (int i = 0; i < 100; i++)
+    {
+        aggregator.addFrame(createFrame(0, 1 + i * 0.016));
+        aggregator.addFrame(createFrame(1, 1 + i * 0.016 + phase_offset));
+    }
+
+    // Both cameras still share a window, and each frame keeps its own capture time
+    EXPECT_TRUE(aggregator.addFrame(createFrame(0, 3.0)).empty());
+    auto windows = aggregator.addFrame(createFrame(1, 3.0 + phase_offset));
+    ASSERT_EQ(1, windows.size());
+    ASSERT_EQ(2, windows[0].size());
+    EXPECT_DOUBLE_EQ(3.0, windows[0][0].t_capture());
+    EXPECT_DOUBLE_EQ(3.0 + phase_offset, windows[0][1].t_capture());
+}
+
+TEST_F(VisionFrameAggregatorTest, inactive_camera_is_not_waited_for)
+{
+    addFirstVisionPeriods();
+
+    // Camera 1 stops sending frames, so every window is closed by the next frame from
+    // camera 0 until camera 1 times out. The last window camera 1 was in counts
+    // towards its timeout.
+    double t_capture = 1.016;
+    EXPECT_TRUE(aggregator.addFrame(createFrame(0, t_capture += 0.016)).empty());
+    for (unsigned int i = 1; i < VisionFrameAggregator::CAMERA_TIMEOUT_WINDOWS; i++)
+    {
+        t_capture += 0.016;
+        auto windows = aggregator.addFrame(createFrame(0, t_capture));
+        ASSERT_EQ(1, windows.size());
+        EXPECT_DOUBLE_EQ(t_capture - 0.016, windows[0].back().t_capture());
+    }
+
+    // Once camera 1 times out, the window waiting for it and the new frame from camera
+    // 0 are both closed
+    t_capture += 0.016;
+    auto windows = aggregator.addFrame(createFrame(0, t_capture));
+    ASSERT_EQ(2, windows.size());
+    EXPECT_DOUBLE_EQ(t_capture - 0.016, windows[0][0].t_capture());
+    EXPECT_DOUBLE_EQ(t_capture, windows[1][0].t_capture());
+
+    t_capture += 0.016;
+    windows = aggregator.addFrame(createFrame(0, t_capture));
+    ASSERT_EQ(1, windows.size());
+    EXPECT_DOUBLE_EQ(t_capture, windows[0][0].t_capture());
+}
+
+TEST_F(VisionFrameAggregatorTest, reset)
+{
+    addFirstVisionPeriods();
+    aggregator.addFrame(createFrame(0, 1.032));
+
+    aggregator.reset();
+
+    // Camera 1 is forgotten, so camera 0 closes the window by itself
+    auto windows = aggregator.addFrame(createFrame(0, 0.0));
+    ASSERT_EQ(1, windows.size());
+    EXPECT_EQ(std::vector<unsigned int>({0}), getCameraIds(windows[0]));
+}
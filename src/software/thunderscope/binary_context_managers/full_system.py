@@ -224,6 +224,7 @@ gdb --args bazel-bin/{self.full_system}
             ObstacleList,
             DebugShapes,
             BallPlacementVisualization,
+            VisualizationDelta,
         ]:
             proto_unix_io.attach_unix_receiver(
                 runtime_dir=self.full_system_runtime_dir,
@@ -6,6 +6,10 @@ import os
 from software.networking.unix.threaded_unix_listener import ThreadedUnixListener
 from software.networking.unix.threaded_unix_sender import ThreadedUnixSender
 from software.thunderscope.thread_safe_buffer import ThreadSafeBuffer
+from software.thunderscope.visualization_delta_decoder import (
+    VisualizationDeltaDecoder,
+)
+from proto.visualization_pb2 import VisualizationDelta
 from typing import Type
 from google.protobuf.message import Message
 
@@ -47,6 +51,11 @@ class ProtoUnixIO:
     - attach_unix_sender() configures a unix sender (it is an observer as well)
       and relays data from send_proto over the socket.
 
+    Visualization Deltas:
+
+    - VisualizationDeltas received or sent are decoded back into the protobufs
+      full system delta encoded, and those protobufs are sent to the observers.
+
     TL;DR This class manages inter-thread communication through register_observer
     and send_proto calls. If unix senders/receivers are attached to a proto type,
     then the data is also sent/received over the sockets.
@@ -59,6 +68,7 @@ class ProtoUnixIO:
         self.unix_senders = {}
         self.unix_listeners = {}
         self.send_proto_to_observer_threads = {}
+        self.visualization_delta_decoder = VisualizationDeltaDecoder()
         self.running = True
 
     def __send_proto_to_observers(self, receive_buffer: ThreadSafeBuffer) -> None:
@@ -69,6 +79,10 @@ class ProtoUnixIO:
         """
         while self.running:
             proto = receive_buffer.get()
+            if isinstance(proto, VisualizationDelta):
+                proto = self.visualization_delta_decoder.decode(proto)
+                if proto is None:
+                    continue
 
             if proto.DESCRIPTOR.full_name in self.proto_observers:
                 for buffer in self.proto_observers[proto.DESCRIPTOR.full_name]:
@@ -118,6 +132,12 @@ class ProtoUnixIO:
                       to put the proto. Otherwise, proto will be dropped if queue is full.
         :param timeout: If block is True, then wait for this many seconds
         """
+        if proto_class is VisualizationDelta:
+            data = self.visualization_delta_decoder.decode(data)
+            if data is None:
+                return
+            proto_class = type(data)
+
         if proto_class.DESCRIPTOR.full_name in self.proto_observers:
             for buffer in self.proto_observers[proto_class.DESCRIPTOR.full_name]:
                 buffer.put(data, block, timeout)
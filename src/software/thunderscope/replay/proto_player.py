@@ -4,6 +4,7 @@ import threading
 import base64
 import os
 import gzip
+import io
 import glob
 from proto.import_all_protos import *
 from extlibs.er_force_sim.src.protobuf.world_pb2 import *
@@ -142,35 +143,36 @@ class ProtoPlayer:
         except Exception:
             return True
 
-    def handle_log_line_for_chunk(self, **kwargs) -> None:
+    def handle_chunk_for_chunk_index(self, chunk_name: str, chunk_data) -> None:
         """Find the time stamp of the first proto event in the replay file.
-        :param kwargs: a dictionary contains all the information about a line in the replay log.
-            e.g. {
-                "protobuf_type": type of proto
-                "timestamp": timestamp when the proto is logged
-                "data": data of the proto message
-                "line_no": line number
-                "chunk_name": file name of the chunk
-            }
+
+        :param chunk_name: file name of the chunk
+        :param chunk_data: the log entries of the chunk, see load_replay_chunk
         """
-        if kwargs["line_no"] == 0:
-            self.chunks_indices[os.path.basename(kwargs["chunk_name"])] = kwargs[
-                "timestamp"
-            ]
+        start_timestamp, _, _ = ProtoPlayer.unpack_log_entry(
+            chunk_data[0], self.version
+        )
+        self.chunks_indices[os.path.basename(chunk_name)] = start_timestamp
 
-    def handle_log_line_for_bookmark(self, **kwargs) -> None:
+    def handle_chunk_for_bookmark_index(self, chunk_name: str, chunk_data) -> None:
         """Filter out bookmark protos in the replay log
-        :param kwargs: a dictionary contains all the information about a line in the replay log.
-            e.g. {
-                "protobuf_type": type of proto
-                "timestamp": timestamp when the proto is logged
-                "data": data of the proto message
-                "line_no": line number
-                "chunk_name": file name of the chunk
-            }
+
+        :param chunk_name: file name of the chunk
+        :param chunk_data: the log entries of the chunk, see load_replay_chunk
         """
-        if kwargs["protobuf_type"] == ReplayBookmark:
-            self.bookmark_indices.append(kwargs["timestamp"])
+        # ReplayChunks find the bookmarks natively, without unpacking every entry
+        if isinstance(chunk_data, tbots_cpp.ReplayChunk):
+            self.bookmark_indices.extend(
+                chunk_data.receiveTimesOfType(ReplayBookmark.DESCRIPTOR.full_name)
+            )
+            return
+
+        for log_entry in chunk_data:
+            timestamp, protobuf_type, _ = ProtoPlayer.unpack_log_entry(
+                log_entry, self.version
+            )
+            if protobuf_type == ReplayBookmark:
+                self.bookmark_indices.append(timestamp)
 
     def finish_preprocess_replay_file(self) -> None:
         """Finish off pre-processing and save all the pre-processing result to disk"""
@@ -215,29 +217,15 @@ class ProtoPlayer:
     def preprocess_replay_file(self, handlers: List[Callable[[...], None]]) -> None:
         """Start preprocessing replay files and build index according to the provided handlers
 
-        :param handlers: handler functions that will be applied to each line of the replay log.
+        :param handlers: handler functions that will be applied to each chunk of the replay log.
                 This function will be provided following parameters
-                 (self: ProtoPlayer, line_no: int, chunk_name:str, timestamp: float,
-                    protobuf_type: Type[Message], data: Message).
+                 (self: ProtoPlayer, chunk_name: str, chunk_data: the log entries of the chunk).
         """
         for chunk_name in self.sorted_chunks:
             chunk_data = ProtoPlayer.load_replay_chunk(chunk_name, self.version)
             if chunk_data:
-                start_timestamp, _, _ = ProtoPlayer.unpack_log_entry(
-                    chunk_data[0], self.version
-                )
-                for line_no, data in enumerate(chunk_data):
-                    timestamp, protobuf_type, data = ProtoPlayer.unpack_log_entry(
-                        data, self.version
-                    )
-                    for handler in handlers:
-                        handler(
-                            line_no=line_no,
-                            chunk_name=chunk_name,
-                            timestamp=timestamp,
-                            protobuf_type=protobuf_type,
-                            data=data,
-                        )
+                for handler in handlers:
+                    handler(chunk_name=chunk_name, chunk_data=chunk_data)
         self.finish_preprocess_replay_file()
 
     def is_chunk_indexed(self) -> bool:
@@ -293,12 +281,12 @@ class ProtoPlayer:
         # handler_list contains all the tasks to do when pre-processing the log data
         handler_list = list()
         if not self.is_chunk_indexed():
-            handler_list.append(self.handle_log_line_for_chunk)
+            handler_list.append(self.handle_chunk_for_chunk_index)
         else:
             self.load_chunk_index()
 
         if not self.is_bookmark_indexed():
-            handler_list.append(self.handle_log_line_for_bookmark)
+            handler_list.append(self.handle_chunk_for_bookmark_index)
         else:
             self.load_bookmark_index()
 
@@ -343,17 +331,23 @@ class ProtoPlayer:
 
         :param replay_chunk_path: The path to the replay chunk.
         :param version: The format version of the replay file
-        :return: The replay chunk. List of log entries
+        :return: The replay chunk. A sequence of log entries
         """
+        # Starting version 2, chunks are loaded and indexed by the C++ ReplayChunk,
+        # which returns the entries already unpacked
+        if version >= 2:
+            try:
+                return tbots_cpp.ReplayChunk(str(replay_chunk_path))
+            except Exception as e:
+                logging.warning(
+                    f"An unknown exception has occurred while reading {replay_chunk_path}: {e}"
+                )
+                return []
+
         cached_data = []
 
         # Load chunk into memory
-        with gzip.open(replay_chunk_path, "rb") as log_file:
-            # Starting version 2, the first line of the chunk contains
-            # the replay file version
-            if version >= 2:
-                log_file.readline()
-
+        with ProtoPlayer.open_replay_chunk(replay_chunk_path) as log_file:
             while True:
                 try:
                     line = log_file.readline()
@@ -376,6 +370,16 @@ class ProtoPlayer:
 
         return cached_data
 
+    @staticmethod
+    def open_replay_chunk(replay_chunk_path: os.PathLike) -> io.BytesIO:
+        """Decompresses a replay chunk into memory. Chunks are compressed with zstd
+        or gzip, and may be made of many compressed blocks.
+
+        :param replay_chunk_path: The path to the replay chunk.
+        :return: The decompressed chunk, as a file
+        """
+        return io.BytesIO(tbots_cpp.readReplayChunk(str(replay_chunk_path)))
+
     @staticmethod
     def get_replay_chunk_format_version(replay_chunk_path: os.PathLike) -> int:
         """Reads a replay chunk.
@@ -388,7 +392,7 @@ class ProtoPlayer:
 
         # Starting version 2, the first line of the chunk should be
         # the replay file version
-        with gzip.open(replay_chunk_path, "rb") as log_file:
+        with ProtoPlayer.open_replay_chunk(replay_chunk_path) as log_file:
             try:
                 line = log_file.readline()
                 file_version_prefix_bytes = bytes(
@@ -409,14 +413,18 @@ class ProtoPlayer:
     ) -> (float, Type[Message], Message):
         """Unpacks a log entry into the timestamp and proto.
 
-        :param log_entry: The log entry.
+        :param log_entry: The log entry. Starting version 2, this is the tuple
+                          returned by indexing a tbots_cpp.ReplayChunk.
         :param version: The format version of the replay file
         :return: The timestamp, proto_class, deserialized protobuf
         """
         # Unpack metadata
-        timestamp, protobuf_type, data = log_entry.split(
-            bytes(REPLAY_METADATA_DELIMITER, encoding="utf-8")
-        )
+        if version >= 2:
+            timestamp, protobuf_type, data = log_entry
+        else:
+            timestamp, protobuf_type, data = log_entry.split(
+                bytes(REPLAY_METADATA_DELIMITER, encoding="utf-8")
+            )
 
         # Convert string to type. eval is an order of magnitude
         # faster than iterating over the protobuf library to find
@@ -433,10 +441,9 @@ class ProtoPlayer:
             deserialized_proto = proto_class.FromString(
                 base64.b64decode(data[len("b") : -len("\n")])
             )
-        elif version == 2:
-            deserialized_proto = proto_class.FromString(
-                base64.b64decode(data[: -len("\n")])
-            )
+        elif version in (2, 3):
+            # ReplayChunks have already decoded the serialized protos of version 2
+            deserialized_proto = proto_class.FromString(data)
         else:
             raise ValueError(f"Unknown replay file version: {version}")
 
@@ -479,12 +486,8 @@ class ProtoPlayer:
                 )
 
                 # Save all clips with the latest replay format version
-                log_file.write(
-                    bytes(
-                        REPLAY_FILE_VERSION_PREFIX + str(REPLAY_FILE_VERSION) + "\n",
-                        encoding="utf-8",
-                    )
-                )
+                encoder = tbots_cpp.ReplayChunkEncoder()
+                log_file.write(encoder.encodeHeader())
 
                 while self.current_entry_index < len(self.current_chunk):
                     (
@@ -495,17 +498,21 @@ class ProtoPlayer:
                         self.current_chunk[self.current_entry_index], self.version
                     )
 
-                    log_entry = tbots_cpp.ProtoLogger.createLogEntry(
-                        proto.DESCRIPTOR.full_name,
-                        proto.SerializeToString(),
-                        self.current_packet_time - start_time,
+                    log_file.write(
+                        encoder.encodeEntry(
+                            proto.DESCRIPTOR.full_name,
+                            proto.SerializeToString(),
+                            self.current_packet_time - start_time,
+                        )
                     )
-                    log_file.write(bytes(log_entry, encoding="utf-8"))
                     self.current_entry_index += 1
                     if self.current_packet_time >= end_time:
+                        log_file.write(encoder.encodeFooter())
                         logging.info("Clip saved!")
                         self.build_chunk_index(directory)
                         return
+                log_file.write(encoder.encodeFooter())
+
                 # Load the next chunk
                 self.current_chunk_index += 1
                 replay_index += 1
@@ -627,10 +634,16 @@ class ProtoPlayer:
             )
 
             # Search through the chunk to find the entry that is closest to
-            # the seek_time
-            self.current_entry_index = ProtoPlayer.binary_search(
-                self.current_chunk, seek_time, key=__bisect_entries_by_timestamp
-            )
+            # the seek_time. ReplayChunks search their index natively.
+            if isinstance(self.current_chunk, tbots_cpp.ReplayChunk):
+                self.current_entry_index = min(
+                    self.current_chunk.findEntry(seek_time),
+                    len(self.current_chunk) - 1,
+                )
+            else:
+                self.current_entry_index = ProtoPlayer.binary_search(
+                    self.current_chunk, seek_time, key=__bisect_entries_by_timestamp
+                )
 
             # Update the seek_offset_time and current_packet_time
             # to the one we just found.
@@ -19,34 +19,22 @@ def read_one_chunk(replay_file_name: str) -> int:
     version = ProtoPlayer.get_replay_chunk_format_version(replay_file_name)
 
     line_num = 0
-    with gzip.open(replay_file_name, "rb") as replay_file:
-        # Skip the metadata line
-        if version >= 2:
-            replay_file.readline()
-
-        for line in replay_file.readlines():
-            # do not parse empty line
-            if line == b"":
-                continue
-
-            try:
-                timestamp, protobuf_type, proto = ProtoPlayer.unpack_log_entry(
-                    line, version
-                )
-            except Exception as e:
-                print("Exception ignored. Please see below for more!")
-                print(e)
-                continue
-
-            #######################################
-            # Do something with the protobuf here #
-            #######################################
-            print(
-                "{}: {}: {} - {}".format(
-                    line_num, float(timestamp), protobuf_type, proto
-                )
+    # The player skips the metadata line and any corrupt entries
+    for log_entry in ProtoPlayer.load_replay_chunk(replay_file_name, version):
+        try:
+            timestamp, protobuf_type, proto = ProtoPlayer.unpack_log_entry(
+                log_entry, version
             )
-            line_num += 1
+        except Exception as e:
+            print("Exception ignored. Please see below for more!")
+            print(e)
+            continue
+
+        #######################################
+        # Do something with the protobuf here #
+        #######################################
+        print("{}: {}: {} - {}".format(line_num, float(timestamp), protobuf_type, proto))
+        line_num += 1
 
     return line_num
 
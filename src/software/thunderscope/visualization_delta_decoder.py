@@ -0,0 +1,64 @@
+from typing import Dict, List, Optional, Tuple
+
+from google.protobuf import descriptor_pool, message_factory
+from google.protobuf.message import Message
+
+from proto.visualization_pb2 import VisualizationDelta
+
+
+class VisualizationDeltaDecoder:
+    """Rebuilds the visualization protobufs that full system delta encodes.
+
+    Full system sends some visualization protobufs with large repeated fields
+    (e.g. ObstacleList) as VisualizationDeltas, which only contain the elements
+    that changed since the previous delta of the same type. The decoder keeps the
+    elements of the last delta of each type so the next delta can be applied to
+    them. If a delta is missed (e.g. a datagram was dropped, or a replay was
+    seeked), the deltas after it are skipped until the next keyframe.
+    """
+
+    def __init__(self) -> None:
+        # Mapping from protobuf type full name -> (sequence number, elements)
+        self.previous_deltas: Dict[str, Tuple[int, List[bytes]]] = {}
+
+    def decode(self, delta: VisualizationDelta) -> Optional[Message]:
+        """Rebuild the protobuf a delta was encoded from
+
+        :param delta: The delta to decode
+        :return: The rebuilt protobuf, or None if the delta it applies to was missed
+        """
+        previous_delta = self.previous_deltas.get(delta.protobuf_type_full_name)
+        if not delta.keyframe and (
+            previous_delta is None
+            or previous_delta[0] + 1 != delta.sequence_number
+        ):
+            self.previous_deltas.pop(delta.protobuf_type_full_name, None)
+            return None
+
+        previous_elements = previous_delta[1] if previous_delta else []
+        new_elements = iter(delta.new_elements)
+        try:
+            elements = [
+                previous_elements[index] if index >= 0 else next(new_elements)
+                for index in delta.previous_indices
+            ]
+        except (IndexError, StopIteration):
+            self.previous_deltas.pop(delta.protobuf_type_full_name, None)
+            return None
+        self.previous_deltas[delta.protobuf_type_full_name] = (
+            delta.sequence_number,
+            elements,
+        )
+
+        proto_class = message_factory.GetMessageClass(
+            descriptor_pool.Default().FindMessageTypeByName(
+                delta.protobuf_type_full_name
+            )
+        )
+        proto = proto_class.FromString(delta.other_fields)
+        repeated_field = getattr(
+            proto, proto.DESCRIPTOR.fields_by_number[delta.field_number].name
+        )
+        for element in elements:
+            repeated_field.add().MergeFromString(element)
+        return proto
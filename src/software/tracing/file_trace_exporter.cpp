@@ -0,0 +1,133 @@
+#include "software/tracing/file_trace_exporter.h"
+
+#include <iterator>
+#include <stdexcept>
+
+#include "software/util/binary_encoding/binary_encoding.h"
+
+FileTraceExporter::FileTraceExporter(const std::string& trace_file_path)
+    : trace_file(trace_file_path, std::ios::binary | std::ios::trunc),
+      buffer(),
+      name_ids(),
+      previous_timestamp_ns(0)
+{
+    if (!trace_file.is_open())
+    {
+        throw std::invalid_argument("Could not open trace file " + trace_file_path);
+    }
+    buffer.append(TRACE_FILE_MAGIC);
+    buffer.push_back(static_cast<char>(TRACE_FILE_VERSION));
+}
+
+void FileTraceExporter::exportEvents(const std::vector<TraceEvent>& events)
+{
+    for (const TraceEvent& event : events)
+    {
+        const uint32_t name_id = nameId(event.name);
+        buffer.push_back(static_cast<char>(1 + static_cast<uint8_t>(event.type)));
+        appendVarint(name_id, buffer);
+        appendVarint(event.thread_id, buffer);
+        appendSignedVarint(event.timestamp_ns - previous_timestamp_ns, buffer);
+        if (event.type == TraceEventType::COUNTER || event.type == TraceEventType::VALUE)
+        {
+            appendDouble(event.value, buffer);
+        }
+        previous_timestamp_ns = event.timestamp_ns;
+    }
+
+    trace_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    buffer.clear();
+}
+
+void FileTraceExporter::flush()
+{
+    trace_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    buffer.clear();
+    trace_file.flush();
+}
+
+uint32_t FileTraceExporter::nameId(const char* name)
+{
+    auto [iter, inserted] =
+        name_ids.try_emplace(name, static_cast<uint32_t>(name_ids.size()));
+    if (inserted)
+    {
+        buffer.push_back(static_cast<char>(NAME_RECORD_TAG));
+        appendVarint(iter->second, buffer);
+        appendString(name, buffer);
+    }
+    return iter->second;
+}
+
+std::vector<TraceFileEvent> readTraceFile(const std::string& trace_file_path)
+{
+    std::ifstream trace_file(trace_file_path, std::ios::binary);
+    if (!trace_file.is_open())
+    {
+        throw std::invalid_argument("Could not open trace file " + trace_file_path);
+    }
+    const std::string data((std::istreambuf_iterator<char>(trace_file)),
+                           std::istreambuf_iterator<char>());
+
+    const std::string_view magic = FileTraceExporter::TRACE_FILE_MAGIC;
+    if (!data.starts_with(magic) || data.size() <= magic.size() ||
+        static_cast<uint8_t>(data[magic.size()]) != FileTraceExporter::TRACE_FILE_VERSION)
+    {
+        throw std::invalid_argument(trace_file_path + " is not a trace file");
+    }
+
+    std::vector<TraceFileEvent> events;
+    std::vector<std::string> names;
+    int64_t timestamp_ns = 0;
+    size_t offset        = magic.size() + 1;
+    while (offset < data.size())
+    {
+        const auto tag = static_cast<uint8_t>(data[offset++]);
+        if (tag == FileTraceExporter::NAME_RECORD_TAG)
+        {
+            std::optional<uint64_t> name_id      = readVarint(data, offset);
+            std::optional<std::string_view> name = readString(data, offset);
+            if (!name_id || !name)
+            {
+                break;
+            }
+            if (*name_id >= names.size())
+            {
+                names.resize(*name_id + 1);
+            }
+            names[*name_id] = *name;
+            continue;
+        }
+
+        if (tag > 1 + static_cast<uint8_t>(TraceEventType::VALUE))
+        {
+            throw std::invalid_argument(trace_file_path + " has an unknown record");
+        }
+        const auto type = static_cast<TraceEventType>(tag - 1);
+
+        std::optional<uint64_t> name_id             = readVarint(data, offset);
+        std::optional<uint64_t> thread_id           = readVarint(data, offset);
+        std::optional<int64_t> timestamp_difference = readSignedVarint(data, offset);
+        std::optional<double> value                 = 0.0;
+        if (type == TraceEventType::COUNTER || type == TraceEventType::VALUE)
+        {
+            value = readDouble(data, offset);
+        }
+        if (!name_id || !thread_id || !timestamp_difference || !value)
+        {
+            break;
+        }
+        if (*name_id >= names.size())
+        {
+            throw std::invalid_argument(trace_file_path + " has an undefined name");
+        }
+
+        timestamp_ns += *timestamp_difference;
+        events.push_back(TraceFileEvent{.type         = type,
+                                        .name         = names[*name_id],
+                                        .thread_id    = static_cast<uint32_t>(*thread_id),
+                                        .timestamp_ns = timestamp_ns,
+                                        .value        = *value});
+    }
+    return events;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "software/tracing/trace_exporter.h"
+
+/**
+ * Exports traced events to a compact binary file, so detailed timings can be
+ * recorded for a whole game and analyzed afterwards.
+ *
+ * The file starts with TRACE_FILE_MAGIC and TRACE_FILE_VERSION, followed by records
+ * that each start with a tag byte:
+ *  - A name record (tag 0) is the id of a name, then the length and bytes of the
+ *    name. Every name is defined once, before the first event that uses it.
+ *  - An event record (tag 1 + TraceEventType) is the id of its name, its thread id
+ *    and its timestamp as the difference from the previous event's, then the value
+ *    as a little-endian double for counters and values.
+ *
+ * Ids, thread ids and lengths are varints, and the timestamp differences are zigzag
+ * encoded varints, so most zone events take 5 to 7 bytes.
+ */
+class FileTraceExporter : public TraceExporter
+{
+   public:
+    /**
+     * Creates a FileTraceExporter
+     *
+     * @param trace_file_path The path of the file to write, which is overwritten
+     */
+    explicit FileTraceExporter(const std::string& trace_file_path);
+
+    void exportEvents(const std::vector<TraceEvent>& events) override;
+
+    void flush() override;
+
+    static constexpr std::string_view TRACE_FILE_MAGIC = "TBTRACE";
+    static constexpr uint8_t TRACE_FILE_VERSION        = 1;
+    static constexpr uint8_t NAME_RECORD_TAG           = 0;
+
+   private:
+    /**
+     * Returns the id of a name, appending a name record to the buffer the first time
+     * the name is seen
+     *
+     * @param name The name
+     *
+     * @return the id of the name
+     */
+    uint32_t nameId(const char* name);
+
+    std::ofstream trace_file;
+    std::string buffer;
+    std::unordered_map<const char*, uint32_t> name_ids;
+    int64_t previous_timestamp_ns;
+};
+
+/**
+ * An event read back from a trace file
+ */
+struct TraceFileEvent
+{
+    TraceEventType type;
+    std::string name;
+    uint32_t thread_id;
+    int64_t timestamp_ns;
+    double value;
+};
+
+/**
+ * Reads the events in a trace file written by a FileTraceExporter. A truncated
+ * final record (e.g. if the program crashed while writing it) is ignored.
+ *
+ * @param trace_file_path The path of the trace file
+ *
+ * @throws std::invalid_argument if the file can't be read or is not a trace file
+ *
+ * @return the events in the trace file, in the order they were written
+ */
+std::vector<TraceFileEvent> readTraceFile(const std::string& trace_file_path);
@@ -0,0 +1,100 @@
+#include "software/tracing/file_trace_exporter.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+class FileTraceExporterTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        trace_file_path =
+            std::filesystem::temp_directory_path() / "file_trace_exporter_test.tbtrace";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(trace_file_path);
+    }
+
+    std::string trace_file_path;
+};
+
+TEST_F(FileTraceExporterTest, test_events_round_trip)
+{
+    std::vector<TraceEvent> events = {
+        {.timestamp_ns = 1000,
+         .name         = "zone",
+         .value        = 0.0,
+         .thread_id    = 1,
+         .type         = TraceEventType::ZONE_BEGIN},
+        {.timestamp_ns = 900,
+         .name         = "value",
+         .value        = 2.5,
+         .thread_id    = 2,
+         .type         = TraceEventType::VALUE},
+        {.timestamp_ns = 3000,
+         .name         = "zone",
+         .value        = 0.0,
+         .thread_id    = 1,
+         .type         = TraceEventType::ZONE_END},
+    };
+
+    {
+        FileTraceExporter exporter(trace_file_path);
+        exporter.exportEvents(events);
+        exporter.exportEvents({{.timestamp_ns = 4000,
+                                .name         = "counter",
+                                .value        = 3.0,
+                                .thread_id    = 1,
+                                .type         = TraceEventType::COUNTER}});
+        exporter.flush();
+    }
+
+    std::vector<TraceFileEvent> read_events = readTraceFile(trace_file_path);
+    ASSERT_EQ(read_events.size(), 4);
+    for (size_t i = 0; i < events.size(); i++)
+    {
+        EXPECT_EQ(read_events[i].type, events[i].type);
+        EXPECT_EQ(read_events[i].name, events[i].name);
+        EXPECT_EQ(read_events[i].thread_id, events[i].thread_id);
+        EXPECT_EQ(read_events[i].timestamp_ns, events[i].timestamp_ns);
+        EXPECT_EQ(read_events[i].value, events[i].value);
+    }
+    EXPECT_EQ(read_events[3].name, "counter");
+    EXPECT_EQ(read_events[3].value, 3.0);
+}
+
+TEST_F(FileTraceExporterTest, test_truncated_last_event_is_ignored)
+{
+    {
+        FileTraceExporter exporter(trace_file_path);
+        exporter.exportEvents({{.timestamp_ns = 1000,
+                                .name         = "value",
+                                .value        = 1.0,
+                                .thread_id    = 1,
+                                .type         = TraceEventType::VALUE},
+                               {.timestamp_ns = 2000,
+                                .name         = "value",
+                                .value        = 2.0,
+                                .thread_id    = 1,
+                                .type         = TraceEventType::VALUE}});
+        exporter.flush();
+    }
+    std::filesystem::resize_file(trace_file_path,
+                                 std::filesystem::file_size(trace_file_path) - 1);
+
+    std::vector<TraceFileEvent> read_events = readTraceFile(trace_file_path);
+    ASSERT_EQ(read_events.size(), 1);
+    EXPECT_EQ(read_events[0].value, 1.0);
+}
+
+TEST_F(FileTraceExporterTest, test_reading_a_file_that_is_not_a_trace_throws)
+{
+    {
+        std::ofstream file(trace_file_path);
+        file << "not a trace";
+    }
+    EXPECT_THROW(readTraceFile(trace_file_path), std::invalid_argument);
+}
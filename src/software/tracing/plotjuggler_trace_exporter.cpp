@@ -0,0 +1,60 @@
+#include "software/tracing/plotjuggler_trace_exporter.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+PlotJugglerTraceExporter::PlotJugglerTraceExporter(
+    std::shared_ptr<PlotJugglerSink> plotjuggler_sink)
+    : plotjuggler_sink(std::move(plotjuggler_sink)),
+      system_clock_offset(std::chrono::system_clock::now().time_since_epoch() -
+                          std::chrono::steady_clock::now().time_since_epoch())
+{
+}
+
+void PlotJugglerTraceExporter::exportEvents(const std::vector<TraceEvent>& events)
+{
+    plotjuggler_value.Clear();
+    auto& data                  = *plotjuggler_value.mutable_data();
+    int64_t latest_timestamp_ns = 0;
+
+    for (const TraceEvent& event : events)
+    {
+        latest_timestamp_ns = std::max(latest_timestamp_ns, event.timestamp_ns);
+        switch (event.type)
+        {
+            case TraceEventType::ZONE_BEGIN:
+            case TraceEventType::ZONE_END:
+            {
+                if (auto zone_duration_ms = zone_timer.update(event))
+                {
+                    const std::string key = std::string(event.name) + " (ms)";
+                    auto iter             = data.find(key);
+                    if (iter == data.end() || iter->second < *zone_duration_ms)
+                    {
+                        data[key] = *zone_duration_ms;
+                    }
+                }
+                break;
+            }
+            case TraceEventType::COUNTER:
+            {
+                data[event.name] = counter_totals[event.name] += event.value;
+                break;
+            }
+            case TraceEventType::VALUE:
+            {
+                data[event.name] = event.value;
+                break;
+            }
+        }
+    }
+
+    if (data.empty())
+    {
+        return;
+    }
+    plotjuggler_value.set_timestamp(
+        static_cast<double>(latest_timestamp_ns + system_clock_offset.count()) / 1e9);
+    plotjuggler_sink->sendPlotJugglerValue(plotjuggler_value);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+
+#include "software/logger/plotjuggler_sink.h"
+#include "software/tracing/trace_exporter.h"
+
+/**
+ * Exports traced events to PlotJuggler.
+ *
+ * One PlotJugglerValue is sent for every batch of drained events, so tracing a hot
+ * path doesn't flood PlotJuggler with a packet per event. Each zone is plotted as
+ * the longest it took in the batch in milliseconds, each value as its latest
+ * measurement, and each counter as its running total.
+ */
+class PlotJugglerTraceExporter : public TraceExporter
+{
+   public:
+    /**
+     * Creates a PlotJugglerTraceExporter
+     *
+     * @param plotjuggler_sink The sink to send the PlotJugglerValues with
+     */
+    explicit PlotJugglerTraceExporter(std::shared_ptr<PlotJugglerSink> plotjuggler_sink);
+
+    void exportEvents(const std::vector<TraceEvent>& events) override;
+
+   private:
+    std::shared_ptr<PlotJugglerSink> plotjuggler_sink;
+
+    // Traced events are timestamped with a steady clock, while PlotJuggler expects
+    // the system clock
+    const std::chrono::nanoseconds system_clock_offset;
+
+    TraceZoneTimer zone_timer;
+    std::unordered_map<const char*, double> counter_totals;
+    TbotsProto::PlotJugglerValue plotjuggler_value;
+};
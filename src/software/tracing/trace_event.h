@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * The kinds of events that can be traced
+ */
+enum class TraceEventType : uint8_t
+{
+    // A zone of code started running
+    ZONE_BEGIN,
+    // A zone of code finished running
+    ZONE_END,
+    // A count was incremented by the value of the event
+    COUNTER,
+    // A quantity was measured to be the value of the event
+    VALUE,
+};
+
+/**
+ * A single fixed-size traced event.
+ *
+ * Events only point to their name, which must be a string literal (or otherwise live
+ * for the rest of the program), so recording an event never allocates.
+ */
+struct TraceEvent
+{
+    // Nanoseconds since an arbitrary point, from a steady clock
+    int64_t timestamp_ns;
+    const char* name;
+    double value;
+    // A small number identifying the thread that recorded the event
+    uint32_t thread_id;
+    TraceEventType type;
+};
+
+static_assert(sizeof(TraceEvent) <= 32, "TraceEvents should fit in half a cache line");
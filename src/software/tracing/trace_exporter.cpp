@@ -0,0 +1,33 @@
+#include "software/tracing/trace_exporter.h"
+
+#include <functional>
+
+std::optional<double> TraceZoneTimer::update(const TraceEvent& event)
+{
+    if (event.type == TraceEventType::ZONE_BEGIN)
+    {
+        zone_begin_timestamps[{event.thread_id, event.name}].push_back(
+            event.timestamp_ns);
+        return std::nullopt;
+    }
+    if (event.type != TraceEventType::ZONE_END)
+    {
+        return std::nullopt;
+    }
+
+    auto iter = zone_begin_timestamps.find({event.thread_id, event.name});
+    if (iter == zone_begin_timestamps.end() || iter->second.empty())
+    {
+        // The beginning of the zone was dropped, or recorded before tracing started
+        return std::nullopt;
+    }
+    const int64_t begin_timestamp_ns = iter->second.back();
+    iter->second.pop_back();
+    return static_cast<double>(event.timestamp_ns - begin_timestamp_ns) / 1e6;
+}
+
+size_t TraceZoneTimer::ZoneKeyHash::operator()(
+    const std::pair<uint32_t, const char*>& key) const
+{
+    return std::hash<const char*>()(key.second) ^ (std::hash<uint32_t>()(key.first) << 1);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "software/tracing/trace_event.h"
+
+/**
+ * Receives the events drained from the trace rings, and exports them somewhere
+ * (e.g. a profiler, a plotting tool, or a file).
+ *
+ * Exporters are only called from the thread that drains the rings, so they don't
+ * need to be thread-safe.
+ */
+class TraceExporter
+{
+   public:
+    virtual ~TraceExporter() = default;
+
+    /**
+     * Exports a batch of drained events. The events of each thread are in the order
+     * they were recorded, but events of different threads may be interleaved in any
+     * order.
+     *
+     * @param events The events
+     */
+    virtual void exportEvents(const std::vector<TraceEvent>& events) = 0;
+
+    /**
+     * Flushes anything buffered by the exporter. Called when tracing stops.
+     */
+    virtual void flush() {}
+};
+
+/**
+ * Matches the beginnings and ends of zones to measure how long each zone took.
+ * Zones of the same name can be nested on a thread.
+ */
+class TraceZoneTimer
+{
+   public:
+    /**
+     * Updates the zones that are running with an event
+     *
+     * @param event The event
+     *
+     * @return how long the zone took in milliseconds, if the event ended a zone
+     * whose beginning was seen
+     */
+    std::optional<double> update(const TraceEvent& event);
+
+   private:
+    struct ZoneKeyHash
+    {
+        size_t operator()(const std::pair<uint32_t, const char*>& key) const;
+    };
+
+    // The beginning timestamps of the running zones, by thread and zone name
+    std::unordered_map<std::pair<uint32_t, const char*>, std::vector<int64_t>,
+                       ZoneKeyHash>
+        zone_begin_timestamps;
+};
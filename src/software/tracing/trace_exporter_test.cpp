@@ -0,0 +1,40 @@
+#include "software/tracing/trace_exporter.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    TraceEvent zoneEvent(TraceEventType type, const char* name, uint32_t thread_id,
+                         int64_t timestamp_ns)
+    {
+        return TraceEvent{.timestamp_ns = timestamp_ns,
+                          .name         = name,
+                          .value        = 0.0,
+                          .thread_id    = thread_id,
+                          .type         = type};
+    }
+}  // namespace
+
+TEST(TraceZoneTimerTest, test_nested_zones_on_different_threads)
+{
+    const char* zone = "zone";
+    TraceZoneTimer zone_timer;
+
+    EXPECT_FALSE(zone_timer.update(zoneEvent(TraceEventType::ZONE_BEGIN, zone, 1, 0)));
+    EXPECT_FALSE(zone_timer.update(zoneEvent(TraceEventType::ZONE_BEGIN, zone, 2, 0)));
+    EXPECT_FALSE(
+        zone_timer.update(zoneEvent(TraceEventType::ZONE_BEGIN, zone, 1, 1000000)));
+
+    EXPECT_EQ(zone_timer.update(zoneEvent(TraceEventType::ZONE_END, zone, 1, 3000000)),
+              2.0);
+    EXPECT_EQ(zone_timer.update(zoneEvent(TraceEventType::ZONE_END, zone, 2, 5000000)),
+              5.0);
+    EXPECT_EQ(zone_timer.update(zoneEvent(TraceEventType::ZONE_END, zone, 1, 4000000)),
+              4.0);
+}
+
+TEST(TraceZoneTimerTest, test_end_without_begin_is_ignored)
+{
+    TraceZoneTimer zone_timer;
+    EXPECT_FALSE(zone_timer.update(zoneEvent(TraceEventType::ZONE_END, "zone", 1, 10)));
+}
@@ -0,0 +1,48 @@
+#include "software/tracing/trace_ring.h"
+
+#include <algorithm>
+#include <bit>
+
+TraceRing::TraceRing(size_t capacity)
+    : capacity(std::bit_ceil(std::max<size_t>(capacity, 1))),
+      index_mask(this->capacity - 1),
+      events(std::make_unique<TraceEvent[]>(this->capacity)),
+      write_index(0),
+      read_index(0),
+      num_dropped_events(0)
+{
+}
+
+bool TraceRing::push(const TraceEvent& event)
+{
+    // Only this thread writes the write index, so it can be read relaxed
+    const uint64_t write = write_index.load(std::memory_order_relaxed);
+    if (write - read_index.load(std::memory_order_acquire) >= capacity)
+    {
+        num_dropped_events.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    events[write & index_mask] = event;
+    // Publish the event to the draining thread
+    write_index.store(write + 1, std::memory_order_release);
+    return true;
+}
+
+size_t TraceRing::drain(std::vector<TraceEvent>& drained_events)
+{
+    const uint64_t read  = read_index.load(std::memory_order_relaxed);
+    const uint64_t write = write_index.load(std::memory_order_acquire);
+    for (uint64_t index = read; index < write; index++)
+    {
+        drained_events.push_back(events[index & index_mask]);
+    }
+    // Hand the slots back to the writing thread
+    read_index.store(write, std::memory_order_release);
+    return static_cast<size_t>(write - read);
+}
+
+uint64_t TraceRing::numDroppedEvents() const
+{
+    return num_dropped_events.load(std::memory_order_relaxed);
+}
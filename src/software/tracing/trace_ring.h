@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "software/tracing/trace_event.h"
+
+/**
+ * A lock-free ring buffer of TraceEvents, written by a single thread and drained by
+ * a single other thread.
+ *
+ * Recording an event is a store into a preallocated slot and a release store of the
+ * write index, so it never blocks or allocates. If the ring is full the event is
+ * dropped and counted, since stalling the traced thread would distort the timings
+ * being traced.
+ */
+class TraceRing
+{
+   public:
+    /**
+     * Creates a TraceRing
+     *
+     * @param capacity The most events the ring holds, rounded up to a power of two
+     */
+    explicit TraceRing(size_t capacity);
+
+    TraceRing(const TraceRing&)            = delete;
+    TraceRing& operator=(const TraceRing&) = delete;
+
+    /**
+     * Records an event. Must only be called by the thread that owns the ring.
+     *
+     * @param event The event
+     *
+     * @return whether the event was recorded, or dropped because the ring is full
+     */
+    bool push(const TraceEvent& event);
+
+    /**
+     * Moves every recorded event out of the ring. Must only be called by the thread
+     * that drains the ring.
+     *
+     * @param events The events are appended to this, in the order they were recorded
+     *
+     * @return the number of events drained
+     */
+    size_t drain(std::vector<TraceEvent>& events);
+
+    /**
+     * Returns the number of events dropped because the ring was full
+     *
+     * @return the number of dropped events
+     */
+    uint64_t numDroppedEvents() const;
+
+   private:
+    const size_t capacity;
+    const size_t index_mask;
+    std::unique_ptr<TraceEvent[]> events;
+
+    // The indices only ever increase, and are wrapped into the ring with the mask.
+    // They are kept on separate cache lines so the writer and drainer don't contend.
+    alignas(64) std::atomic<uint64_t> write_index;
+    alignas(64) std::atomic<uint64_t> read_index;
+    std::atomic<uint64_t> num_dropped_events;
+};
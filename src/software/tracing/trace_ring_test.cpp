@@ -0,0 +1,81 @@
+#include "software/tracing/trace_ring.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+    TraceEvent valueEvent(double value)
+    {
+        return TraceEvent{.timestamp_ns = 0,
+                          .name         = "value",
+                          .value        = value,
+                          .thread_id    = 1,
+                          .type         = TraceEventType::VALUE};
+    }
+}  // namespace
+
+TEST(TraceRingTest, test_drain_returns_events_in_order)
+{
+    TraceRing ring(4);
+    EXPECT_TRUE(ring.push(valueEvent(1)));
+    EXPECT_TRUE(ring.push(valueEvent(2)));
+
+    std::vector<TraceEvent> events;
+    EXPECT_EQ(ring.drain(events), 2);
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].value, 1);
+    EXPECT_EQ(events[1].value, 2);
+
+    EXPECT_EQ(ring.drain(events), 0);
+    EXPECT_EQ(events.size(), 2);
+}
+
+TEST(TraceRingTest, test_full_ring_drops_events_until_drained)
+{
+    // The capacity is rounded up to 4
+    TraceRing ring(3);
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_TRUE(ring.push(valueEvent(i)));
+    }
+    EXPECT_FALSE(ring.push(valueEvent(4)));
+    EXPECT_EQ(ring.numDroppedEvents(), 1);
+
+    std::vector<TraceEvent> events;
+    EXPECT_EQ(ring.drain(events), 4);
+    EXPECT_TRUE(ring.push(valueEvent(5)));
+    EXPECT_EQ(ring.drain(events), 1);
+    EXPECT_EQ(events.back().value, 5);
+}
+
+TEST(TraceRingTest, test_concurrent_push_and_drain_keeps_order_of_events)
+{
+    constexpr int NUM_EVENTS = 10000;
+    TraceRing ring(64);
+
+    std::thread writer(
+        [&]()
+        {
+            for (int i = 0; i < NUM_EVENTS; i++)
+            {
+                while (!ring.push(valueEvent(i)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+    std::vector<TraceEvent> events;
+    while (events.size() < NUM_EVENTS)
+    {
+        ring.drain(events);
+    }
+    writer.join();
+
+    for (int i = 0; i < NUM_EVENTS; i++)
+    {
+        ASSERT_EQ(events[i].value, i);
+    }
+}
@@ -0,0 +1,180 @@
+#include "software/tracing/tracer.h"
+
+#include <cstddef>
+#include <cstdlib>
+
+std::atomic<bool> Tracer::enabled(false);
+std::mutex Tracer::start_stop_mutex;
+std::mutex Tracer::exporters_mutex;
+std::vector<std::unique_ptr<TraceExporter>> Tracer::trace_exporters;
+std::vector<TraceEvent> Tracer::drained_events;
+std::mutex Tracer::rings_mutex;
+std::vector<std::shared_ptr<TraceRing>> Tracer::rings;
+uint64_t Tracer::num_dropped_events_from_exited_threads = 0;
+std::mutex Tracer::drain_thread_mutex;
+std::condition_variable Tracer::drain_thread_cv;
+bool Tracer::stop_drain_thread = false;
+std::thread Tracer::drain_thread;
+
+namespace
+{
+    // The ring and id of each thread. The registry shares ownership of the ring so
+    // the events of a thread that exits are still drained.
+    thread_local std::shared_ptr<TraceRing> thread_ring;
+    thread_local uint32_t thread_id = 0;
+    std::atomic<uint32_t> next_thread_id(1);
+}  // namespace
+
+void Tracer::start(std::vector<std::unique_ptr<TraceExporter>> exporters)
+{
+    std::scoped_lock start_stop_lock(start_stop_mutex);
+    if (enabled.load())
+    {
+        return;
+    }
+
+    {
+        std::scoped_lock exporters_and_rings_lock(exporters_mutex, rings_mutex);
+        // Discard anything recorded while tracing was stopping the last time
+        drained_events.clear();
+        for (auto& ring : rings)
+        {
+            ring->drain(drained_events);
+        }
+        drained_events.clear();
+        trace_exporters = std::move(exporters);
+    }
+
+    {
+        std::scoped_lock drain_thread_lock(drain_thread_mutex);
+        stop_drain_thread = false;
+    }
+    drain_thread = std::thread(&Tracer::drainRings);
+    enabled.store(true);
+
+    // Flush the exporters and join the drain thread if the program exits while tracing
+    [[maybe_unused]] static const int stop_at_exit = std::atexit([]() { stop(); });
+}
+
+void Tracer::stop()
+{
+    std::scoped_lock start_stop_lock(start_stop_mutex);
+    if (!enabled.load())
+    {
+        return;
+    }
+    enabled.store(false);
+
+    {
+        std::scoped_lock drain_thread_lock(drain_thread_mutex);
+        stop_drain_thread = true;
+    }
+    drain_thread_cv.notify_one();
+    drain_thread.join();
+
+    drainAndExport();
+    std::scoped_lock exporters_lock(exporters_mutex);
+    for (auto& exporter : trace_exporters)
+    {
+        exporter->flush();
+    }
+    trace_exporters.clear();
+}
+
+uint64_t Tracer::numDroppedEvents()
+{
+    std::scoped_lock rings_lock(rings_mutex);
+    uint64_t num_dropped_events = num_dropped_events_from_exited_threads;
+    for (const auto& ring : rings)
+    {
+        num_dropped_events += ring->numDroppedEvents();
+    }
+    return num_dropped_events;
+}
+
+void Tracer::record(TraceEventType type, const char* name, double value)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    const int64_t timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count();
+    TraceRing& ring = threadRing();
+    ring.push(TraceEvent{.timestamp_ns = timestamp_ns,
+                         .name         = name,
+                         .value        = value,
+                         .thread_id    = thread_id,
+                         .type         = type});
+}
+
+TraceRing& Tracer::threadRing()
+{
+    if (!thread_ring)
+    {
+        thread_ring = std::make_shared<TraceRing>(RING_CAPACITY);
+        thread_id   = next_thread_id.fetch_add(1);
+
+        std::scoped_lock rings_lock(rings_mutex);
+        rings.push_back(thread_ring);
+    }
+    return *thread_ring;
+}
+
+void Tracer::drainAndExport()
+{
+    std::scoped_lock exporters_lock(exporters_mutex);
+    drained_events.clear();
+
+    {
+        std::scoped_lock rings_lock(rings_mutex);
+
+        // A ring only owned by the registry belongs to a thread that exited, so it can
+        // be removed once it's drained. This must be checked before draining so no
+        // events are recorded after the last drain.
+        std::vector<bool> thread_exited(rings.size());
+        for (size_t i = 0; i < rings.size(); i++)
+        {
+            thread_exited[i] = rings[i].use_count() == 1;
+        }
+
+        for (auto& ring : rings)
+        {
+            ring->drain(drained_events);
+        }
+
+        for (size_t i = rings.size(); i-- > 0;)
+        {
+            if (thread_exited[i])
+            {
+                num_dropped_events_from_exited_threads += rings[i]->numDroppedEvents();
+                rings.erase(rings.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+        }
+    }
+
+    // Threads recording their first event can register their rings while exporting
+    if (drained_events.empty())
+    {
+        return;
+    }
+    for (auto& exporter : trace_exporters)
+    {
+        exporter->exportEvents(drained_events);
+    }
+}
+
+void Tracer::drainRings()
+{
+    std::unique_lock drain_thread_lock(drain_thread_mutex);
+    while (!stop_drain_thread)
+    {
+        drain_thread_cv.wait_for(drain_thread_lock, DRAIN_PERIOD,
+                                 []() { return stop_drain_thread; });
+        drain_thread_lock.unlock();
+        drainAndExport();
+        drain_thread_lock.lock();
+    }
+}
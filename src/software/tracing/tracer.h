@@ -0,0 +1,202 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "software/tracing/trace_exporter.h"
+#include "software/tracing/trace_ring.h"
+
+/**
+ * Records fixed-size binary TraceEvents from hot paths with low enough overhead to
+ * leave tracing on in competition builds.
+ *
+ * Every thread records into its own lock-free TraceRing, so recording doesn't take a
+ * lock, except for the first event of each thread, which allocates and registers the
+ * ring of the thread. A background thread periodically drains the rings of all
+ * threads and hands the events to the TraceExporters, without holding the lock that
+ * registering rings takes. When tracing is not started, recording is a single relaxed
+ * atomic load.
+ *
+ * Event names must be string literals, since only pointers to them are recorded.
+ */
+class Tracer
+{
+   public:
+    /**
+     * Starts tracing. Does nothing if tracing has already started.
+     *
+     * @param exporters The exporters to export the traced events to
+     */
+    static void start(std::vector<std::unique_ptr<TraceExporter>> exporters);
+
+    /**
+     * Stops tracing, exporting and flushing every event recorded before it stopped
+     */
+    static void stop();
+
+    /**
+     * Returns whether tracing has started
+     *
+     * @return whether tracing has started
+     */
+    static bool isEnabled()
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Records that a zone of code started running on this thread
+     *
+     * @param name The name of the zone
+     */
+    static void zoneBegin(const char* name)
+    {
+        record(TraceEventType::ZONE_BEGIN, name, 0.0);
+    }
+
+    /**
+     * Records that a zone of code finished running on this thread
+     *
+     * @param name The name of the zone
+     */
+    static void zoneEnd(const char* name)
+    {
+        record(TraceEventType::ZONE_END, name, 0.0);
+    }
+
+    /**
+     * Records that a count was incremented
+     *
+     * @param name The name of the count
+     * @param increment How much the count was incremented by
+     */
+    static void counter(const char* name, double increment = 1.0)
+    {
+        record(TraceEventType::COUNTER, name, increment);
+    }
+
+    /**
+     * Records a measured quantity
+     *
+     * @param name The name of the quantity
+     * @param value The measured value
+     */
+    static void value(const char* name, double value)
+    {
+        record(TraceEventType::VALUE, name, value);
+    }
+
+    /**
+     * Returns the number of events dropped because a thread recorded them faster than
+     * they could be drained
+     *
+     * @return the number of dropped events
+     */
+    static uint64_t numDroppedEvents();
+
+    // The number of events each thread's ring holds
+    static constexpr size_t RING_CAPACITY = 1 << 14;
+    // How often the rings are drained
+    static constexpr std::chrono::milliseconds DRAIN_PERIOD{10};
+
+   private:
+    /**
+     * Records an event on this thread's ring if tracing has started
+     *
+     * @param type The type of event
+     * @param name The name of the event
+     * @param value The value of the event
+     */
+    static void record(TraceEventType type, const char* name, double value);
+
+    /**
+     * Returns the ring of this thread, creating and registering it the first time
+     * this thread records an event
+     *
+     * @return the ring of this thread
+     */
+    static TraceRing& threadRing();
+
+    /**
+     * Drains the rings of all threads and exports the events
+     */
+    static void drainAndExport();
+
+    /**
+     * Periodically drains the rings until tracing stops
+     */
+    static void drainRings();
+
+    static std::atomic<bool> enabled;
+
+    // Serializes starting and stopping tracing
+    static std::mutex start_stop_mutex;
+
+    // Guards the exporters and the events being exported. Taken before rings_mutex.
+    static std::mutex exporters_mutex;
+    static std::vector<std::unique_ptr<TraceExporter>> trace_exporters;
+    static std::vector<TraceEvent> drained_events;
+
+    // Guards registering and draining rings, which recording threads wait for, so it's
+    // never held while exporting
+    static std::mutex rings_mutex;
+    static std::vector<std::shared_ptr<TraceRing>> rings;
+    static uint64_t num_dropped_events_from_exited_threads;
+
+    static std::mutex drain_thread_mutex;
+    static std::condition_variable drain_thread_cv;
+    static bool stop_drain_thread;
+    static std::thread drain_thread;
+};
+
+/**
+ * Traces a zone of code for as long as it is in scope
+ */
+class TraceZone
+{
+   public:
+    /**
+     * Begins tracing a zone
+     *
+     * @param name The name of the zone, which must be a string literal
+     */
+    explicit TraceZone(const char* name) : name(name), active(Tracer::isEnabled())
+    {
+        if (active)
+        {
+            Tracer::zoneBegin(name);
+        }
+    }
+
+    ~TraceZone()
+    {
+        if (active)
+        {
+            Tracer::zoneEnd(name);
+        }
+    }
+
+    TraceZone(const TraceZone&)            = delete;
+    TraceZone& operator=(const TraceZone&) = delete;
+
+   private:
+    const char* name;
+    // Whether the beginning of the zone was recorded, so the end is only recorded
+    // if it has a matching beginning
+    bool active;
+};
+
+#define TRACE_CONCATENATE_IMPL(a, b) a##b
+#define TRACE_CONCATENATE(a, b) TRACE_CONCATENATE_IMPL(a, b)
+
+// Traces the rest of the current scope as a zone with the given name
+#define TRACE_ZONE(name) TraceZone TRACE_CONCATENATE(trace_zone_, __LINE__)(name)
+// Records a measured quantity with the given name
+#define TRACE_VALUE(name, measured_value) Tracer::value(name, measured_value)
+// Increments the count with the given name
+#define TRACE_COUNTER(name, count_increment) Tracer::counter(name, count_increment)
@@ -0,0 +1,182 @@
+#include "software/tracing/tracer.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <future>
+
+namespace
+{
+    /**
+     * Records the events it exports so tests can inspect them
+     */
+    class RecordingTraceExporter : public TraceExporter
+    {
+       public:
+        RecordingTraceExporter(std::vector<TraceEvent>& events, bool& flushed)
+            : events(events), flushed(flushed)
+        {
+        }
+
+        void exportEvents(const std::vector<TraceEvent>& drained_events) override
+        {
+            events.insert(events.end(), drained_events.begin(), drained_events.end());
+        }
+
+        void flush() override
+        {
+            flushed = true;
+        }
+
+       private:
+        std::vector<TraceEvent>& events;
+        bool& flushed;
+    };
+
+    /**
+     * Blocks in exportEvents until it's unblocked, to test what happens while events
+     * are being exported
+     */
+    class BlockingTraceExporter : public TraceExporter
+    {
+       public:
+        BlockingTraceExporter(std::promise<void>& exporting,
+                              std::shared_future<void> unblocked)
+            : exporting(exporting), unblocked(std::move(unblocked)), started(false)
+        {
+        }
+
+        void exportEvents(const std::vector<TraceEvent>&) override
+        {
+            if (!started)
+            {
+                started = true;
+                exporting.set_value();
+            }
+            unblocked.wait();
+        }
+
+        void flush() override {}
+
+       private:
+        std::promise<void>& exporting;
+        std::shared_future<void> unblocked;
+        bool started;
+    };
+
+    std::vector<std::unique_ptr<TraceExporter>> recordingExporters(
+        std::vector<TraceEvent>& events, bool& flushed)
+    {
+        std::vector<std::unique_ptr<TraceExporter>> exporters;
+        exporters.push_back(std::make_unique<RecordingTraceExporter>(events, flushed));
+        return exporters;
+    }
+
+    std::vector<TraceEvent>::const_iterator findEvent(
+        const std::vector<TraceEvent>& events, const std::string& name)
+    {
+        return std::find_if(events.begin(), events.end(), [&](const TraceEvent& event)
+                            { return event.name == name; });
+    }
+}  // namespace
+
+TEST(TracerTest, test_nothing_is_recorded_when_tracing_is_stopped)
+{
+    ASSERT_FALSE(Tracer::isEnabled());
+    {
+        TRACE_ZONE("stopped zone");
+        TRACE_VALUE("stopped value", 1.0);
+    }
+
+    std::vector<TraceEvent> events;
+    bool flushed = false;
+    Tracer::start(recordingExporters(events, flushed));
+    Tracer::stop();
+
+    EXPECT_TRUE(flushed);
+    EXPECT_TRUE(events.empty());
+}
+
+TEST(TracerTest, test_events_of_all_threads_are_exported)
+{
+    std::vector<TraceEvent> events;
+    bool flushed = false;
+    Tracer::start(recordingExporters(events, flushed));
+    EXPECT_TRUE(Tracer::isEnabled());
+
+    {
+        TRACE_ZONE("main zone");
+        TRACE_COUNTER("main counter", 2.0);
+    }
+    // This thread exits before tracing stops, but its events are still exported
+    std::thread worker(
+        [&]()
+        {
+            TRACE_ZONE("worker zone");
+            TRACE_VALUE("worker value", 3.0);
+        });
+    worker.join();
+
+    Tracer::stop();
+    EXPECT_FALSE(Tracer::isEnabled());
+    EXPECT_TRUE(flushed);
+
+    ASSERT_EQ(events.size(), 6);
+    auto main_zone_begin = findEvent(events, "main zone");
+    ASSERT_NE(main_zone_begin, events.end());
+    EXPECT_EQ((main_zone_begin + 1)->type, TraceEventType::COUNTER);
+    EXPECT_EQ((main_zone_begin + 1)->value, 2.0);
+    EXPECT_EQ((main_zone_begin + 2)->type, TraceEventType::ZONE_END);
+    EXPECT_GE((main_zone_begin + 2)->timestamp_ns, main_zone_begin->timestamp_ns);
+
+    auto worker_value = findEvent(events, "worker value");
+    ASSERT_NE(worker_value, events.end());
+    EXPECT_EQ(worker_value->value, 3.0);
+    EXPECT_NE(worker_value->thread_id, main_zone_begin->thread_id);
+    EXPECT_EQ(Tracer::numDroppedEvents(), 0);
+}
+
+TEST(TracerTest, test_events_are_drained_while_tracing)
+{
+    std::vector<TraceEvent> events;
+    bool flushed                      = false;
+    const uint64_t num_dropped_events = Tracer::numDroppedEvents();
+    Tracer::start(recordingExporters(events, flushed));
+
+    // Record more events than a ring holds, slowly enough for them to be drained
+    for (size_t i = 0; i < Tracer::RING_CAPACITY * 2; i++)
+    {
+        TRACE_VALUE("value", static_cast<double>(i));
+        if (i % (Tracer::RING_CAPACITY / 4) == 0)
+        {
+            std::this_thread::sleep_for(Tracer::DRAIN_PERIOD * 3);
+        }
+    }
+
+    Tracer::stop();
+    EXPECT_EQ(events.size() + Tracer::numDroppedEvents() - num_dropped_events,
+              Tracer::RING_CAPACITY * 2);
+    EXPECT_GT(events.size(), Tracer::RING_CAPACITY);
+}
+
+TEST(TracerTest, test_threads_start_recording_while_events_are_exported)
+{
+    std::promise<void> exporting;
+    std::promise<void> unblock;
+    std::vector<std::unique_ptr<TraceExporter>> exporters;
+    exporters.push_back(std::make_unique<BlockingTraceExporter>(
+        exporting, unblock.get_future().share()));
+    Tracer::start(std::move(exporters));
+
+    TRACE_VALUE("main value", 1.0);
+    exporting.get_future().wait();
+
+    // The first event of a new thread registers its ring while the exporter is blocked
+    std::future<void> recorded = std::async(std::launch::async,
+                                            []() { TRACE_VALUE("worker value", 2.0); });
+    EXPECT_EQ(recorded.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    unblock.set_value();
+    recorded.wait();
+    Tracer::stop();
+}
@@ -0,0 +1,34 @@
+#include "software/tracing/tracy_trace_exporter.h"
+
+#include <Tracy.hpp>
+
+void TracyTraceExporter::exportEvents(const std::vector<TraceEvent>& events)
+{
+    for (const TraceEvent& event : events)
+    {
+        switch (event.type)
+        {
+            case TraceEventType::ZONE_BEGIN:
+            case TraceEventType::ZONE_END:
+            {
+                if (auto zone_duration_ms = zone_timer.update(event))
+                {
+                    TracyPlot(event.name, *zone_duration_ms);
+                }
+                break;
+            }
+            case TraceEventType::COUNTER:
+            {
+                [[maybe_unused]] double counter_total =
+                    counter_totals[event.name] += event.value;
+                TracyPlot(event.name, counter_total);
+                break;
+            }
+            case TraceEventType::VALUE:
+            {
+                TracyPlot(event.name, event.value);
+                break;
+            }
+        }
+    }
+}
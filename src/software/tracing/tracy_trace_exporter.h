@@ -0,0 +1,22 @@
+#pragma once
+
+#include <unordered_map>
+
+#include "software/tracing/trace_exporter.h"
+
+/**
+ * Exports traced events to Tracy as plots.
+ *
+ * Tracy can't be told about zones after they've run, so each zone is plotted as
+ * how long it took in milliseconds. Values are plotted as they were measured, and
+ * counters are plotted as their running totals.
+ */
+class TracyTraceExporter : public TraceExporter
+{
+   public:
+    void exportEvents(const std::vector<TraceEvent>& events) override;
+
+   private:
+    TraceZoneTimer zone_timer;
+    std::unordered_map<const char*, double> counter_totals;
+};
@@ -4,4 +4,6 @@ struct TracyConstants
 {
     static constexpr const char* AI_FRAME_MARKER = "AI: Primitive Processing Frame";
     static constexpr const char* THUNDERLOOP_FRAME_MARKER = "Thunderloop: tick";
+    static constexpr const char* SENSOR_FUSION_PUBLISH_LATENCY_PLOT =
+        "Sensor Fusion: publish latency (ms)";
 };
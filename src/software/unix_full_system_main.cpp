@@ -20,6 +20,10 @@
 #include "software/networking/udp/threaded_proto_udp_listener.hpp"
 #include "software/networking/unix/threaded_proto_unix_listener.hpp"
 #include "software/sensor_fusion/threaded_sensor_fusion.h"
+#include "software/tracing/file_trace_exporter.h"
+#include "software/tracing/plotjuggler_trace_exporter.h"
+#include "software/tracing/tracer.h"
+#include "software/tracing/tracy_trace_exporter.h"
 #include "software/util/generic_factory/generic_factory.h"
 
 // ProtoLogger has to be defined as a global variable so that it can be accessed by the
@@ -41,6 +45,7 @@ void cleanup(int signal_num)
     {
         proto_logger->flushAndStopLogging();
     }
+    Tracer::stop();
 
     // Program has cleaned up core resources, so we can safely exit
     exit(0);
@@ -83,6 +88,7 @@ int main(int argc, char** argv)
         bool friendly_colour_yellow = false;
         bool ci                     = false;
         std::string log_level       = "DEBUG";
+        bool enable_tracing         = false;
     };
 
     CommandLineArgs args;
@@ -102,6 +108,10 @@ int main(int argc, char** argv)
     desc.add_options()(
         "log_level", boost::program_options::value<std::string>(&args.log_level),
         "The minimum g3log level that will be printed (DEBUG|INFO|WARNING|FATAL)");
+    desc.add_options()(
+        "enable_tracing", boost::program_options::bool_switch(&args.enable_tracing),
+        "If true, the planner, pass generator and sensor fusion are traced to Tracy, "
+        "PlotJuggler and a trace file in the runtime directory");
 
     boost::program_options::variables_map vm;
     boost::program_options::store(parse_command_line(argc, argv, desc), vm);
@@ -153,6 +163,17 @@ int main(int argc, char** argv)
                                                      args.friendly_colour_yellow);
         LoggerSingleton::initializeLogger(args.runtime_dir, proto_logger, true,
                                           *minimum_log_level);
+
+        if (args.enable_tracing)
+        {
+            std::vector<std::unique_ptr<TraceExporter>> trace_exporters;
+            trace_exporters.push_back(std::make_unique<FileTraceExporter>(
+                args.runtime_dir + FULL_SYSTEM_TRACE_FILE_PATH));
+            trace_exporters.push_back(std::make_unique<PlotJugglerTraceExporter>(
+                std::make_shared<PlotJugglerSink>()));
+            trace_exporters.push_back(std::make_unique<TracyTraceExporter>());
+            Tracer::start(std::move(trace_exporters));
+        }
         TbotsProto::ThunderbotsConfig tbots_proto;
 
         // Override friendly color
@@ -0,0 +1,104 @@
+#include "software/util/binary_encoding/binary_encoding.h"
+
+#include <cstring>
+
+void appendVarint(uint64_t value, std::string& output)
+{
+    while (value >= 0x80)
+    {
+        output.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    output.push_back(static_cast<char>(value));
+}
+
+void appendSignedVarint(int64_t value, std::string& output)
+{
+    appendVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63),
+                 output);
+}
+
+void appendUint64(uint64_t value, std::string& output)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        output.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+void appendDouble(double value, std::string& output)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    appendUint64(bits, output);
+}
+
+void appendString(std::string_view value, std::string& output)
+{
+    appendVarint(value.size(), output);
+    output.append(value);
+}
+
+std::optional<uint64_t> readVarint(std::string_view data, size_t& offset)
+{
+    uint64_t value = 0;
+    for (unsigned int shift = 0; shift < 64 && offset < data.size(); shift += 7)
+    {
+        auto byte = static_cast<uint8_t>(data[offset++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return value;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<int64_t> readSignedVarint(std::string_view data, size_t& offset)
+{
+    std::optional<uint64_t> value = readVarint(data, offset);
+    if (!value)
+    {
+        return std::nullopt;
+    }
+    return static_cast<int64_t>((*value >> 1) ^ (~(*value & 1) + 1));
+}
+
+std::optional<uint64_t> readUint64(std::string_view data, size_t& offset)
+{
+    if (data.size() - offset < 8)
+    {
+        return std::nullopt;
+    }
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        value |= static_cast<uint64_t>(static_cast<uint8_t>(data[offset++]))
+                 << (8 * i);
+    }
+    return value;
+}
+
+std::optional<double> readDouble(std::string_view data, size_t& offset)
+{
+    std::optional<uint64_t> bits = readUint64(data, offset);
+    if (!bits)
+    {
+        return std::nullopt;
+    }
+    double value;
+    std::memcpy(&value, &*bits, sizeof(value));
+    return value;
+}
+
+std::optional<std::string_view> readString(std::string_view data, size_t& offset)
+{
+    std::optional<uint64_t> length = readVarint(data, offset);
+    if (!length || *length > data.size() - offset)
+    {
+        return std::nullopt;
+    }
+    std::string_view value = data.substr(offset, *length);
+    offset += *length;
+    return value;
+}
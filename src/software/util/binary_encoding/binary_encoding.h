@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/**
+ * Helpers for compact binary file formats. Multi-byte integers are written little
+ * endian so files can be read on any platform.
+ */
+
+/**
+ * Appends an unsigned integer as a LEB128 varint
+ *
+ * @param value The integer
+ * @param output The string to append to
+ */
+void appendVarint(uint64_t value, std::string& output);
+
+/**
+ * Appends a signed integer as a zigzag encoded LEB128 varint, so integers close to
+ * zero are short whether they are positive or negative
+ *
+ * @param value The integer
+ * @param output The string to append to
+ */
+void appendSignedVarint(int64_t value, std::string& output);
+
+/**
+ * Appends an unsigned integer as 8 little endian bytes
+ *
+ * @param value The integer
+ * @param output The string to append to
+ */
+void appendUint64(uint64_t value, std::string& output);
+
+/**
+ * Appends a double as the 8 little endian bytes of its IEEE 754 representation
+ *
+ * @param value The double
+ * @param output The string to append to
+ */
+void appendDouble(double value, std::string& output);
+
+/**
+ * Appends a string prefixed by its varint length
+ *
+ * @param value The string
+ * @param output The string to append to
+ */
+void appendString(std::string_view value, std::string& output);
+
+/**
+ * Reads a LEB128 varint
+ *
+ * @param data The data to read from
+ * @param offset The offset to read at, which is moved past the varint
+ *
+ * @return the integer, or std::nullopt if the data ends before the varint does
+ */
+std::optional<uint64_t> readVarint(std::string_view data, size_t& offset);
+
+/**
+ * Reads a zigzag encoded LEB128 varint
+ *
+ * @param data The data to read from
+ * @param offset The offset to read at, which is moved past the varint
+ *
+ * @return the integer, or std::nullopt if the data ends before the varint does
+ */
+std::optional<int64_t> readSignedVarint(std::string_view data, size_t& offset);
+
+/**
+ * Reads 8 little endian bytes as an unsigned integer
+ *
+ * @param data The data to read from
+ * @param offset The offset to read at, which is moved past the integer
+ *
+ * @return the integer, or std::nullopt if the data ends before the integer does
+ */
+std::optional<uint64_t> readUint64(std::string_view data, size_t& offset);
+
+/**
+ * Reads 8 little endian bytes as a double
+ *
+ * @param data The data to read from
+ * @param offset The offset to read at, which is moved past the double
+ *
+ * @return the double, or std::nullopt if the data ends before the double does
+ */
+std::optional<double> readDouble(std::string_view data, size_t& offset);
+
+/**
+ * Reads a string prefixed by its varint length
+ *
+ * @param data The data to read from
+ * @param offset The offset to read at, which is moved past the string
+ *
+ * @return a view of the string in the data, or std::nullopt if the data ends before
+ * the string does
+ */
+std::optional<std::string_view> readString(std::string_view data, size_t& offset);
@@ -0,0 +1,68 @@
+#include "software/util/binary_encoding/binary_encoding.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+TEST(BinaryEncodingTest, test_varints_round_trip)
+{
+    std::string data;
+    appendVarint(0, data);
+    appendVarint(127, data);
+    appendVarint(128, data);
+    appendVarint(std::numeric_limits<uint64_t>::max(), data);
+    EXPECT_EQ(data.size(), 1 + 1 + 2 + 10);
+
+    size_t offset = 0;
+    EXPECT_EQ(readVarint(data, offset), 0);
+    EXPECT_EQ(readVarint(data, offset), 127);
+    EXPECT_EQ(readVarint(data, offset), 128);
+    EXPECT_EQ(readVarint(data, offset), std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(offset, data.size());
+    EXPECT_EQ(readVarint(data, offset), std::nullopt);
+}
+
+TEST(BinaryEncodingTest, test_signed_varints_round_trip_and_small_values_are_short)
+{
+    std::string data;
+    appendSignedVarint(-1, data);
+    appendSignedVarint(63, data);
+    appendSignedVarint(-64, data);
+    EXPECT_EQ(data.size(), 3);
+    appendSignedVarint(std::numeric_limits<int64_t>::min(), data);
+    appendSignedVarint(std::numeric_limits<int64_t>::max(), data);
+
+    size_t offset = 0;
+    EXPECT_EQ(readSignedVarint(data, offset), -1);
+    EXPECT_EQ(readSignedVarint(data, offset), 63);
+    EXPECT_EQ(readSignedVarint(data, offset), -64);
+    EXPECT_EQ(readSignedVarint(data, offset), std::numeric_limits<int64_t>::min());
+    EXPECT_EQ(readSignedVarint(data, offset), std::numeric_limits<int64_t>::max());
+    EXPECT_EQ(offset, data.size());
+}
+
+TEST(BinaryEncodingTest, test_doubles_and_strings_round_trip)
+{
+    std::string data;
+    appendDouble(-1.5, data);
+    appendString("hello", data);
+    appendUint64(0x0102030405060708, data);
+    EXPECT_EQ(data[8], 5);
+    EXPECT_EQ(data[data.size() - 1], 0x01);
+
+    size_t offset = 0;
+    EXPECT_EQ(readDouble(data, offset), -1.5);
+    EXPECT_EQ(readString(data, offset), "hello");
+    EXPECT_EQ(readUint64(data, offset), 0x0102030405060708u);
+    EXPECT_EQ(readDouble(data, offset), std::nullopt);
+}
+
+TEST(BinaryEncodingTest, test_truncated_string_is_not_read)
+{
+    std::string data;
+    appendString("hello", data);
+    data.pop_back();
+
+    size_t offset = 0;
+    EXPECT_EQ(readString(data, offset), std::nullopt);
+}
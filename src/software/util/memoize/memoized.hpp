@@ -0,0 +1,68 @@
+#pragma once
+
+#include <optional>
+#include <tuple>
+#include <utility>
+
+/**
+ * Remembers the result of the last computation, so it can be reused while the inputs of
+ * the computation stay the same.
+ *
+ * The inputs are identified by keys, which are usually the generations of the
+ * Versioned World components the computation depends on (e.g.
+ * World::enemyTeamGeneration) along with any other arguments. Because generations
+ * change whenever their component does, the result is recomputed exactly when one of
+ * the components it depends on changed.
+ *
+ * Only the most recent result is kept, which is all that is needed to reuse results
+ * between ticks of the AI. Memoized is not thread safe; share it between threads only
+ * behind a lock, or keep one per thread.
+ *
+ * @tparam Result The type of the result of the computation
+ * @tparam Keys The types of the keys identifying the inputs of the computation, which
+ * must be equality comparable
+ */
+template <typename Result, typename... Keys>
+class Memoized
+{
+   public:
+    /**
+     * Gets the result of the computation for the given keys, only computing it if the
+     * keys are different to the ones the last result was computed for
+     *
+     * @param keys The keys identifying the inputs of the computation
+     * @param compute A function that takes no arguments and computes the result
+     *
+     * @return the result, which is valid until the next call to get or clear
+     */
+    template <typename ComputeFunction>
+    const Result& get(const Keys&... keys, ComputeFunction&& compute);
+
+    /**
+     * Forgets the last result, so the next call to get computes it again
+     */
+    void clear();
+
+   private:
+    // The keys the last result was computed for, and the result
+    std::optional<std::pair<std::tuple<Keys...>, Result>> entry_;
+};
+
+template <typename Result, typename... Keys>
+template <typename ComputeFunction>
+const Result& Memoized<Result, Keys...>::get(const Keys&... keys,
+                                             ComputeFunction&& compute)
+{
+    if (!entry_ || !(entry_->first == std::tie(keys...)))
+    {
+        entry_.reset();
+        entry_.emplace(std::tuple<Keys...>(keys...), compute());
+    }
+    return entry_->second;
+}
+
+template <typename Result, typename... Keys>
+void Memoized<Result, Keys...>::clear()
+{
+    entry_.reset();
+}
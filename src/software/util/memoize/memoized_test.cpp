@@ -0,0 +1,49 @@
+#include "software/util/memoize/memoized.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(MemoizedTest, result_is_reused_while_the_keys_are_the_same)
+{
+    Memoized<std::string, uint64_t, bool> memoized;
+    int num_computations = 0;
+    auto compute         = [&]()
+    {
+        num_computations++;
+        return std::to_string(num_computations);
+    };
+
+    EXPECT_EQ("1", memoized.get(1, true, compute));
+    EXPECT_EQ("1", memoized.get(1, true, compute));
+    EXPECT_EQ(1, num_computations);
+}
+
+TEST(MemoizedTest, result_is_recomputed_when_any_key_changes)
+{
+    Memoized<std::string, uint64_t, bool> memoized;
+    int num_computations = 0;
+    auto compute         = [&]()
+    {
+        num_computations++;
+        return std::to_string(num_computations);
+    };
+
+    EXPECT_EQ("1", memoized.get(1, true, compute));
+    EXPECT_EQ("2", memoized.get(2, true, compute));
+    EXPECT_EQ("3", memoized.get(2, false, compute));
+    // Only the most recent result is remembered
+    EXPECT_EQ("4", memoized.get(1, true, compute));
+    EXPECT_EQ(4, num_computations);
+}
+
+TEST(MemoizedTest, clear_forgets_the_result)
+{
+    Memoized<int, uint64_t> memoized;
+    int num_computations = 0;
+    auto compute         = [&]() { return ++num_computations; };
+
+    EXPECT_EQ(1, memoized.get(1, compute));
+    memoized.clear();
+    EXPECT_EQ(2, memoized.get(1, compute));
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * Returns a generation that has never been returned before. Generations are shared by
+ * every type of Versioned, so they are unique across all of them.
+ *
+ * @return the next generation
+ */
+inline uint64_t nextVersionedGeneration()
+{
+    static std::atomic<uint64_t> next_generation(1);
+    return next_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * A value that is shared between copies until one of them changes it, with a
+ * generation that identifies the value.
+ *
+ * Copying a Versioned only copies a pointer to the value, so copies of large values
+ * that rarely change (e.g. the Field) are cheap. The value is copied whenever it is
+ * modified, so a value is never written after it has been shared, and copies can be
+ * read on other threads (e.g. the AI reading a World from sensor fusion) without
+ * synchronizing with the thread that modifies the Versioned.
+ *
+ * Every time a value is set or modified it gets a new generation. Generations are
+ * unique across every Versioned of every type and only ever increase, so two
+ * Versioneds with the same generation are guaranteed to hold the same value, and
+ * consumers can skip recomputing results that depend only on values whose generations
+ * haven't changed.
+ *
+ * @tparam T The type of the value
+ */
+template <typename T>
+class Versioned
+{
+   public:
+    /**
+     * Creates a Versioned holding the given value, with a new generation
+     *
+     * @param value The value
+     */
+    explicit Versioned(T value = T());
+
+    /**
+     * Gets the value
+     *
+     * @return the value
+     */
+    const T& get() const;
+
+    /**
+     * Gets the generation of the value
+     *
+     * @return the generation of the value
+     */
+    uint64_t generation() const;
+
+    /**
+     * Replaces the value, giving it a new generation. Copies that shared the old value
+     * keep it.
+     *
+     * @param value The new value
+     */
+    void set(T value);
+
+    /**
+     * Gets a copy of the value to modify, giving it a new generation. The value is
+     * always copied, even if no other copy seems to share it, since a copy released on
+     * another thread may still be reading it.
+     *
+     * @return the value, which may be modified until this Versioned is next copied
+     */
+    T& modify();
+
+    /**
+     * Changes the value, giving it a new generation only if the change made it
+     * different, so consumers don't recompute results for changes that did nothing.
+     * Requires T to be equality comparable.
+     *
+     * @param change A function that changes the value it is given
+     */
+    template <typename ChangeFunction>
+    void update(ChangeFunction&& change);
+
+    /**
+     * Accesses the value, like get()
+     */
+    const T& operator*() const;
+    const T* operator->() const;
+
+   private:
+    std::shared_ptr<T> value_;
+    uint64_t generation_;
+};
+
+template <typename T>
+Versioned<T>::Versioned(T value)
+    : value_(std::make_shared<T>(std::move(value))),
+      generation_(nextVersionedGeneration())
+{
+}
+
+template <typename T>
+const T& Versioned<T>::get() const
+{
+    return *value_;
+}
+
+template <typename T>
+uint64_t Versioned<T>::generation() const
+{
+    return generation_;
+}
+
+template <typename T>
+void Versioned<T>::set(T value)
+{
+    value_      = std::make_shared<T>(std::move(value));
+    generation_ = nextVersionedGeneration();
+}
+
+template <typename T>
+T& Versioned<T>::modify()
+{
+    value_      = std::make_shared<T>(*value_);
+    generation_ = nextVersionedGeneration();
+    return *value_;
+}
+
+template <typename T>
+template <typename ChangeFunction>
+void Versioned<T>::update(ChangeFunction&& change)
+{
+    T value = *value_;
+    change(value);
+    if (!(value == *value_))
+    {
+        set(std::move(value));
+    }
+}
+
+template <typename T>
+const T& Versioned<T>::operator*() const
+{
+    return *value_;
+}
+
+template <typename T>
+const T* Versioned<T>::operator->() const
+{
+    return value_.get();
+}
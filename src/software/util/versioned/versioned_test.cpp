@@ -0,0 +1,83 @@
+#include "software/util/versioned/versioned.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST(VersionedTest, copies_share_the_value_and_generation)
+{
+    Versioned<std::vector<int>> versioned({1, 2, 3});
+    Versioned<std::vector<int>> copy = versioned;
+
+    EXPECT_EQ(&versioned.get(), &copy.get());
+    EXPECT_EQ(versioned.generation(), copy.generation());
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), *copy);
+}
+
+TEST(VersionedTest, modifying_a_copy_does_not_change_the_original)
+{
+    Versioned<std::vector<int>> versioned({1, 2, 3});
+    Versioned<std::vector<int>> copy = versioned;
+
+    copy.modify().push_back(4);
+
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), versioned.get());
+    EXPECT_EQ(std::vector<int>({1, 2, 3, 4}), copy.get());
+    EXPECT_GT(copy.generation(), versioned.generation());
+}
+
+TEST(VersionedTest, modifying_a_value_that_is_no_longer_shared_still_copies_it)
+{
+    Versioned<std::vector<int>> versioned({1, 2, 3});
+    auto copy = std::make_unique<Versioned<std::vector<int>>>(versioned);
+
+    const std::vector<int>* value = &versioned.get();
+    uint64_t generation           = versioned.generation();
+    copy.reset();
+
+    versioned.modify().push_back(4);
+
+    EXPECT_NE(value, &versioned.get());
+    EXPECT_EQ(std::vector<int>({1, 2, 3, 4}), versioned.get());
+    EXPECT_GT(versioned.generation(), generation);
+}
+
+TEST(VersionedTest, setting_a_value_gives_it_a_new_generation)
+{
+    Versioned<std::string> versioned("a");
+    Versioned<std::string> copy = versioned;
+
+    versioned.set("b");
+
+    EXPECT_EQ("b", *versioned);
+    EXPECT_EQ("a", *copy);
+    EXPECT_GT(versioned.generation(), copy.generation());
+}
+
+TEST(VersionedTest, updates_that_change_nothing_keep_the_generation)
+{
+    Versioned<std::vector<int>> versioned({1, 2, 3});
+    Versioned<std::vector<int>> copy = versioned;
+
+    copy.update([](std::vector<int>& value) { value[0] = 1; });
+    EXPECT_EQ(versioned.generation(), copy.generation());
+    EXPECT_EQ(&versioned.get(), &copy.get());
+
+    copy.update([](std::vector<int>& value) { value[0] = 4; });
+    EXPECT_GT(copy.generation(), versioned.generation());
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), versioned.get());
+    EXPECT_EQ(std::vector<int>({4, 2, 3}), copy.get());
+}
+
+TEST(VersionedTest, generations_are_unique_across_types)
+{
+    Versioned<int> first(1);
+    Versioned<std::string> second("2");
+    Versioned<int> third(3);
+
+    EXPECT_NE(first.generation(), second.generation());
+    EXPECT_NE(second.generation(), third.generation());
+    EXPECT_NE(first.generation(), third.generation());
+}
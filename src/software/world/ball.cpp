@@ -11,13 +11,17 @@ Ball::Ball(const Point& position, const Vector& velocity, const Timestamp& times
 
 Ball::Ball(const BallState& initial_state, const Timestamp& timestamp,
            const Vector& acceleration)
-    : current_state_(initial_state), timestamp_(timestamp), acceleration_(acceleration)
+    : current_state_(initial_state),
+      timestamp_(timestamp),
+      acceleration_(acceleration),
+      chipped_(false)
 {
 }
 
 Ball::Ball(const TbotsProto::Ball& ball_proto)
     : current_state_(BallState(ball_proto.current_state())),
-      timestamp_(Timestamp::fromTimestampProto(ball_proto.timestamp()))
+      timestamp_(Timestamp::fromTimestampProto(ball_proto.timestamp())),
+      chipped_(ball_proto.chipped())
 {
 }
 
@@ -80,6 +84,16 @@ bool Ball::hasBallBeenKicked(const Angle& expected_kick_direction, double min_ki
             velocity().length() >= min_kick_speed);
 }
 
+bool Ball::isChipped() const
+{
+    return chipped_;
+}
+
+void Ball::setChipped(bool chipped)
+{
+    chipped_ = chipped;
+}
+
 bool Ball::operator==(const Ball& other) const
 {
     return this->position() == other.position() && this->velocity() == other.velocity();
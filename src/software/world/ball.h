@@ -115,6 +115,21 @@ class Ball final
         const Angle& expected_kick_direction, double min_kick_speed = 0.5,
         const Angle& max_angle_difference = Angle::fromDegrees(20)) const;
 
+    /**
+     * Returns whether the ball is in the air after being chipped. Balls are only
+     * marked as chipped by estimators that can tell a chipped ball from a rolling one.
+     *
+     * @return whether the ball is chipped
+     */
+    bool isChipped() const;
+
+    /**
+     * Sets whether the ball is in the air after being chipped
+     *
+     * @param chipped Whether the ball is chipped
+     */
+    void setChipped(bool chipped);
+
     /**
      * Defines the equality operator for a Ball. Balls are equal if their positions and
      * velocities are the same
@@ -136,4 +151,5 @@ class Ball final
     BallState current_state_;
     Timestamp timestamp_;
     Vector acceleration_;  // used to predict future states
+    bool chipped_;
 };
@@ -64,6 +64,16 @@ TEST_F(BallTest, construct_with_protobuf)
     EXPECT_EQ(original_ball, proto_converted_ball);
 }
 
+TEST_F(BallTest, chipped_ball_converted_to_protobuf_stays_chipped)
+{
+    Ball ball(Point(1.0, 1.0), Vector(2.0, 2.0), current_time);
+    EXPECT_FALSE(ball.isChipped());
+
+    ball.setChipped(true);
+    std::unique_ptr<TbotsProto::Ball> ball_proto = createBall(ball);
+    EXPECT_TRUE(Ball(*ball_proto).isChipped());
+}
+
 TEST_F(BallTest, update_state_with_all_params)
 {
     Ball ball = Ball(Point(), Vector(), current_time);
@@ -4,13 +4,15 @@
 
 GameState::GameState(const TbotsProto::GameState& game_state_proto) : our_restart_(false)
 {
-    if (game_state_proto.has_ball())
+    if (game_state_proto.has_restart_ball_position())
     {
-        ball_ = Ball(game_state_proto.ball());
+        restart_ball_position_ =
+            Point(game_state_proto.restart_ball_position().x_meters(),
+                  game_state_proto.restart_ball_position().y_meters());
     }
     else
     {
-        ball_ = std::nullopt;
+        restart_ball_position_ = std::nullopt;
     }
 
     if (game_state_proto.has_ball_placement_point())
@@ -283,9 +285,9 @@ std::optional<Point> GameState::getBallPlacementPoint() const
     return ball_placement_point_;
 }
 
-std::optional<Ball> GameState::getBall(void) const
+std::optional<Point> GameState::getRestartBallPosition(void) const
 {
-    return ball_;
+    return restart_ball_position_;
 }
 
 // apologies for this monster switch statement
@@ -390,16 +392,16 @@ void GameState::updateBall(const Ball& ball)
 {
     if (play_state_ == READY && restart_reason_ != PENALTY)
     {
-        if (!ball_)
+        if (!restart_ball_position_)
         {
-            // Save the ball play_state_ so we can tell once it moves
-            ball_ = ball;
+            // Save the ball position so we can tell once it moves
+            restart_ball_position_ = ball.position();
         }
-        else if ((ball.position() - ball_->position()).length() > 0.03)
+        else if ((ball.position() - *restart_ball_position_).length() > 0.03)
         {
             // Once the ball has moved enough, the restart is finished
             setRestartCompleted();
-            ball_ = std::nullopt;
+            restart_ball_position_ = std::nullopt;
         }
     }
 }
@@ -425,7 +427,8 @@ bool GameState::operator==(const GameState& other) const
 {
     return this->play_state_ == other.play_state_ &&
            this->restart_reason_ == other.restart_reason_ &&
-           this->command_ == other.command_ && this->ball_ == other.ball_ &&
+           this->command_ == other.command_ &&
+           this->restart_ball_position_ == other.restart_ball_position_ &&
            this->our_restart_ == other.our_restart_ &&
            this->ball_placement_point_ == other.ball_placement_point_;
 }
@@ -103,7 +103,7 @@ class GameState
         : play_state_(HALT),
           restart_reason_(NONE),
           command_(RefereeCommand::HALT),
-          ball_(std::nullopt),
+          restart_ball_position_(std::nullopt),
           our_restart_(false),
           ball_placement_point_(std::nullopt)
     {
@@ -125,7 +125,9 @@ class GameState
     void updateRefereeCommand(RefereeCommand gameState);
 
     /**
-     * Updates the state of the ball used in calculating game state transitions
+     * Updates the game state with the latest ball, finishing a restart once the ball
+     * has moved away from where it was when the restart became ready. Only that
+     * position is kept, so ball updates don't change the game state otherwise.
      *
      * @param ball The new ball
      */
@@ -414,11 +416,12 @@ class GameState
     std::optional<Point> getBallPlacementPoint(void) const;
 
     /**
-     * Returns the ball
+     * Returns where the ball was when the current restart became ready
      *
-     * @return the ball state if one is specified, otherwise std::nullopt
+     * @return the position of the ball when the restart became ready, or std::nullopt
+     * if no restart is waiting for the ball to move
      */
-    std::optional<Ball> getBall(void) const;
+    std::optional<Point> getRestartBallPosition(void) const;
 
     /**
      * Sets the point on the field where the ball should be placed.
@@ -432,7 +435,9 @@ class GameState
     PlayState play_state_;
     RestartReason restart_reason_;
     RefereeCommand command_;
-    std::optional<Ball> ball_;
+    // Where the ball was when the current restart became ready. The restart is
+    // finished once the ball moves away from here.
+    std::optional<Point> restart_ball_position_;
 
     // True if our team can kick the ball during a restart
     bool our_restart_;
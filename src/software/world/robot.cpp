@@ -14,7 +14,7 @@ Robot::Robot(RobotId id, const Point& position, const Vector& velocity,
                      breakbeam_tripped),
       timestamp_(timestamp),
       unavailable_capabilities_(unavailable_capabilities),
-      robot_constants_(robot_constants)
+      robot_constants_(shareRobotConstants(robot_constants))
 {
 }
 
@@ -27,7 +27,7 @@ Robot::Robot(RobotId id, const Point& position, const Vector& velocity,
       current_state_(position, velocity, orientation, angular_velocity, false),
       timestamp_(timestamp),
       unavailable_capabilities_(unavailable_capabilities),
-      robot_constants_(robot_constants)
+      robot_constants_(shareRobotConstants(robot_constants))
 {
 }
 
@@ -38,7 +38,7 @@ Robot::Robot(RobotId id, const RobotState& initial_state, const Timestamp& times
       current_state_(initial_state),
       timestamp_(timestamp),
       unavailable_capabilities_(unavailable_capabilities),
-      robot_constants_(robot_constants)
+      robot_constants_(shareRobotConstants(robot_constants))
 {
 }
 
@@ -46,23 +46,24 @@ Robot::Robot(const TbotsProto::Robot& robot_proto)
     : id_(robot_proto.id()),
       current_state_(RobotState(robot_proto.current_state())),
       timestamp_(Timestamp::fromTimestampProto(robot_proto.timestamp())),
-      robot_constants_(DEFAULT_ROBOT_CONSTANTS)
+      unavailable_capabilities_(),
+      robot_constants_(shareRobotConstants(DEFAULT_ROBOT_CONSTANTS))
 {
     for (const auto& unavailable_capability : robot_proto.unavailable_capabilities())
     {
         switch (unavailable_capability)
         {
             case TbotsProto::Robot_RobotCapability_Dribble:
-                unavailable_capabilities_.emplace(RobotCapability::Dribble);
+                unavailable_capabilities_.insert(RobotCapability::Dribble);
                 break;
             case TbotsProto::Robot_RobotCapability_Kick:
-                unavailable_capabilities_.emplace(RobotCapability::Kick);
+                unavailable_capabilities_.insert(RobotCapability::Kick);
                 break;
             case TbotsProto::Robot_RobotCapability_Chip:
-                unavailable_capabilities_.emplace(RobotCapability::Chip);
+                unavailable_capabilities_.insert(RobotCapability::Chip);
                 break;
             case TbotsProto::Robot_RobotCapability_Move:
-                unavailable_capabilities_.emplace(RobotCapability::Move);
+                unavailable_capabilities_.insert(RobotCapability::Move);
                 break;
         }
     }
@@ -147,40 +148,56 @@ bool Robot::operator!=(const Robot& other) const
     return !(*this == other);
 }
 
-const std::set<RobotCapability>& Robot::getUnavailableCapabilities() const
+std::set<RobotCapability> Robot::getUnavailableCapabilities() const
+{
+    return unavailable_capabilities_.toSet();
+}
+
+RobotCapabilityFlags Robot::unavailableCapabilityFlags() const
 {
     return unavailable_capabilities_;
 }
 
 std::set<RobotCapability> Robot::getAvailableCapabilities() const
 {
-    // robot capabilities = all possible capabilities - unavailable capabilities
-
-    std::set<RobotCapability> all_capabilities = allRobotCapabilities();
-    std::set<RobotCapability> robot_capabilities;
-    std::set_difference(all_capabilities.begin(), all_capabilities.end(),
-                        getUnavailableCapabilities().begin(),
-                        getUnavailableCapabilities().end(),
-                        std::inserter(robot_capabilities, robot_capabilities.begin()));
+    return availableCapabilityFlags().toSet();
+}
 
-    return robot_capabilities;
+RobotCapabilityFlags Robot::availableCapabilityFlags() const
+{
+    // robot capabilities = all possible capabilities - unavailable capabilities
+    return RobotCapabilityFlags::all().without(unavailable_capabilities_);
 }
 
-std::set<RobotCapability>& Robot::getMutableRobotCapabilities()
+void Robot::setUnavailableCapabilities(
+    const std::set<RobotCapability>& unavailable_capabilities)
 {
-    return unavailable_capabilities_;
+    unavailable_capabilities_ = RobotCapabilityFlags(unavailable_capabilities);
 }
 
 const robot_constants::RobotConstants& Robot::robotConstants() const
 {
-    return robot_constants_;
+    return *robot_constants_;
+}
+
+std::shared_ptr<const robot_constants::RobotConstants> Robot::shareRobotConstants(
+    const robot_constants::RobotConstants& robot_constants)
+{
+    if (&robot_constants == &DEFAULT_ROBOT_CONSTANTS)
+    {
+        // The default constants live as long as the program, so the pointer doesn't
+        // need to own them
+        return std::shared_ptr<const robot_constants::RobotConstants>(
+            std::shared_ptr<void>(), &DEFAULT_ROBOT_CONSTANTS);
+    }
+    return std::make_shared<const robot_constants::RobotConstants>(robot_constants);
 }
 
 Polygon Robot::dribblerArea() const
 {
     auto vector_to_front = Vector::createFromAngle(orientation());
     double depth         = BALL_MAX_RADIUS_METERS;
-    double width         = robot_constants_.dribbler_width_meters;
+    double width         = robot_constants_->dribbler_width_meters;
     Point bottom_left_position =
         position() +
         vector_to_front.normalize(DIST_TO_FRONT_OF_ROBOT_METERS -
@@ -201,8 +218,8 @@ Duration Robot::getTimeToOrientation(const Angle& desired_orientation,
     double dist = orientation().minDiff(desired_orientation).toRadians();
     double initial_ang_vel_rad_per_sec = angularVelocity().toRadians();
     return getTimeToTravelDistance(
-        dist, robot_constants_.robot_max_ang_speed_rad_per_s,
-        robot_constants_.robot_max_ang_acceleration_rad_per_s_2,
+        dist, robot_constants_->robot_max_ang_speed_rad_per_s,
+        robot_constants_->robot_max_ang_acceleration_rad_per_s_2,
         initial_ang_vel_rad_per_sec, final_angular_velocity.toRadians());
 }
 
@@ -219,7 +236,7 @@ Duration Robot::getTimeToPosition(const Point& destination,
     double final_velocity_1d   = final_velocity.dot(dist_vector.normalize());
 
     return getTimeToTravelDistance(
-        dist, robot_constants_.robot_trajectory_max_speed_m_per_s,
-        robot_constants_.robot_trajectory_max_acceleration_m_per_s_2, initial_velocity_1d,
-        final_velocity_1d);
+        dist, robot_constants_->robot_trajectory_max_speed_m_per_s,
+        robot_constants_->robot_trajectory_max_acceleration_m_per_s_2,
+        initial_velocity_1d, final_velocity_1d);
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 
 #include "proto/team.pb.h"
@@ -156,7 +157,15 @@ class Robot
      *
      * @return the missing capabilities of the robot
      */
-    const std::set<RobotCapability>& getUnavailableCapabilities() const;
+    std::set<RobotCapability> getUnavailableCapabilities() const;
+
+    /**
+     * Returns the missing capabilities of the robot as a bitmask, which is cheaper to
+     * check than the set returned by getUnavailableCapabilities
+     *
+     * @return the missing capabilities of the robot
+     */
+    RobotCapabilityFlags unavailableCapabilityFlags() const;
 
     /**
      * Creates and returns a rectangle representing the dribbler area
@@ -173,11 +182,20 @@ class Robot
     std::set<RobotCapability> getAvailableCapabilities() const;
 
     /**
-     * Returns the mutable hardware capabilities of the robot
+     * Returns all available capabilities this robot has as a bitmask, which is cheaper
+     * to check than the set returned by getAvailableCapabilities
      *
-     * @return the mutable hardware capabilities of the robot
+     * @return Returns all available capabilities this robot has
      */
-    std::set<RobotCapability>& getMutableRobotCapabilities();
+    RobotCapabilityFlags availableCapabilityFlags() const;
+
+    /**
+     * Sets the hardware capabilities the robot is missing
+     *
+     * @param unavailable_capabilities the missing capabilities of the robot
+     */
+    void setUnavailableCapabilities(
+        const std::set<RobotCapability>& unavailable_capabilities);
 
     /**
      * Returns the robot constants for this robot
@@ -267,10 +285,22 @@ class Robot
     RobotId id_;
     RobotState current_state_;
     Timestamp timestamp_;
-    // The hardware capabilities of the robot, generated from
-    // RobotCapabilityFlags::broken_dribblers/chippers/kickers dynamic parameters
-    std::set<RobotCapability> unavailable_capabilities_;
-    robot_constants::RobotConstants robot_constants_;
+    // The hardware capabilities the robot is missing
+    RobotCapabilityFlags unavailable_capabilities_;
+    // The constants are shared by every copy of the robot, so copying a robot doesn't
+    // copy them
+    std::shared_ptr<const robot_constants::RobotConstants> robot_constants_;
+
+    /**
+     * Returns a pointer to robot constants that can be shared between robots. The
+     * default robot constants are shared by every robot without allocating.
+     *
+     * @param robot_constants The robot constants
+     *
+     * @return a pointer to the robot constants
+     */
+    static std::shared_ptr<const robot_constants::RobotConstants> shareRobotConstants(
+        const robot_constants::RobotConstants& robot_constants);
 
     // Default robot constants that should be used for all robots
     inline static const robot_constants::RobotConstants DEFAULT_ROBOT_CONSTANTS =
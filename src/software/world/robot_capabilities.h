@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <set>
 
 #include "software/util/make_enum/make_enum.hpp"
@@ -17,6 +18,157 @@ inline std::set<RobotCapability> allRobotCapabilities()
             RobotCapability::Move};
 }
 
+/**
+ * A set of RobotCapabilities stored as a bitmask, so it can be copied, compared and
+ * combined without allocating, unlike a std::set
+ */
+class RobotCapabilityFlags
+{
+   public:
+    /**
+     * Creates an empty set of capabilities
+     */
+    constexpr RobotCapabilityFlags() = default;
+
+    /**
+     * Creates a set of capabilities with the given capabilities
+     *
+     * @param capabilities The capabilities in the set
+     */
+    explicit RobotCapabilityFlags(const std::set<RobotCapability>& capabilities)
+    {
+        for (RobotCapability capability : capabilities)
+        {
+            insert(capability);
+        }
+    }
+
+    /**
+     * Returns the set of all capabilities
+     *
+     * @return the set of all capabilities
+     */
+    static constexpr RobotCapabilityFlags all()
+    {
+        return RobotCapabilityFlags(
+            static_cast<uint8_t>((1u << reflective_enum::size<RobotCapability>()) - 1));
+    }
+
+    /**
+     * Adds a capability to the set
+     *
+     * @param capability The capability to add
+     */
+    constexpr void insert(RobotCapability capability)
+    {
+        bits_ = static_cast<uint8_t>(bits_ | bit(capability));
+    }
+
+    /**
+     * Removes a capability from the set
+     *
+     * @param capability The capability to remove
+     */
+    constexpr void erase(RobotCapability capability)
+    {
+        bits_ = static_cast<uint8_t>(bits_ & ~bit(capability));
+    }
+
+    /**
+     * Returns whether the set has the given capability
+     *
+     * @param capability The capability
+     *
+     * @return whether the set has the capability
+     */
+    constexpr bool contains(RobotCapability capability) const
+    {
+        return (bits_ & bit(capability)) != 0;
+    }
+
+    /**
+     * Returns whether the set has every capability in another set
+     *
+     * @param other The other set
+     *
+     * @return whether other is a subset of this set
+     */
+    constexpr bool containsAll(RobotCapabilityFlags other) const
+    {
+        return (other.bits_ & ~bits_) == 0;
+    }
+
+    /**
+     * Returns the capabilities in this set that are not in another set
+     *
+     * @param other The other set
+     *
+     * @return the difference between this set and other
+     */
+    constexpr RobotCapabilityFlags without(RobotCapabilityFlags other) const
+    {
+        return RobotCapabilityFlags(static_cast<uint8_t>(bits_ & ~other.bits_));
+    }
+
+    /**
+     * Returns whether the set has no capabilities
+     *
+     * @return whether the set is empty
+     */
+    constexpr bool empty() const
+    {
+        return bits_ == 0;
+    }
+
+    /**
+     * Returns the capabilities in the set as a std::set
+     *
+     * @return the capabilities in the set
+     */
+    std::set<RobotCapability> toSet() const
+    {
+        std::set<RobotCapability> capabilities;
+        for (RobotCapability capability : reflective_enum::values<RobotCapability>())
+        {
+            if (contains(capability))
+            {
+                capabilities.insert(capability);
+            }
+        }
+        return capabilities;
+    }
+
+    constexpr bool operator==(const RobotCapabilityFlags& other) const
+    {
+        return bits_ == other.bits_;
+    }
+
+    constexpr bool operator!=(const RobotCapabilityFlags& other) const
+    {
+        return bits_ != other.bits_;
+    }
+
+   private:
+    static_assert(reflective_enum::size<RobotCapability>() <= 8,
+                  "RobotCapabilityFlags can only hold 8 capabilities");
+
+    constexpr explicit RobotCapabilityFlags(uint8_t bits) : bits_(bits) {}
+
+    /**
+     * Returns the bit that represents a capability
+     *
+     * @param capability The capability
+     *
+     * @return the bit for the capability
+     */
+    static constexpr uint8_t bit(RobotCapability capability)
+    {
+        return static_cast<uint8_t>(1u << static_cast<unsigned int>(capability));
+    }
+
+    uint8_t bits_ = 0;
+};
+
 // utility operators below for comparing capabilities
 
 /**
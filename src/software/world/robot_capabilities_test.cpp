@@ -39,3 +39,42 @@ TEST(RobotCapabilitiesTest, test_all_capabilities)
         (all == std::set<RobotCapability>{RobotCapability::Dribble, RobotCapability::Move,
                                           RobotCapability::Chip, RobotCapability::Kick}));
 }
+
+TEST(RobotCapabilityFlagsTest, insert_erase_and_contains)
+{
+    RobotCapabilityFlags flags;
+    EXPECT_TRUE(flags.empty());
+
+    flags.insert(RobotCapability::Kick);
+    flags.insert(RobotCapability::Move);
+    EXPECT_TRUE(flags.contains(RobotCapability::Kick));
+    EXPECT_TRUE(flags.contains(RobotCapability::Move));
+    EXPECT_FALSE(flags.contains(RobotCapability::Chip));
+
+    flags.erase(RobotCapability::Kick);
+    EXPECT_FALSE(flags.contains(RobotCapability::Kick));
+    EXPECT_FALSE(flags.empty());
+}
+
+TEST(RobotCapabilityFlagsTest, conversion_to_and_from_set)
+{
+    std::set<RobotCapability> capabilities{RobotCapability::Dribble,
+                                           RobotCapability::Chip};
+    EXPECT_EQ(capabilities, RobotCapabilityFlags(capabilities).toSet());
+    EXPECT_EQ(allRobotCapabilities(), RobotCapabilityFlags::all().toSet());
+    EXPECT_EQ(RobotCapabilityFlags::all(), RobotCapabilityFlags(allRobotCapabilities()));
+}
+
+TEST(RobotCapabilityFlagsTest, contains_all_and_without)
+{
+    RobotCapabilityFlags kick_and_chip(
+        std::set<RobotCapability>{RobotCapability::Kick, RobotCapability::Chip});
+    RobotCapabilityFlags kick(std::set<RobotCapability>{RobotCapability::Kick});
+
+    EXPECT_TRUE(kick_and_chip.containsAll(kick));
+    EXPECT_FALSE(kick.containsAll(kick_and_chip));
+    EXPECT_TRUE(kick.containsAll(RobotCapabilityFlags()));
+    EXPECT_EQ(std::set<RobotCapability>{RobotCapability::Chip},
+              kick_and_chip.without(kick).toSet());
+    EXPECT_TRUE(kick.without(kick_and_chip).empty());
+}
@@ -326,6 +326,35 @@ TEST_F(RobotTest, get_available_capabilities)
     EXPECT_EQ(expected_capabilities, robot.getAvailableCapabilities());
 }
 
+TEST_F(RobotTest, set_unavailable_capabilities)
+{
+    Robot robot = Robot(0, Point(3, 1.2), Vector(-3, 1), Angle::fromDegrees(0),
+                        AngularVelocity::fromDegrees(25), current_time);
+    EXPECT_EQ(RobotCapabilityFlags::all(), robot.availableCapabilityFlags());
+
+    robot.setUnavailableCapabilities({RobotCapability::Kick});
+
+    EXPECT_EQ(std::set<RobotCapability>{RobotCapability::Kick},
+              robot.getUnavailableCapabilities());
+    EXPECT_TRUE(robot.unavailableCapabilityFlags().contains(RobotCapability::Kick));
+    EXPECT_FALSE(robot.availableCapabilityFlags().contains(RobotCapability::Kick));
+    EXPECT_TRUE(robot.availableCapabilityFlags().contains(RobotCapability::Chip));
+}
+
+TEST_F(RobotTest, copies_share_robot_constants)
+{
+    robot_constants::RobotConstants robot_constants =
+        robot_constants::createRobotConstants();
+    robot_constants.robot_radius_m = 0.1f;
+    Robot robot(0, Point(3, 1.2), Vector(-3, 1), Angle::fromDegrees(0),
+                AngularVelocity::fromDegrees(25), current_time, false, {},
+                robot_constants);
+    Robot copy = robot;
+
+    EXPECT_EQ(&robot.robotConstants(), &copy.robotConstants());
+    EXPECT_EQ(0.1f, copy.robotConstants().robot_radius_m);
+}
+
 TEST_F(RobotTest,
        time_to_desired_orientation_with_desired_orientation_equal_to_current_orientation)
 {
@@ -7,6 +7,7 @@
 
 Team::Team(const Duration& robot_expiry_buffer_duration)
     : team_robots_(),
+      view_(),
       goalie_id_(),
       robot_expiry_buffer_duration_(robot_expiry_buffer_duration),
       last_update_timestamp_()
@@ -39,6 +40,7 @@ Team::Team(const TbotsProto::Team& team_proto,
     {
         team_robots_.emplace_back(Robot(team_proto.team_robots(i)));
     }
+    updateView();
 }
 
 void Team::updateRobots(const std::vector<Robot>& new_robots)
@@ -57,7 +59,7 @@ void Team::updateRobots(const std::vector<Robot>& new_robots)
         }
 
         auto it = std::find_if(team_robots_.begin(), team_robots_.end(),
-                               [robot](const Robot& r) { return r.id() == robot.id(); });
+                               [&](const Robot& r) { return r.id() == robot.id(); });
         if (it != team_robots_.end())
         {
             // The robot already exists on the team. Find and update the robot
@@ -70,6 +72,7 @@ void Team::updateRobots(const std::vector<Robot>& new_robots)
         }
     }
 
+    updateView();
     updateTimestamp(getMostRecentTimestampFromRobots());
 }
 
@@ -102,6 +105,7 @@ void Team::removeExpiredRobots(const Timestamp& timestamp)
             it++;
         }
     }
+    updateView();
 }
 
 void Team::removeRobotWithId(unsigned int robot_id)
@@ -112,6 +116,7 @@ void Team::removeRobotWithId(unsigned int robot_id)
     if (it != team_robots_.end())
     {
         team_robots_.erase(it);
+        updateView();
     }
 }
 
@@ -147,7 +152,8 @@ void Team::setUnavailableRobotCapabilities(
     {
         if (robot.id() == id)
         {
-            robot.getMutableRobotCapabilities() = new_unavailable_robot_capabilities;
+            robot.setUnavailableCapabilities(new_unavailable_robot_capabilities);
+            updateView();
             return;
         }
     }
@@ -204,7 +210,12 @@ std::vector<Robot> Team::getAllRobotsExceptGoalie() const
 
 std::optional<Robot> Team::getNearestRobot(const Point& ref_point) const
 {
-    return getNearestRobot(this->getAllRobots(), ref_point);
+    std::optional<size_t> nearest_index = view_.nearestTo(ref_point);
+    if (!nearest_index)
+    {
+        return std::nullopt;
+    }
+    return team_robots_[*nearest_index];
 }
 
 std::optional<Robot> Team::getNearestRobot(const std::vector<Robot>& robots,
@@ -231,6 +242,17 @@ std::optional<Robot> Team::getNearestRobot(const std::vector<Robot>& robots,
 void Team::clearAllRobots()
 {
     team_robots_.clear();
+    updateView();
+}
+
+const TeamView& Team::view() const
+{
+    return view_;
+}
+
+void Team::updateView()
+{
+    view_ = TeamView(team_robots_);
 }
 
 Timestamp Team::getMostRecentTimestamp() const
@@ -240,11 +262,9 @@ Timestamp Team::getMostRecentTimestamp() const
 
 Timestamp Team::getMostRecentTimestampFromRobots()
 {
-    std::vector<Robot> robots = this->getAllRobots();
-
     Timestamp most_recent_timestamp = Timestamp::fromSeconds(0);
 
-    for (Robot robot : robots)
+    for (const Robot& robot : team_robots_)
     {
         if (robot.timestamp() > most_recent_timestamp)
         {
@@ -7,6 +7,7 @@
 
 #include "software/time/timestamp.h"
 #include "software/world/robot.h"
+#include "software/world/team_view.h"
 
 /**
  * A team of robots
@@ -172,6 +173,14 @@ class Team
      */
     const std::vector<Robot>& getAllRobots() const;
 
+    /**
+     * Returns a structure-of-arrays view of the robots on this team, in the same order
+     * as getAllRobots. Iterating over the view doesn't copy any robots.
+     *
+     * @return a view of the robots on this team
+     */
+    const TeamView& view() const;
+
     /**
      * Returns a vector of all the robots on this team excluding the goalie
      *
@@ -255,8 +264,16 @@ class Team
      */
     Timestamp getMostRecentTimestampFromRobots();
 
+    /**
+     * Recreates the view of the robots on this team. Must be called whenever
+     * team_robots_ changes.
+     */
+    void updateView();
+
     // The robots on this team
     std::vector<Robot> team_robots_;
+    // A structure-of-arrays view of team_robots_
+    TeamView view_;
 
     // The robot id of the goalie for this team
     std::optional<unsigned int> goalie_id_;
@@ -0,0 +1,89 @@
+#include "software/world/team_view.h"
+
+TeamView::TeamView(const std::vector<Robot>& robots)
+{
+    for (const Robot& robot : robots)
+    {
+        ids_.push_back(robot.id());
+        positions_.push_back(robot.position());
+        velocities_.push_back(robot.velocity());
+        orientations_.push_back(robot.orientation());
+        angular_velocities_.push_back(robot.angularVelocity());
+        available_capabilities_.push_back(robot.availableCapabilityFlags());
+        robot_constants_.push_back(&robot.robotConstants());
+    }
+}
+
+size_t TeamView::size() const
+{
+    return ids_.size();
+}
+
+bool TeamView::empty() const
+{
+    return ids_.empty();
+}
+
+const TeamView::RobotArray<RobotId>& TeamView::ids() const
+{
+    return ids_;
+}
+
+const TeamView::RobotArray<Point>& TeamView::positions() const
+{
+    return positions_;
+}
+
+const TeamView::RobotArray<Vector>& TeamView::velocities() const
+{
+    return velocities_;
+}
+
+const TeamView::RobotArray<Angle>& TeamView::orientations() const
+{
+    return orientations_;
+}
+
+const TeamView::RobotArray<AngularVelocity>& TeamView::angularVelocities() const
+{
+    return angular_velocities_;
+}
+
+const TeamView::RobotArray<RobotCapabilityFlags>& TeamView::availableCapabilities() const
+{
+    return available_capabilities_;
+}
+
+const TeamView::RobotArray<const robot_constants::RobotConstants*>&
+TeamView::robotConstants() const
+{
+    return robot_constants_;
+}
+
+std::optional<size_t> TeamView::indexOf(RobotId id) const
+{
+    for (size_t i = 0; i < ids_.size(); i++)
+    {
+        if (ids_[i] == id)
+        {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<size_t> TeamView::nearestTo(const Point& point) const
+{
+    std::optional<size_t> nearest_index;
+    double nearest_distance_squared = 0;
+    for (size_t i = 0; i < positions_.size(); i++)
+    {
+        double distance_squared = (positions_[i] - point).lengthSquared();
+        if (!nearest_index || distance_squared < nearest_distance_squared)
+        {
+            nearest_index            = i;
+            nearest_distance_squared = distance_squared;
+        }
+    }
+    return nearest_index;
+}
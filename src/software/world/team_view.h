@@ -0,0 +1,127 @@
+#pragma once
+
+#include <boost/container/small_vector.hpp>
+#include <optional>
+#include <vector>
+
+#include "shared/constants.h"
+#include "software/world/robot.h"
+
+/**
+ * The state of every robot on a team, stored as a structure of arrays.
+ *
+ * Each array holds one value per robot, in the same order as Team::getAllRobots, so
+ * hot paths that only need a few fields of every robot (e.g. their positions) can
+ * iterate over contiguous memory instead of copying whole Robots. The arrays are stored
+ * inline for up to MAX_ROBOT_IDS robots, so creating and copying a TeamView doesn't
+ * allocate.
+ */
+class TeamView
+{
+   public:
+    template <typename T>
+    using RobotArray = boost::container::small_vector<T, MAX_ROBOT_IDS>;
+
+    /**
+     * Creates a view of a team with no robots
+     */
+    TeamView() = default;
+
+    /**
+     * Creates a view of the given robots
+     *
+     * @param robots The robots on the team
+     */
+    explicit TeamView(const std::vector<Robot>& robots);
+
+    /**
+     * Returns the number of robots in the view
+     *
+     * @return the number of robots
+     */
+    size_t size() const;
+
+    /**
+     * Returns whether the view has no robots
+     *
+     * @return whether the view has no robots
+     */
+    bool empty() const;
+
+    /**
+     * Returns the id of each robot
+     *
+     * @return the id of each robot
+     */
+    const RobotArray<RobotId>& ids() const;
+
+    /**
+     * Returns the position of each robot
+     *
+     * @return the position of each robot
+     */
+    const RobotArray<Point>& positions() const;
+
+    /**
+     * Returns the velocity of each robot
+     *
+     * @return the velocity of each robot
+     */
+    const RobotArray<Vector>& velocities() const;
+
+    /**
+     * Returns the orientation of each robot
+     *
+     * @return the orientation of each robot
+     */
+    const RobotArray<Angle>& orientations() const;
+
+    /**
+     * Returns the angular velocity of each robot
+     *
+     * @return the angular velocity of each robot
+     */
+    const RobotArray<AngularVelocity>& angularVelocities() const;
+
+    /**
+     * Returns the capabilities each robot has
+     *
+     * @return the available capabilities of each robot
+     */
+    const RobotArray<RobotCapabilityFlags>& availableCapabilities() const;
+
+    /**
+     * Returns the constants of each robot, which are shared with the robots on the team
+     * and stay valid as long as the team does
+     *
+     * @return the robot constants of each robot
+     */
+    const RobotArray<const robot_constants::RobotConstants*>& robotConstants() const;
+
+    /**
+     * Returns the index of the robot with the given id
+     *
+     * @param id The id of the robot
+     *
+     * @return the index of the robot, or std::nullopt if there is no robot with that id
+     */
+    std::optional<size_t> indexOf(RobotId id) const;
+
+    /**
+     * Returns the index of the robot closest to a point
+     *
+     * @param point The point to measure the distance to each robot from
+     *
+     * @return the index of the closest robot, or std::nullopt if there are no robots
+     */
+    std::optional<size_t> nearestTo(const Point& point) const;
+
+   private:
+    RobotArray<RobotId> ids_;
+    RobotArray<Point> positions_;
+    RobotArray<Vector> velocities_;
+    RobotArray<Angle> orientations_;
+    RobotArray<AngularVelocity> angular_velocities_;
+    RobotArray<RobotCapabilityFlags> available_capabilities_;
+    RobotArray<const robot_constants::RobotConstants*> robot_constants_;
+};
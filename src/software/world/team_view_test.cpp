@@ -0,0 +1,76 @@
+#include "software/world/team_view.h"
+
+#include <gtest/gtest.h>
+
+#include "software/world/team.h"
+
+class TeamViewTest : public ::testing::Test
+{
+   protected:
+    Timestamp current_time = Timestamp::fromSeconds(123);
+    Robot robot_0 = Robot(0, Point(0, 1), Vector(-1, -2), Angle::half(),
+                          AngularVelocity::threeQuarter(), current_time);
+    Robot robot_1 = Robot(3, Point(3, -1), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time, false,
+                          {RobotCapability::Kick, RobotCapability::Chip});
+};
+
+TEST_F(TeamViewTest, empty_team)
+{
+    Team team;
+    EXPECT_TRUE(team.view().empty());
+    EXPECT_EQ(0, team.view().size());
+    EXPECT_FALSE(team.view().nearestTo(Point(0, 0)));
+    EXPECT_FALSE(team.view().indexOf(0));
+}
+
+TEST_F(TeamViewTest, view_matches_the_robots_on_the_team)
+{
+    Team team({robot_0, robot_1});
+    const TeamView& view = team.view();
+
+    ASSERT_EQ(team.numRobots(), view.size());
+    for (size_t i = 0; i < view.size(); i++)
+    {
+        const Robot& robot = team.getAllRobots()[i];
+        EXPECT_EQ(robot.id(), view.ids()[i]);
+        EXPECT_EQ(robot.position(), view.positions()[i]);
+        EXPECT_EQ(robot.velocity(), view.velocities()[i]);
+        EXPECT_EQ(robot.orientation(), view.orientations()[i]);
+        EXPECT_EQ(robot.angularVelocity(), view.angularVelocities()[i]);
+        EXPECT_EQ(robot.availableCapabilityFlags(), view.availableCapabilities()[i]);
+        EXPECT_EQ(&robot.robotConstants(), view.robotConstants()[i]);
+    }
+    EXPECT_FALSE(view.availableCapabilities()[1].contains(RobotCapability::Kick));
+    EXPECT_TRUE(view.availableCapabilities()[1].contains(RobotCapability::Dribble));
+}
+
+TEST_F(TeamViewTest, view_is_updated_with_the_team)
+{
+    Team team({robot_0, robot_1});
+
+    team.updateRobots({Robot(0, Point(-2, 2), Vector(), Angle::zero(),
+                             AngularVelocity::zero(), current_time)});
+    EXPECT_EQ(Point(-2, 2), team.view().positions()[0]);
+
+    team.setUnavailableRobotCapabilities(0, {RobotCapability::Move});
+    EXPECT_FALSE(team.view().availableCapabilities()[0].contains(RobotCapability::Move));
+
+    team.removeRobotWithId(0);
+    ASSERT_EQ(1, team.view().size());
+    EXPECT_EQ(3, team.view().ids()[0]);
+
+    team.clearAllRobots();
+    EXPECT_TRUE(team.view().empty());
+}
+
+TEST_F(TeamViewTest, index_of_and_nearest_robot)
+{
+    Team team({robot_0, robot_1});
+    const TeamView& view = team.view();
+
+    EXPECT_EQ(1, view.indexOf(3));
+    EXPECT_FALSE(view.indexOf(1));
+    EXPECT_EQ(0, view.nearestTo(Point(0, 0)));
+    EXPECT_EQ(1, view.nearestTo(Point(4, -1)));
+}
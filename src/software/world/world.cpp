@@ -2,21 +2,58 @@
 
 #include "boost/circular_buffer.hpp"
 
+namespace
+{
+    /**
+     * Returns the GameState that every world starts with. It is shared by every world,
+     * so creating a world doesn't allocate a GameState that is usually replaced straight
+     * away.
+     *
+     * @return the default GameState
+     */
+    const Versioned<GameState>& defaultGameState()
+    {
+        static const Versioned<GameState> game_state;
+        return game_state;
+    }
+
+    /**
+     * Returns the list of virtual obstacles that every world starts with, shared by
+     * every world like defaultGameState
+     *
+     * @return the default list of virtual obstacles
+     */
+    const Versioned<TbotsProto::VirtualObstacles>& defaultVirtualObstacles()
+    {
+        static const Versioned<TbotsProto::VirtualObstacles> virtual_obstacles;
+        return virtual_obstacles;
+    }
+}  // namespace
+
 World::World(const Field& field, const Ball& ball, const Team& friendly_team,
              const Team& enemy_team, unsigned int buffer_size)
+    : World(Versioned<Field>(field), Versioned<Ball>(ball),
+            Versioned<Team>(friendly_team), Versioned<Team>(enemy_team))
+{
+}
+
+World::World(const Versioned<Field>& field, const Versioned<Ball>& ball,
+             const Versioned<Team>& friendly_team, const Versioned<Team>& enemy_team)
     : dribble_displacement_(std::nullopt),
       field_(field),
       ball_(ball),
       friendly_team_(friendly_team),
       enemy_team_(enemy_team),
-      current_game_state_(),
+      current_game_state_(defaultGameState()),
       current_referee_stage_(),
       last_update_timestamp_(),
-      // Store a small buffer of previous referee commands so we can filter out noise
-      referee_command_history_(REFEREE_COMMAND_BUFFER_SIZE),
-      referee_stage_history_(REFEREE_COMMAND_BUFFER_SIZE),
+      // Store a small buffer of previous referee commands so we can filter out noise.
+      // Most worlds never receive a referee command, so the buffers are only allocated
+      // once they do.
+      referee_command_history_(),
+      referee_stage_history_(),
       team_with_possession_(TeamPossession::FRIENDLY_TEAM),
-      virtual_obstacles_()
+      virtual_obstacles_(defaultVirtualObstacles())
 {
     updateTimestamp(getMostRecentTimestampFromMembers());
 }
@@ -29,20 +66,21 @@ World::World(const TbotsProto::World& world_proto)
 
 void World::updateBall(const Ball& new_ball)
 {
-    ball_ = new_ball;
+    ball_.set(new_ball);
     updateTimestamp(getMostRecentTimestampFromMembers());
-    current_game_state_.updateBall(ball_);
+    current_game_state_.update([&](GameState& game_state)
+                               { game_state.updateBall(new_ball); });
 }
 
 void World::updateFriendlyTeamState(const Team& new_friendly_team_data)
 {
-    friendly_team_.updateState(new_friendly_team_data);
+    friendly_team_.modify().updateState(new_friendly_team_data);
     updateTimestamp(getMostRecentTimestampFromMembers());
 }
 
 void World::updateEnemyTeamState(const Team& new_enemy_team_data)
 {
-    enemy_team_.updateState(new_enemy_team_data);
+    enemy_team_.modify().updateState(new_enemy_team_data);
     updateTimestamp(getMostRecentTimestampFromMembers());
 }
 
@@ -61,26 +99,50 @@ void World::updateTimestamp(Timestamp timestamp)
 
 const Field& World::field() const
 {
-    return field_;
+    return *field_;
+}
+
+uint64_t World::fieldGeneration() const
+{
+    return field_.generation();
 }
 
 const Ball& World::ball() const
 {
-    return ball_;
+    return *ball_;
+}
+
+uint64_t World::ballGeneration() const
+{
+    return ball_.generation();
 }
 
 const Team& World::friendlyTeam() const
 {
-    return friendly_team_;
+    return *friendly_team_;
+}
+
+uint64_t World::friendlyTeamGeneration() const
+{
+    return friendly_team_.generation();
 }
 
 const Team& World::enemyTeam() const
 {
-    return enemy_team_;
+    return *enemy_team_;
+}
+
+uint64_t World::enemyTeamGeneration() const
+{
+    return enemy_team_.generation();
 }
 
 void World::updateRefereeCommand(const RefereeCommand& command)
 {
+    if (referee_command_history_.capacity() == 0)
+    {
+        referee_command_history_.set_capacity(REFEREE_COMMAND_BUFFER_SIZE);
+    }
     referee_command_history_.push_back(command);
     // Take the consensus of the previous referee messages
     if (!referee_command_history_.empty() &&
@@ -88,7 +150,8 @@ void World::updateRefereeCommand(const RefereeCommand& command)
                     [&](auto game_state)
                     { return game_state == referee_command_history_.front(); }))
     {
-        current_game_state_.updateRefereeCommand(command);
+        current_game_state_.update([&](GameState& game_state)
+                                   { game_state.updateRefereeCommand(command); });
     }
 }
 
@@ -96,11 +159,17 @@ void World::updateRefereeCommand(const RefereeCommand& command,
                                  Point ball_placement_point)
 {
     updateRefereeCommand(command);
-    current_game_state_.setBallPlacementPoint(ball_placement_point);
+    current_game_state_.update(
+        [&](GameState& game_state)
+        { game_state.setBallPlacementPoint(ball_placement_point); });
 }
 
 void World::updateRefereeStage(const RefereeStage& stage)
 {
+    if (referee_stage_history_.capacity() == 0)
+    {
+        referee_stage_history_.set_capacity(REFEREE_COMMAND_BUFFER_SIZE);
+    }
     referee_stage_history_.push_back(stage);
     // Take the consensus of the previous referee messages
     if (!referee_stage_history_.empty() &&
@@ -119,8 +188,8 @@ Timestamp World::getMostRecentTimestampFromMembers()
 
     // Add all member timestamps to a list
     std::initializer_list<Timestamp> member_timestamps = {
-        friendly_team_.getMostRecentTimestamp(), enemy_team_.getMostRecentTimestamp(),
-        ball_.timestamp()};
+        friendly_team_->getMostRecentTimestamp(), enemy_team_->getMostRecentTimestamp(),
+        ball_->timestamp()};
     // Return the max
 
     return std::max(member_timestamps);
@@ -133,7 +202,12 @@ const Timestamp World::getMostRecentTimestamp() const
 
 const GameState& World::gameState() const
 {
-    return current_game_state_;
+    return *current_game_state_;
+}
+
+uint64_t World::gameStateGeneration() const
+{
+    return current_game_state_.generation();
 }
 
 bool World::operator==(const World& other) const
@@ -152,10 +226,16 @@ bool World::operator!=(const World& other) const
 
 void World::updateGameStateBall(const Ball& ball)
 {
-    current_game_state_.updateBall(ball);
+    current_game_state_.update([&](GameState& game_state)
+                               { game_state.updateBall(ball); });
 }
 
 void World::updateGameState(const GameState& game_state)
+{
+    current_game_state_.set(game_state);
+}
+
+void World::updateGameState(const Versioned<GameState>& game_state)
 {
     current_game_state_ = game_state;
 }
@@ -176,13 +256,34 @@ TeamPossession World::getTeamWithPossession() const
 }
 
 void World::setVirtualObstacles(const TbotsProto::VirtualObstacles& virtual_obstacles)
+{
+    virtual_obstacles_.set(virtual_obstacles);
+}
+
+void World::setVirtualObstacles(
+    const Versioned<TbotsProto::VirtualObstacles>& virtual_obstacles)
 {
     virtual_obstacles_ = virtual_obstacles;
 }
 
-TbotsProto::VirtualObstacles World::getVirtualObstacles() const
+const TbotsProto::VirtualObstacles& World::getVirtualObstacles() const
+{
+    return *virtual_obstacles_;
+}
+
+uint64_t World::virtualObstaclesGeneration() const
+{
+    return virtual_obstacles_.generation();
+}
+
+void World::setLatencyTrace(const TbotsProto::PipelineLatencyTrace& latency_trace)
+{
+    latency_trace_ = latency_trace;
+}
+
+const TbotsProto::PipelineLatencyTrace& World::getLatencyTrace() const
 {
-    return virtual_obstacles_;
+    return latency_trace_;
 }
 
 void World::setDribbleDisplacement(const std::optional<Segment>& displacement)
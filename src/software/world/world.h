@@ -3,7 +3,9 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include "proto/tbots_software_msgs.pb.h"
 #include "proto/visualization.pb.h"
+#include "software/util/versioned/versioned.hpp"
 #include "software/world/ball.h"
 #include "software/world/field.h"
 #include "software/world/game_state.h"
@@ -14,9 +16,15 @@
  * information we have about the field, robots, and ball. The world object acts as a
  * convenient way to pass all this information around to modules that may need it.
  *
- * WARNING: This class should _never_ hold any data that is pointed to anywhere else. This
- * means no raw pointers, no shared pointers, no shared references. This is because in
- * some cases we copy World's over multiple threads where having a shared member
+ * The Field, Ball, Teams, GameState and virtual obstacles are Versioned: copies of a
+ * World share them until one of the copies changes them. Each of them has a generation
+ * that changes whenever it does, so consumers can tell whether they need to recompute
+ * results that depend on them (see Memoized).
+ *
+ * WARNING: Apart from those Versioned components, which are never modified while they
+ * are shared, this class should _never_ hold any data that is pointed to anywhere else.
+ * This means no raw pointers, no shared pointers, no shared references. This is because
+ * in some cases we copy World's over multiple threads where having a shared member
  * between multiple instances of a World on multiple threads could result in
  * data corruption that would lead to absurdly hard to track bugs. YOU HAVE BEEN WARNED.
  */
@@ -36,6 +44,18 @@ class World final
     explicit World(const Field& field, const Ball& ball, const Team& friendly_team,
                    const Team& enemy_team, unsigned int buffer_size = 20);
 
+    /**
+     * Creates a new world that shares its field, ball and teams with other worlds
+     *
+     * @param field the field for the world
+     * @param ball the ball for the world
+     * @param friendly_team the friendly team for the world
+     * @param enemy_team the enemy_team for the world
+     */
+    explicit World(const Versioned<Field>& field, const Versioned<Ball>& ball,
+                   const Versioned<Team>& friendly_team,
+                   const Versioned<Team>& enemy_team);
+
     /**
      * Creates a new world based on the TbotsProto::World protobuf representation.
      *
@@ -94,6 +114,14 @@ class World final
      */
     const Field& field() const;
 
+    /**
+     * Returns the generation of the Field in the world, which changes whenever the
+     * Field does
+     *
+     * @return the generation of the Field
+     */
+    uint64_t fieldGeneration() const;
+
     /**
      * Returns a const reference to the Ball in the world
      *
@@ -101,6 +129,14 @@ class World final
      */
     const Ball& ball() const;
 
+    /**
+     * Returns the generation of the Ball in the world, which changes whenever the Ball
+     * is updated
+     *
+     * @return the generation of the Ball
+     */
+    uint64_t ballGeneration() const;
+
     /**
      * Returns a const reference to the Friendly Team in the world
      *
@@ -108,6 +144,14 @@ class World final
      */
     const Team& friendlyTeam() const;
 
+    /**
+     * Returns the generation of the Friendly Team in the world, which changes whenever
+     * the Friendly Team is updated
+     *
+     * @return the generation of the Friendly Team
+     */
+    uint64_t friendlyTeamGeneration() const;
+
     /**
      * Returns a const reference to the Enemy Team in the world
      *
@@ -115,6 +159,14 @@ class World final
      */
     const Team& enemyTeam() const;
 
+    /**
+     * Returns the generation of the Enemy Team in the world, which changes whenever the
+     * Enemy Team is updated
+     *
+     * @return the generation of the Enemy Team
+     */
+    uint64_t enemyTeamGeneration() const;
+
     /**
      * Returns a const reference to the Game State
      *
@@ -129,6 +181,21 @@ class World final
      */
     void updateGameState(const GameState& game_state);
 
+    /**
+     * Updates the current Game State, sharing it with other worlds
+     *
+     * @param game_state the game state to update with
+     */
+    void updateGameState(const Versioned<GameState>& game_state);
+
+    /**
+     * Returns the generation of the Game State, which changes whenever the Game State
+     * does
+     *
+     * @return the generation of the Game State
+     */
+    uint64_t gameStateGeneration() const;
+
     /**
      * Updates the ball inside of game state
      *
@@ -233,12 +300,43 @@ class World final
      */
     void setVirtualObstacles(const TbotsProto::VirtualObstacles& virtual_obstacles);
 
+    /**
+     * Set the list of virtual obstacles, sharing it with other worlds
+     *
+     * @param virtual_obstacles a list of the virtual_obstacles
+     */
+    void setVirtualObstacles(
+        const Versioned<TbotsProto::VirtualObstacles>& virtual_obstacles);
+
     /**
      * Get a list of virtual obstacles
      *
      * @return a list of virtual obstacles
      */
-    TbotsProto::VirtualObstacles getVirtualObstacles() const;
+    const TbotsProto::VirtualObstacles& getVirtualObstacles() const;
+
+    /**
+     * Returns the generation of the list of virtual obstacles, which changes whenever
+     * the list does
+     *
+     * @return the generation of the list of virtual obstacles
+     */
+    uint64_t virtualObstaclesGeneration() const;
+
+    /**
+     * Sets when the vision this world was built from was received, and when sensor
+     * fusion finished building the world. This isn't compared by operator==.
+     *
+     * @param latency_trace the latency trace of the world
+     */
+    void setLatencyTrace(const TbotsProto::PipelineLatencyTrace& latency_trace);
+
+    /**
+     * Gets the latency trace of the world, which is empty if it wasn't set
+     *
+     * @return the latency trace of the world
+     */
+    const TbotsProto::PipelineLatencyTrace& getLatencyTrace() const;
 
    private:
     /**
@@ -251,11 +349,11 @@ class World final
     // the friendly team continuously dribbling the ball across the field
     std::optional<Segment> dribble_displacement_;
 
-    Field field_;
-    Ball ball_;
-    Team friendly_team_;
-    Team enemy_team_;
-    GameState current_game_state_;
+    Versioned<Field> field_;
+    Versioned<Ball> ball_;
+    Versioned<Team> friendly_team_;
+    Versioned<Team> enemy_team_;
+    Versioned<GameState> current_game_state_;
     RefereeStage current_referee_stage_;
     Timestamp last_update_timestamp_;
     // A small buffer that stores previous referee command
@@ -266,7 +364,10 @@ class World final
     TeamPossession team_with_possession_;
 
     // Virtual Obstacles for the Trajectory Planner
-    TbotsProto::VirtualObstacles virtual_obstacles_;
+    Versioned<TbotsProto::VirtualObstacles> virtual_obstacles_;
+
+    // When the vision this world was built from was received and fused
+    TbotsProto::PipelineLatencyTrace latency_trace_;
 };
 
 using WorldPtr = std::shared_ptr<const World>;
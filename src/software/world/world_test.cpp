@@ -214,3 +214,114 @@ TEST_F(WorldTest, set_team_with_possession)
     world.setTeamWithPossession(TeamPossession::ENEMY_TEAM);
     EXPECT_EQ(world.getTeamWithPossession(), TeamPossession::ENEMY_TEAM);
 }
+
+TEST_F(WorldTest, copies_share_components_until_they_change)
+{
+    World copy = world;
+    EXPECT_EQ(&world.field(), &copy.field());
+    EXPECT_EQ(&world.gameState(), &copy.gameState());
+    EXPECT_EQ(world.fieldGeneration(), copy.fieldGeneration());
+    EXPECT_EQ(world.gameStateGeneration(), copy.gameStateGeneration());
+    EXPECT_EQ(world.virtualObstaclesGeneration(), copy.virtualObstaclesGeneration());
+
+    copy.updateRefereeCommand(RefereeCommand::STOP);
+    EXPECT_EQ(RefereeCommand::STOP, copy.gameState().getRefereeCommand());
+    EXPECT_NE(RefereeCommand::STOP, world.gameState().getRefereeCommand());
+    EXPECT_NE(world.gameStateGeneration(), copy.gameStateGeneration());
+    EXPECT_EQ(world.fieldGeneration(), copy.fieldGeneration());
+}
+
+TEST_F(WorldTest, game_state_generation_only_changes_with_the_game_state)
+{
+    world.updateRefereeCommand(RefereeCommand::STOP);
+    uint64_t generation = world.gameStateGeneration();
+
+    world.updateRefereeCommand(RefereeCommand::STOP);
+    world.updateGameStateBall(ball);
+    EXPECT_EQ(generation, world.gameStateGeneration());
+
+    world.updateRefereeCommand(RefereeCommand::FORCE_START);
+    world.updateRefereeCommand(RefereeCommand::FORCE_START);
+    world.updateRefereeCommand(RefereeCommand::FORCE_START);
+    EXPECT_NE(generation, world.gameStateGeneration());
+}
+
+TEST_F(WorldTest, game_state_generation_unchanged_by_ball_only_updates)
+{
+    GameState game_state;
+    game_state.updateRefereeCommand(RefereeCommand::PREPARE_KICKOFF_US);
+    game_state.updateRefereeCommand(RefereeCommand::NORMAL_START);
+    ASSERT_TRUE(game_state.isReadyState());
+    world.updateGameState(game_state);
+
+    // The kickoff remembers where the ball was when it became ready
+    world.updateBall(Ball(Point(0, 0), Vector(0, 0), current_time));
+    uint64_t generation = world.gameStateGeneration();
+
+    // The ball jitters and is moved by less than is needed to finish the kickoff
+    for (int i = 1; i <= 10; i++)
+    {
+        world.updateBall(Ball(Point(0.001 * i, -0.001 * i), Vector(0.01 * i, 0),
+                              current_time + Duration::fromMilliseconds(16 * i)));
+        EXPECT_EQ(generation, world.gameStateGeneration());
+    }
+
+    // Kicking the ball finishes the kickoff
+    world.updateBall(Ball(Point(0.5, 0), Vector(3, 0),
+                          current_time + Duration::fromMilliseconds(200)));
+    EXPECT_TRUE(world.gameState().isPlaying());
+    EXPECT_NE(generation, world.gameStateGeneration());
+
+    // Once playing, the ball moving never changes the game state
+    generation = world.gameStateGeneration();
+    for (int i = 1; i <= 10; i++)
+    {
+        world.updateBall(Ball(Point(0.5 + 0.05 * i, 0), Vector(3, 0),
+                              current_time + Duration::fromMilliseconds(200 + 16 * i)));
+        EXPECT_EQ(generation, world.gameStateGeneration());
+    }
+}
+
+TEST_F(WorldTest, ball_and_team_generations_change_when_they_are_updated)
+{
+    World copy = world;
+    EXPECT_EQ(&world.ball(), &copy.ball());
+    EXPECT_EQ(&world.friendlyTeam(), &copy.friendlyTeam());
+    EXPECT_EQ(world.ballGeneration(), copy.ballGeneration());
+    EXPECT_EQ(world.friendlyTeamGeneration(), copy.friendlyTeamGeneration());
+    EXPECT_EQ(world.enemyTeamGeneration(), copy.enemyTeamGeneration());
+
+    copy.updateEnemyTeamState(enemy_team);
+    EXPECT_NE(world.enemyTeamGeneration(), copy.enemyTeamGeneration());
+    EXPECT_EQ(world.friendlyTeamGeneration(), copy.friendlyTeamGeneration());
+    EXPECT_EQ(world.ballGeneration(), copy.ballGeneration());
+
+    copy.updateBall(ball);
+    EXPECT_NE(world.ballGeneration(), copy.ballGeneration());
+    EXPECT_EQ(world.ball(), copy.ball());
+}
+
+TEST_F(WorldTest, worlds_share_a_versioned_field)
+{
+    Versioned<Field> shared_field(field);
+    World first_world(shared_field, Versioned<Ball>(ball),
+                      Versioned<Team>(friendly_team), Versioned<Team>(enemy_team));
+    World second_world(shared_field, Versioned<Ball>(ball),
+                       Versioned<Team>(friendly_team), Versioned<Team>(enemy_team));
+
+    EXPECT_EQ(&first_world.field(), &second_world.field());
+    EXPECT_EQ(shared_field.generation(), first_world.fieldGeneration());
+    EXPECT_EQ(shared_field.generation(), second_world.fieldGeneration());
+}
+
+TEST_F(WorldTest, set_virtual_obstacles_changes_generation)
+{
+    uint64_t generation = world.virtualObstaclesGeneration();
+
+    TbotsProto::VirtualObstacles virtual_obstacles;
+    virtual_obstacles.add_obstacles();
+    world.setVirtualObstacles(virtual_obstacles);
+
+    EXPECT_EQ(1, world.getVirtualObstacles().obstacles_size());
+    EXPECT_NE(generation, world.virtualObstaclesGeneration());
+}